@@ -0,0 +1,98 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @typedef BenchmarkFunction
+     * @brief A benchmark body, registered with SGE_BENCHMARK. It prints its own results.
+     */
+    using BenchmarkFunction = void(*)();
+
+    /**
+     * @class BenchmarkRegistry
+     * @brief Collects the benchmarks of every file and runs them.
+     *
+     * Benchmarks register themselves during static initialization through SGE_BENCHMARK and
+     * are meant to be run from the Release configuration.
+     */
+    class BenchmarkRegistry
+    {
+    public:
+        BenchmarkRegistry() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Registers a benchmark.
+         * @param name The benchmark name.
+         * @param function The benchmark body.
+         * @return Always true, so it can initialize a static.
+         */
+        static bool add(const char* name, BenchmarkFunction function);
+
+        /**
+         * @brief Runs the benchmarks whose name contains a filter.
+         * @param filter The filter, empty to run every benchmark.
+         * @return The number of benchmarks run.
+         */
+        static int run(const std::string& filter);
+
+    private:
+        /**
+         * @struct Entry
+         * @brief A registered benchmark.
+         */
+        struct Entry
+        {
+            const char* name;           ///< Benchmark name.
+            BenchmarkFunction function; ///< Benchmark body.
+        };
+
+        /**
+         * @brief Gets the registered benchmarks, built on first use so registration order does not matter.
+         * @return The benchmarks.
+         */
+        static std::vector<Entry>& getEntries();
+    };
+
+    /**
+     * @class BenchmarkTimer
+     * @brief Measures wall time from its construction or last restart.
+     */
+    class BenchmarkTimer
+    {
+    public:
+        BenchmarkTimer() : start(std::chrono::steady_clock::now()) {}
+
+        /** @brief Starts measuring again. */
+        void restart() { start = std::chrono::steady_clock::now(); }
+
+        /** @brief Gets the elapsed time. @return The time in nanoseconds. */
+        double elapsedNs() const { return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count(); }
+
+        /** @brief Gets the elapsed time. @return The time in milliseconds. */
+        double elapsedMs() const { return elapsedNs() / 1e6; }
+
+    private:
+        std::chrono::steady_clock::time_point start; ///< Time point measured from.
+    };
+
+    /**
+     * @brief Keeps a result alive so the optimizer cannot drop the work producing it.
+     * @param value The result, an arithmetic value or a pointer.
+     */
+    template<typename T>
+    void keepAlive(T value)
+    {
+        static volatile T sink;
+        sink = value;
+        (void)sink;
+    }
+}
+
+/** @brief Defines and registers a benchmark. */
+#define SGE_BENCHMARK(name) \
+    static void name(); \
+    static const bool name##Registered = ::ScrapGameEngine::BenchmarkRegistry::add(#name, &name); \
+    static void name()
@@ -0,0 +1,44 @@
+#include "Benchmark.h"
+#include <cstdio>
+
+using namespace ScrapGameEngine;
+
+bool BenchmarkRegistry::add(const char* name, BenchmarkFunction function)
+{
+    getEntries().push_back({ name, function });
+    return true;
+}
+
+int BenchmarkRegistry::run(const std::string& filter)
+{
+    int ran = 0;
+    for (const Entry& entry : getEntries())
+    {
+        if (!filter.empty() && std::string(entry.name).find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::printf("%s\n", entry.name);
+        entry.function();
+        ran++;
+    }
+    return ran;
+}
+
+std::vector<BenchmarkRegistry::Entry>& BenchmarkRegistry::getEntries()
+{
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+// Runs every benchmark, or those whose name contains the first argument
+int main(int argc, char** argv)
+{
+    if (BenchmarkRegistry::run(argc > 1 ? argv[1] : "") == 0)
+    {
+        std::printf("No benchmark matches\n");
+        return 1;
+    }
+    return 0;
+}
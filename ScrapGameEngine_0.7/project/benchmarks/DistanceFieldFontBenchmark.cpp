@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+#include "FontCache.h"
+#include "Renderer.h"
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    // The repo's font first, a system font with lowercase outlines if it is installed
+    const char* FONT_PATHS[] = { "../assets/Assets/Fonts/AtariClassic-gry3.ttf", "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf" };
+    const int BITMAP_SIZES[] = { 16, 24, 32, 48, 64, 96, 128 };
+    const int DISTANCE_FIELD_SIZE = 32;
+
+    /**
+     * @brief Gets the RGBA size of a font's atlas.
+     * @param font The font.
+     * @return The size in bytes.
+     */
+    size_t atlasBytes(Font* font)
+    {
+        glm::ivec2 size = font->getAtlas()->getSize();
+        return static_cast<size_t>(size.x) * size.y * 4;
+    }
+}
+
+SGE_BENCHMARK(DistanceFieldFontVersusBitmapSizes)
+{
+    // Atlases are built on the CPU, textures are not uploaded
+    Renderer::setBackend(RendererBackend::RECORDING);
+
+    for (const char* path : FONT_PATHS)
+    {
+        if (!std::filesystem::exists(path))
+        {
+            std::printf("  %s not found, skipped\n", path);
+            continue;
+        }
+        std::printf("  %s\n", std::filesystem::path(path).filename().string().c_str());
+
+        size_t bitmapBytes = 0;
+        double bitmapMs = 0.0;
+        for (int size : BITMAP_SIZES)
+        {
+            BenchmarkTimer timer;
+            Font* font = FontCache::getFont(path, size);
+            double elapsedMs = timer.elapsedMs();
+            if (!font) continue;
+
+            bitmapBytes += atlasBytes(font);
+            bitmapMs += elapsedMs;
+            glm::ivec2 atlasSize = font->getAtlas()->getSize();
+            std::printf("    bitmap %3d px: %.2f ms, atlas %dx%d, %zu KiB\n", size, elapsedMs, atlasSize.x, atlasSize.y, atlasBytes(font) / 1024);
+        }
+        std::printf("    bitmap atlases for %zu sizes: %.2f ms, %zu KiB\n", std::size(BITMAP_SIZES), bitmapMs, bitmapBytes / 1024);
+
+        BenchmarkTimer timer;
+        Font* field = FontCache::getFont(path, DISTANCE_FIELD_SIZE, true);
+        double fieldMs = timer.elapsedMs();
+        if (field)
+        {
+            glm::ivec2 atlasSize = field->getAtlas()->getSize();
+            std::printf("    distance field %d px, any scale: %.2f ms, atlas %dx%d, %zu KiB\n",
+                DISTANCE_FIELD_SIZE, fieldMs, atlasSize.x, atlasSize.y, atlasBytes(field) / 1024);
+        }
+    }
+
+    FontCache::shutdown();
+}
@@ -0,0 +1,177 @@
+#include "Benchmark.h"
+#include "EventBus.h"
+#include "Signal.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int DISPATCH_COUNT = 5000;
+    const int EVENTS_PER_DISPATCH = 64;
+    const int CONSUMER_COUNT = 4;
+    const int THROUGHPUT_EVENTS = 1000000;
+    const int THROUGHPUT_ROUNDS = 10;
+
+    /**
+     * @struct Hit
+     * @brief A small event, like the ones gameplay publishes every frame.
+     */
+    struct Hit
+    {
+        uint32_t target;    ///< Hit object.
+        float damage;       ///< Damage dealt.
+        float x;            ///< Hit position, horizontal.
+        float y;            ///< Hit position, vertical.
+    };
+
+    /**
+     * @brief Sums the damage of a batch.
+     * @param events The events.
+     * @param count The event count.
+     * @return The total damage.
+     */
+    float sumDamage(const Hit* events, size_t count)
+    {
+        float total = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            total += events[i].damage;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Times rounds of a million events and converts them to a rate.
+     * @param round Sends `THROUGHPUT_EVENTS` events to their listeners.
+     * @return The millions of events delivered per second.
+     */
+    template <typename Round>
+    double measureThroughput(Round round)
+    {
+        round(); // Grows the queues to their steady size
+        BenchmarkTimer timer;
+        for (int i = 0; i < THROUGHPUT_ROUNDS; ++i)
+        {
+            round();
+        }
+        return THROUGHPUT_EVENTS * static_cast<double>(THROUGHPUT_ROUNDS) / (timer.elapsedNs() / 1000.0);
+    }
+}
+
+SGE_BENCHMARK(EventBusParallelDispatch)
+{
+    std::atomic<uint64_t> delivered(0);
+    for (int i = 0; i < CONSUMER_COUNT; ++i)
+    {
+        EventBus::subscribeBatch<Hit>([&delivered](const Hit* events, size_t count)
+            {
+                keepAlive(sumDamage(events, count));
+                delivered += count;
+            }, true);
+    }
+
+    BenchmarkTimer timer;
+    for (int dispatch = 0; dispatch < DISPATCH_COUNT; ++dispatch)
+    {
+        for (int i = 0; i < EVENTS_PER_DISPATCH; ++i)
+        {
+            EventBus::publish(Hit{ static_cast<uint32_t>(i), 1.0f, 0.0f, 0.0f });
+        }
+        EventBus::dispatch();
+    }
+    double busUs = timer.elapsedNs() / DISPATCH_COUNT / 1000.0;
+    EventBus::clear();
+
+    // The same batches with a thread started and joined per consumer on every dispatch, as dispatch() did before its workers were kept
+    std::vector<Hit> batch;
+    unsigned int workerCount = std::min<unsigned int>(EventBus::MAX_WORKERS, std::max(1u, std::thread::hardware_concurrency()));
+    workerCount = std::min<unsigned int>(workerCount, CONSUMER_COUNT);
+    timer.restart();
+    for (int dispatch = 0; dispatch < DISPATCH_COUNT; ++dispatch)
+    {
+        batch.clear();
+        for (int i = 0; i < EVENTS_PER_DISPATCH; ++i)
+        {
+            batch.push_back(Hit{ static_cast<uint32_t>(i), 1.0f, 0.0f, 0.0f });
+        }
+
+        std::atomic<int> next(0);
+        auto work = [&]()
+            {
+                for (int i = next++; i < CONSUMER_COUNT; i = next++)
+                {
+                    keepAlive(sumDamage(batch.data(), batch.size()));
+                    delivered += batch.size();
+                }
+            };
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < workerCount; ++i)
+        {
+            threads.emplace_back(work);
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    double spawnUs = timer.elapsedNs() / DISPATCH_COUNT / 1000.0;
+
+    std::printf("  %d parallel consumers, %d events per dispatch: persistent workers %.2f us/dispatch | threads per dispatch %.2f us/dispatch (%ju deliveries)\n",
+        CONSUMER_COUNT, EVENTS_PER_DISPATCH, busUs, spawnUs, static_cast<uintmax_t>(delivered.load()));
+}
+
+SGE_BENCHMARK(EventBusThroughputVersusSignal)
+{
+    for (int listeners : { 1, 4 })
+    {
+        float total = 0.0f;
+
+        // Direct calls, the producer runs every slot
+        Signal<const Hit&> signal;
+        for (int i = 0; i < listeners; ++i)
+        {
+            signal.connect([&total](const Hit& hit) { total += hit.damage; });
+        }
+        double signalRate = measureThroughput([&]()
+            {
+                for (int i = 0; i < THROUGHPUT_EVENTS; ++i)
+                {
+                    signal.emit(Hit{ static_cast<uint32_t>(i), 1.0f, 0.0f, 0.0f });
+                }
+            });
+
+        // Queued, then each consumer called once per event
+        auto publishAndDispatch = [&]()
+            {
+                for (int i = 0; i < THROUGHPUT_EVENTS; ++i)
+                {
+                    EventBus::publish(Hit{ static_cast<uint32_t>(i), 1.0f, 0.0f, 0.0f });
+                }
+                EventBus::dispatch();
+            };
+        for (int i = 0; i < listeners; ++i)
+        {
+            EventBus::subscribe<Hit>([&total](const Hit& hit) { total += hit.damage; });
+        }
+        double eventRate = measureThroughput(publishAndDispatch);
+        EventBus::clear();
+
+        // Queued, then each consumer called once with the whole batch
+        for (int i = 0; i < listeners; ++i)
+        {
+            EventBus::subscribeBatch<Hit>([&total](const Hit* events, size_t count) { total += sumDamage(events, count); });
+        }
+        double batchRate = measureThroughput(publishAndDispatch);
+        EventBus::clear();
+
+        keepAlive(total);
+        std::printf("  %d listener%s, %zu byte events: Signal::emit %.1f M/s | bus subscribe %.1f M/s | bus subscribeBatch %.1f M/s\n",
+            listeners, listeners == 1 ? "" : "s", sizeof(Hit), signalRate, eventRate, batchRate);
+    }
+}
@@ -0,0 +1,328 @@
+#include "Benchmark.h"
+#include "FontCache.h"
+#include "Text.h"
+#include "Renderer.h"
+#include "DynamicGeometryAllocator.h"
+#include "GameObject.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    // Relative to the working directory, like the game's own assets
+    const char* FONT_PATH = "../assets/Assets/Fonts/AtariClassic-gry3.ttf";
+    const int PIXEL_SIZE = 16;
+    const int LABEL_COUNT = 200;
+    const int FRAME_COUNT = 3;
+
+    /**
+     * @struct UnicodeFont
+     * @brief A font with non-Latin scripts, tried in order until one exists.
+     */
+    struct UnicodeFont
+    {
+        const char* path;   ///< Font file.
+        bool hasCjk;        ///< Whether it covers CJK ideographs.
+    };
+
+    const UnicodeFont UNICODE_FONTS[] = {
+        { "/usr/share/fonts/opentype/noto/NotoSansCJK-Regular.ttc", true },
+        { "C:/Windows/Fonts/msyh.ttc", true },
+        { "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf", false },
+        { "C:/Windows/Fonts/arial.ttf", false }
+    };
+
+    // Large glyphs, so the working set outgrows the biggest atlas and the cache must evict
+    const int MULTILINGUAL_PIXEL_SIZE = 128;
+    const int MULTILINGUAL_LABELS = 48;
+    const int RELABELS_PER_FRAME = 8;
+    const int CHARACTERS_PER_LABEL = 12;
+    const int MULTILINGUAL_FRAMES = 60;
+
+    /**
+     * @brief Appends a code point to a string as UTF-8.
+     * @param text The string.
+     * @param codepoint The code point, below U+10000.
+     */
+    void appendUtf8(std::string& text, uint32_t codepoint)
+    {
+        if (codepoint < 0x80)
+        {
+            text += static_cast<char>(codepoint);
+        }
+        else if (codepoint < 0x800)
+        {
+            text += static_cast<char>(0xC0 | (codepoint >> 6));
+            text += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else
+        {
+            text += static_cast<char>(0xE0 | (codepoint >> 12));
+            text += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            text += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+
+    /**
+     * @brief Gathers the code points labels are made of: Latin-1 and Extended, Greek, Cyrillic and optionally CJK.
+     * @param cjk Whether to add the first 1000 CJK ideographs.
+     * @return The code points.
+     */
+    std::vector<uint32_t> gatherCodepoints(bool cjk)
+    {
+        std::vector<uint32_t> codepoints;
+        auto addRange = [&codepoints](uint32_t first, uint32_t last)
+            {
+                for (uint32_t codepoint = first; codepoint <= last; ++codepoint)
+                {
+                    codepoints.push_back(codepoint);
+                }
+            };
+        addRange(0x00C0, 0x00FF);
+        addRange(0x0100, 0x024F);
+        addRange(0x0391, 0x03A1);
+        addRange(0x03A3, 0x03C9);
+        addRange(0x1F00, 0x1F15);
+        addRange(0x0400, 0x052F);
+        if (cjk) addRange(0x4E00, 0x4E00 + 999);
+        return codepoints;
+    }
+
+    /**
+     * @brief Builds a label from a window of code points that moves with the frame.
+     * @param codepoints The code points.
+     * @param label The label index.
+     * @param frame The frame index.
+     * @return The UTF-8 text.
+     */
+    std::string multilingualLabel(const std::vector<uint32_t>& codepoints, int label, int frame)
+    {
+        std::string text;
+        size_t start = static_cast<size_t>(frame) * 9 + static_cast<size_t>(label) * 5;
+        for (int i = 0; i < CHARACTERS_PER_LABEL; ++i)
+        {
+            appendUtf8(text, codepoints[(start + i * 3) % codepoints.size()]);
+        }
+        return text;
+    }
+
+    /**
+     * @brief Loads a font the way every Text did before the cache: its own library, face and 512x512 buffer.
+     * @param path The font file.
+     * @param pixelSize The glyph height in pixels.
+     */
+    void loadPerText(const char* path, int pixelSize)
+    {
+        const int side = 512;
+        FT_Library library;
+        if (FT_Init_FreeType(&library)) return;
+        FT_Face face;
+        if (FT_New_Face(library, path, 0, &face))
+        {
+            FT_Done_FreeType(library);
+            return;
+        }
+        FT_Set_Pixel_Sizes(face, 0, pixelSize);
+
+        std::vector<unsigned char> buffer(side * side, 0);
+        unsigned int row = 2;
+        unsigned int column = 2;
+        for (unsigned char c = 32; c < 127; ++c)
+        {
+            if (FT_Load_Char(face, c, FT_LOAD_RENDER)) continue;
+
+            const FT_Bitmap& bitmap = face->glyph->bitmap;
+            if (column + bitmap.width + 2 > side)
+            {
+                column = 2;
+                row += pixelSize + 2;
+            }
+            for (unsigned int y = 0; y < bitmap.rows && row + y < side; ++y)
+            {
+                for (unsigned int x = 0; x < bitmap.width; ++x)
+                {
+                    buffer[(row + y) * side + column + x] = bitmap.buffer[y * bitmap.pitch + x];
+                }
+            }
+            column += bitmap.width + 2;
+        }
+        keepAlive(buffer[side * 4 + 4]);
+
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    }
+}
+
+SGE_BENCHMARK(FontCacheLoadAndLayout)
+{
+    if (!std::filesystem::exists(FONT_PATH))
+    {
+        std::printf("  %s not found, run from the project's benchmarks directory\n", FONT_PATH);
+        return;
+    }
+
+    Renderer::setBackend(RendererBackend::RECORDING);
+    DynamicGeometryAllocator::init();
+
+    const int loads = 20;
+    BenchmarkTimer timer;
+    for (int i = 0; i < loads; ++i)
+    {
+        loadPerText(FONT_PATH, PIXEL_SIZE);
+    }
+    double perTextMs = timer.elapsedMs() / loads;
+
+    timer.restart();
+    Font* font = FontCache::getFont(FONT_PATH, PIXEL_SIZE);
+    double missMs = timer.elapsedMs();
+    if (!font)
+    {
+        std::printf("  Could not load %s\n", FONT_PATH);
+        DynamicGeometryAllocator::shutdown();
+        return;
+    }
+
+    const int hits = 1000;
+    timer.restart();
+    for (int i = 0; i < hits; ++i)
+    {
+        FontCache::getFont(FONT_PATH, PIXEL_SIZE);
+    }
+    double hitUs = timer.elapsedNs() / hits / 1000.0;
+
+    glm::ivec2 atlasSize = font->getAtlas()->getSize();
+    std::printf("  %d px font: per-Text load %.2f ms | cache miss %.2f ms (atlas %dx%d) | cache hit %.3f us\n",
+        PIXEL_SIZE, perTextMs, missMs, atlasSize.x, atlasSize.y, hitUs);
+    for (int i = 0; i < hits + 1; ++i)
+    {
+        FontCache::returnFont(font);
+    }
+
+    // Labels sharing one font, rendered through the same frame steps as Application::run
+    std::vector<GameObject*> labels;
+    for (int i = 0; i < LABEL_COUNT; ++i)
+    {
+        GameObject* label = GameObject::Create("Label");
+        Text* text = label->addComponent<Text>();
+        text->SetFont(FONT_PATH, PIXEL_SIZE);
+        text->setText("Score: " + std::to_string(i * 1234) + "  Lives: 3");
+        labels.push_back(label);
+    }
+
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        Renderer::beginFrame();
+        FontCache::beginFrame();
+        timer.restart();
+        for (GameObject* label : labels)
+        {
+            label->runComponentRender();
+        }
+        double renderMs = timer.elapsedMs();
+        FontCache::flush();
+        Renderer::endFrame();
+        Text::endFrame();
+
+        std::printf("  frame %d: %d labels in %.3f ms (%.2f us each), %zu fonts, %zu draws, %u vertices, %u layouts\n",
+            frame + 1, LABEL_COUNT, renderMs, renderMs * 1000.0 / LABEL_COUNT, FontCache::getFontCount(),
+            Renderer::getRecordedDraws().size(), Renderer::getStats().frameVertices, Text::getFrameLayouts());
+    }
+
+    for (GameObject* label : labels)
+    {
+        delete label;
+    }
+    FontCache::shutdown();
+    DynamicGeometryAllocator::shutdown();
+}
+
+SGE_BENCHMARK(FontCacheMultilingualRelabel)
+{
+    const UnicodeFont* unicodeFont = nullptr;
+    for (const UnicodeFont& candidate : UNICODE_FONTS)
+    {
+        if (std::filesystem::exists(candidate.path))
+        {
+            unicodeFont = &candidate;
+            break;
+        }
+    }
+    if (!unicodeFont)
+    {
+        std::printf("  No font with Greek and Cyrillic found, skipped\n");
+        return;
+    }
+
+    Renderer::setBackend(RendererBackend::RECORDING);
+    DynamicGeometryAllocator::init();
+    std::vector<uint32_t> codepoints = gatherCodepoints(unicodeFont->hasCjk);
+    std::printf("  %s at %d px, %zu code points%s\n", std::filesystem::path(unicodeFont->path).filename().string().c_str(),
+        MULTILINGUAL_PIXEL_SIZE, codepoints.size(), unicodeFont->hasCjk ? " with CJK" : ", no CJK font installed");
+
+    std::vector<GameObject*> labels;
+    std::vector<Text*> texts;
+    for (int i = 0; i < MULTILINGUAL_LABELS; ++i)
+    {
+        GameObject* label = GameObject::Create("Label");
+        Text* text = label->addComponent<Text>();
+        text->SetFont(unicodeFont->path, MULTILINGUAL_PIXEL_SIZE);
+        text->setText(multilingualLabel(codepoints, i, 0));
+        labels.push_back(label);
+        texts.push_back(text);
+    }
+
+    FontCache::resetStats();
+    GlyphCacheStats total;
+    for (int frame = 0; frame < MULTILINGUAL_FRAMES; ++frame)
+    {
+        // A few labels change each frame, as scores and dialogue would
+        if (frame > 0)
+        {
+            for (int i = 0; i < RELABELS_PER_FRAME; ++i)
+            {
+                int label = (frame * RELABELS_PER_FRAME + i) % MULTILINGUAL_LABELS;
+                texts[label]->setText(multilingualLabel(codepoints, label, frame));
+            }
+        }
+
+        GlyphCacheStats before = FontCache::getStats();
+        BenchmarkTimer timer;
+        Renderer::beginFrame();
+        FontCache::beginFrame();
+        for (GameObject* label : labels)
+        {
+            label->runComponentRender();
+        }
+        FontCache::flush();
+        Renderer::endFrame();
+        Text::endFrame();
+        double frameMs = timer.elapsedMs();
+
+        const GlyphCacheStats& after = FontCache::getStats();
+        unsigned long long lookups = after.lookups - before.lookups;
+        unsigned long long misses = after.misses - before.misses;
+        glm::ivec2 atlasSize = texts[0]->getFont() ? texts[0]->getFont()->getAtlas()->getSize() : glm::ivec2(0);
+        std::printf("  frame %2d: %5llu lookups, %6.2f%% missed, %4llu evicted, %8u bytes uploaded, atlas %dx%d, %.2f ms\n",
+            frame + 1, lookups, lookups ? 100.0 * misses / lookups : 0.0, after.evictions - before.evictions,
+            after.frameUploadedBytes, atlasSize.x, atlasSize.y, frameMs);
+        total = after;
+    }
+
+    std::printf("  total: %llu lookups, %.2f%% hit rate, %llu evictions, %.1f KB uploaded per frame\n",
+        total.lookups, total.lookups ? 100.0 - 100.0 * total.misses / total.lookups : 0.0, total.evictions,
+        total.uploadedBytes / 1024.0 / MULTILINGUAL_FRAMES);
+
+    for (GameObject* label : labels)
+    {
+        delete label;
+    }
+    FontCache::shutdown();
+    DynamicGeometryAllocator::shutdown();
+}
@@ -0,0 +1,251 @@
+#include "Benchmark.h"
+#include "SceneFrameDriver.h"
+#include "GameObjectCollection.h"
+#include "FrameAllocator.h"
+#include "MemoryTracker.h"
+#include "Renderer.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "Input.h"
+#include "EventBus.h"
+#include "FontCache.h"
+#include "Text.h"
+#include "MeshAllocater.h"
+#include "Log.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int FRAME_COUNT = 2000;
+    const int WARMUP_FRAMES = 10;
+    const int OBJECTS_PER_FRAME = 2000;
+    const int SCENE_FRAME_COUNT = 600;
+    const int BUTTON_COUNT = 100;
+    const int SPRITE_COUNT = 2000;
+
+    /**
+     * @struct ScratchContact
+     * @brief Stand-in for the small per-frame records a system gathers and throws away.
+     */
+    struct ScratchContact
+    {
+        uint32_t first;  ///< First object index.
+        uint32_t second; ///< Second object index.
+        float depth;     ///< Penetration depth.
+    };
+
+    /**
+     * @brief Simulates one frame of temporary containers, grown by push_back as the engine does.
+     * @tparam PointerVector The vector type holding object pointers.
+     * @tparam ContactVector The vector type holding contacts.
+     * @param objects The objects of the scene.
+     * @return A value depending on the containers so the work is kept.
+     */
+    template <typename PointerVector, typename ContactVector>
+    uintptr_t runFrame(const std::vector<int>& objects)
+    {
+        PointerVector pending;
+        ContactVector contacts;
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            pending.push_back(&objects[i]);
+            if (i % 4 == 0)
+            {
+                contacts.push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(i + 1), 0.5f });
+            }
+        }
+        return reinterpret_cast<uintptr_t>(pending.back()) + contacts.size();
+    }
+
+    /**
+     * @brief Runs frames and reports their cost and heap allocations.
+     * @tparam PointerVector The vector type holding object pointers.
+     * @tparam ContactVector The vector type holding contacts.
+     * @param objects The objects of the scene.
+     * @param label The name printed with the results.
+     */
+    template <typename PointerVector, typename ContactVector>
+    void measureFrames(const std::vector<int>& objects, const char* label)
+    {
+        uint64_t heapAllocations = 0;
+        double frameNs = 0.0;
+        for (int frame = 0; frame < WARMUP_FRAMES + FRAME_COUNT; ++frame)
+        {
+            MemoryTracker::beginFrame();
+            FrameAllocator::beginFrame();
+
+            // beginFrame latched the previous frame's count
+            if (frame > WARMUP_FRAMES)
+            {
+                heapAllocations += MemoryTracker::getFrameHeapAllocationCount();
+            }
+
+            BenchmarkTimer timer;
+            keepAlive(runFrame<PointerVector, ContactVector>(objects));
+            if (frame >= WARMUP_FRAMES)
+            {
+                frameNs += timer.elapsedNs();
+            }
+        }
+        MemoryTracker::beginFrame();
+        heapAllocations += MemoryTracker::getFrameHeapAllocationCount();
+
+        std::printf("  %s: %.1f us per frame, %.2f heap allocations per frame\n",
+            label, frameNs / FRAME_COUNT / 1000.0, static_cast<double>(heapAllocations) / FRAME_COUNT);
+    }
+}
+
+namespace
+{
+    /**
+     * @class MenuLikeScene
+     * @brief A steady scene of buttons with sprites over a field of sprites, like the menus and the game.
+     */
+    class MenuLikeScene : public BaseScene
+    {
+    public:
+        bool spawning = false; ///< Adds an object and destroys the previous one every update.
+
+        std::string getName() const override { return "MenuLike"; }
+
+    protected:
+        void onInitialize() override
+        {
+            for (int i = 0; i < BUTTON_COUNT; ++i)
+            {
+                GameObject* object = GameObject::Create("Button");
+                object->transform->setPosition({ static_cast<float>(i % 10) * 0.2f - 1.0f, static_cast<float>(i / 10) * 0.2f - 1.0f });
+                Button* button = object->addComponent<Button>();
+                button->setSize(1, 1);
+                button->setTransparency(0.0f);
+                SpriteRenderer* sprite = object->addComponent<SpriteRenderer>();
+                sprite->setSize(0.15f, 0.15f);
+                GameObjectCollection::add(object);
+            }
+            for (int i = 0; i < SPRITE_COUNT; ++i)
+            {
+                GameObject* object = GameObject::Create("Sprite");
+                object->transform->setPosition({ static_cast<float>(i % 50) * 0.04f - 1.0f, static_cast<float>(i / 50) * 0.05f - 1.0f });
+                SpriteRenderer* sprite = object->addComponent<SpriteRenderer>();
+                sprite->setSize(0.03f, 0.03f);
+                GameObjectCollection::add(object);
+            }
+        }
+
+        void onUpdate(float /*deltaTime*/) override
+        {
+            if (!spawning) return;
+
+            // A short-lived effect, through the collection's pending list
+            if (spawned) spawned->destroy();
+            spawned = GameObject::Create("Effect");
+            spawned->addComponent<SpriteRenderer>();
+            GameObjectCollection::add(spawned);
+        }
+
+    private:
+        GameObject* spawned = nullptr; ///< The effect added last update.
+    };
+
+    /**
+     * @brief Runs scene frames in the order Application::run does and reports their heap allocations.
+     * @param label The name printed with the results.
+     */
+    void measureSceneFrames(const char* label)
+    {
+        const float frameTime = 1.0f / 60.0f;
+        uint64_t updateAllocations = 0;
+        uint64_t renderAllocations = 0;
+        double frameNs = 0.0;
+        for (int frame = 0; frame < WARMUP_FRAMES + SCENE_FRAME_COUNT; ++frame)
+        {
+            BenchmarkTimer timer;
+            MemoryTracker::beginFrame();
+            FrameAllocator::beginFrame();
+            SceneFrameDriver::update(frameTime);
+            EventBus::dispatch();
+            MemoryTracker::beginFrame(); // Latches the update's count
+            uint64_t updateCount = MemoryTracker::getFrameHeapAllocationCount();
+
+            Renderer::beginFrame();
+            FontCache::beginFrame();
+            SceneFrameDriver::render();
+            FontCache::flush();
+            Renderer::endFrame();
+            Text::endFrame();
+            MemoryTracker::beginFrame(); // Latches the render's count
+            uint64_t renderCount = MemoryTracker::getFrameHeapAllocationCount();
+            double elapsedNs = timer.elapsedNs();
+
+            if (frame >= WARMUP_FRAMES)
+            {
+                updateAllocations += updateCount;
+                renderAllocations += renderCount;
+                frameNs += elapsedNs;
+            }
+        }
+
+        std::printf("  %s: %.3f ms per frame, %zu draws, heap allocations per frame: %.2f in update, %.2f in render\n",
+            label, frameNs / SCENE_FRAME_COUNT / 1e6, Renderer::getRecordedDraws().size(),
+            static_cast<double>(updateAllocations) / SCENE_FRAME_COUNT, static_cast<double>(renderAllocations) / SCENE_FRAME_COUNT);
+    }
+}
+
+SGE_BENCHMARK(FrameAllocatorSteadyState)
+{
+    if (!MemoryTracker::isHeapCountingCompiledIn())
+    {
+        std::printf("  SGE_COUNT_HEAP_ALLOCATIONS not defined in this build, allocation counts read 0\n");
+    }
+
+#ifndef NDEBUG
+    std::printf("  Debug build, arenas are poisoned on reset so FrameVector timings are pessimistic\n");
+#endif
+
+    std::vector<int> objects(OBJECTS_PER_FRAME);
+    FrameAllocator::init();
+
+    measureFrames<std::vector<const int*>, std::vector<ScratchContact>>(objects, "std::vector");
+    measureFrames<FrameVector<const int*>, FrameVector<ScratchContact>>(objects, "FrameVector");
+
+    std::printf("  arena peak %zu of %zu bytes, %zu overflows\n",
+        FrameAllocator::getPeakBytes(), FrameAllocator::getCapacity(), FrameAllocator::getOverflowCount());
+    FrameAllocator::shutdown();
+}
+
+SGE_BENCHMARK(FrameAllocatorSceneFrames)
+{
+    if (!MemoryTracker::isHeapCountingCompiledIn())
+    {
+        std::printf("  SGE_COUNT_HEAP_ALLOCATIONS not defined in this build, allocation counts read 0\n");
+    }
+
+    // Buttons and sprites update and draw as they do in a window, the draws are only recorded
+    Renderer::setBackend(RendererBackend::RECORDING);
+
+    // No window to read the cursor from, so it rests over the buttons. Scripted input stays on, it cannot be turned off without a window
+    InputFrame input;
+    input.mousePosition = { 300.0f, 300.0f };
+    Input::setScripted(true);
+    Input::pushFrame(input);
+    FrameAllocator::init();
+    MenuLikeScene* scene = SceneStateMachine::addScene<MenuLikeScene>();
+    Log::setLevel(LogLevel::WARN);
+    SceneStateMachine::loadScene("MenuLike");
+
+    std::printf("  %d buttons with sprites, %d sprites\n", BUTTON_COUNT, SPRITE_COUNT);
+    measureSceneFrames("steady");
+    scene->spawning = true;
+    measureSceneFrames("one object added and one destroyed per frame");
+
+    SceneFrameDriver::dispose();
+    Log::setLevel(LogLevel::TRACE);
+    MeshAllocator::releaseUnusedMeshes();
+    std::printf("  arena peak %zu of %zu bytes, %zu overflows\n",
+        FrameAllocator::getPeakBytes(), FrameAllocator::getCapacity(), FrameAllocator::getOverflowCount());
+    FrameAllocator::shutdown();
+}
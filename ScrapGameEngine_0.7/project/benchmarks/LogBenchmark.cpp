@@ -0,0 +1,97 @@
+#include "Benchmark.h"
+#include "Log.h"
+#include <cstdio>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int PRODUCER_COUNT = 4;
+    const int BURST_SIZE = 1000;   // Per producer, so a burst fits the 4096 record queue
+    const int BURST_COUNT = 200;
+    const int FILTERED_COUNT = 10000000;
+
+    /**
+     * @class NullBuffer
+     * @brief Stream buffer discarding everything, so the writer still formats but the terminal is not flooded.
+     */
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    /**
+     * @brief Logs a burst of messages from one producer thread.
+     * @param producer The producer index, logged with each message.
+     * @param burst The burst index, logged with each message.
+     * @return The time spent in the log calls in nanoseconds.
+     */
+    double logBurst(int producer, int burst)
+    {
+        BenchmarkTimer timer;
+        for (int i = 0; i < BURST_SIZE; ++i)
+        {
+            // A limiter per message, a shared one would throttle the site to SGE_LOG_RATE_LIMIT per second
+            LogRateLimiter limiter;
+            Log::write(limiter, LogLevel::INFO, LogCategory::GAME, "Producer {} burst {} message {} of {}", producer, burst, i, "benchmark");
+        }
+        return timer.elapsedNs();
+    }
+}
+
+SGE_BENCHMARK(LogThroughput)
+{
+    // A site below the runtime level returns before touching the limiter or the queue
+    Log::setLevel(LogLevel::ERR);
+    BenchmarkTimer timer;
+    for (int i = 0; i < FILTERED_COUNT; ++i)
+    {
+        SGE_LOG_INFO(GAME, "Filtered {}", i);
+    }
+    double filtered = timer.elapsedNs() / FILTERED_COUNT;
+    Log::setLevel(LogLevel::TRACE);
+
+    NullBuffer nullBuffer;
+    std::streambuf* previousOut = std::cout.rdbuf(&nullBuffer);
+    std::streambuf* previousErr = std::cerr.rdbuf(&nullBuffer);
+
+    uint64_t droppedBefore = Log::getDroppedCount();
+    double callerNs = 0.0;
+    double drainMs = 0.0;
+    std::vector<double> producerNs(PRODUCER_COUNT);
+    for (int burst = 0; burst < BURST_COUNT; ++burst)
+    {
+        timer.restart();
+        std::vector<std::thread> producers;
+        for (int p = 0; p < PRODUCER_COUNT; ++p)
+        {
+            producers.emplace_back([&producerNs, p, burst] { producerNs[p] = logBurst(p, burst); });
+        }
+        for (std::thread& producer : producers)
+        {
+            producer.join();
+        }
+        Log::flush();
+        drainMs += timer.elapsedMs();
+
+        for (double ns : producerNs)
+        {
+            callerNs += ns;
+        }
+    }
+    uint64_t dropped = Log::getDroppedCount() - droppedBefore;
+
+    std::cout.rdbuf(previousOut);
+    std::cerr.rdbuf(previousErr);
+
+    const double messages = static_cast<double>(PRODUCER_COUNT) * BURST_SIZE * BURST_COUNT;
+    std::printf("  filtered by runtime level: %.2f ns per site\n", filtered);
+    std::printf("  %d producers, %d bursts of %d: %.1f ns per message in the caller, %.1f ms to write all, %llu dropped\n",
+        PRODUCER_COUNT, BURST_COUNT, BURST_SIZE, callerNs / messages, drainMs, static_cast<unsigned long long>(dropped));
+}
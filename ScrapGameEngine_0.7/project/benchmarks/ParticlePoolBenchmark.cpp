@@ -0,0 +1,81 @@
+#include "Benchmark.h"
+#include "ParticlePool.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const size_t PARTICLE_COUNT = 1000000;
+    const int FRAME_COUNT = 200;
+    const float FRAME_TIME = 1.0f / 60.0f;
+    const glm::vec2 GRAVITY = { 0.0f, -1.0f };
+    const float DRAG = 0.1f;
+
+    /**
+     * @brief A xorshift generator, so every run spawns the same particles.
+     */
+    struct Random
+    {
+        uint32_t state = 12345; ///< Generator state.
+
+        /**
+         * @brief Gets the next value.
+         * @return A value in [0, 1).
+         */
+        float next()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return (state >> 8) * (1.0f / 16777216.0f);
+        }
+    };
+
+    /**
+     * @brief Spawns particles with lifetimes between 0.5 and 4.5 seconds until the pool is full.
+     * @param pool The pool.
+     * @param random The generator.
+     */
+    void fill(ParticlePool& pool, Random& random)
+    {
+        while (pool.spawn({ 0.0f, 0.0f }, { random.next() - 0.5f, random.next() }, 0.5f + random.next() * 4.0f,
+            { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f, 0.0f, 0.0f }, 0.05f, 0.0f))
+        {
+        }
+    }
+}
+
+SGE_BENCHMARK(ParticlePool1M)
+{
+    ParticlePool pool(PARTICLE_COUNT);
+    Random random;
+    fill(pool, random);
+
+    // Refilled every frame, so each step runs over a full pool with a few thousand deaths
+    double simulateNs = 0.0;
+    size_t processed = 0;
+    size_t removed = 0;
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        fill(pool, random);
+        processed += pool.getCount();
+        BenchmarkTimer timer;
+        pool.integrate(FRAME_TIME, GRAVITY, DRAG);
+        removed += pool.compact();
+        simulateNs += timer.elapsedNs();
+    }
+
+    std::vector<ColorVertex> vertices(pool.getCount() * 6);
+    BenchmarkTimer timer;
+    size_t written = pool.writeQuads(vertices.data());
+    double quadsNs = timer.elapsedNs();
+    keepAlive(written);
+
+    std::printf("  %zu particles, %d frames, %s kernels: integrate + compact %.2f ns/particle (%.2f ms/frame, %.0f removed/frame) | writeQuads %.2f ns/particle\n",
+        PARTICLE_COUNT, FRAME_COUNT, ParticlePool::isSimdCompiledIn() ? "SSE2" : "scalar",
+        simulateNs / processed, simulateNs / FRAME_COUNT / 1e6, static_cast<double>(removed) / FRAME_COUNT,
+        quadsNs / pool.getCount());
+}
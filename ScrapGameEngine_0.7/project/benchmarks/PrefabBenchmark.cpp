@@ -0,0 +1,117 @@
+#include "Benchmark.h"
+#include "Prefab.h"
+#include "Renderer.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "TweenComponent.h"
+#include "MeshAllocater.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int OBJECT_COUNT = 20000;
+    const int ROUND_COUNT = 3;
+    const int COLUMNS = 100;
+
+    /**
+     * @brief Describes a pad-like object: a transparent button, a sprite and a tween.
+     * @param prefab The prefab to fill.
+     */
+    void setupPad(Prefab& prefab)
+    {
+        prefab.setTransform({ 0.0f, 0.0f }, 0.0f, { 0.0f, 0.0f });
+        prefab.addButton().transparency = 0.0f;
+        SceneSpriteRecord& sprite = prefab.addSprite();
+        sprite.size[0] = 0.3f;
+        sprite.size[1] = 0.3f;
+        prefab.addTween();
+    }
+
+    /**
+     * @brief Builds the same objects one component at a time, as scenes did before prefabs.
+     * @param count The number of objects.
+     * @param out Receives the objects.
+     */
+    void buildByHand(int count, std::vector<GameObject*>& out)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            GameObject* object = GameObject::Create("Pad" + std::to_string(i));
+            object->transform->setScale({ 0.0f, 0.0f });
+            Button* button = object->addComponent<Button>();
+            SpriteRenderer* sprite = object->addComponent<SpriteRenderer>();
+            object->addComponent<TweenComponent>();
+            button->setSize(1, 1);
+            button->setTransparency(0.0f);
+            sprite->awake();
+            sprite->setSize(0.3f, 0.3f);
+            object->transform->setPosition({ static_cast<float>(i % COLUMNS), static_cast<float>(i / COLUMNS) });
+            out.push_back(object);
+        }
+    }
+
+    /**
+     * @brief Deletes objects.
+     * @param objects The objects, cleared.
+     */
+    void destroy(std::vector<GameObject*>& objects)
+    {
+        for (GameObject* object : objects)
+        {
+            delete object;
+        }
+        objects.clear();
+    }
+}
+
+SGE_BENCHMARK(PrefabInstantiate20k)
+{
+    // Meshes are created without GPU buffers, so only the CPU side is measured
+    Renderer::setBackend(RendererBackend::RECORDING);
+
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        std::vector<GameObject*> objects;
+        objects.reserve(OBJECT_COUNT);
+
+        BenchmarkTimer timer;
+        buildByHand(OBJECT_COUNT, objects);
+        double handMs = timer.elapsedMs();
+        destroy(objects);
+
+        Prefab bulk("Pad");
+        setupPad(bulk);
+        timer.restart();
+        bulk.instantiate(OBJECT_COUNT, objects);
+        double bulkMs = timer.elapsedMs();
+        destroy(objects);
+
+        Prefab pad("Pad");
+        setupPad(pad);
+        timer.restart();
+        std::vector<PrefabOverrides> overrides;
+        overrides.reserve(OBJECT_COUNT);
+        for (int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            overrides.emplace_back(pad);
+            PrefabOverrides& pending = overrides.back();
+            pending.setName("Pad" + std::to_string(i));
+            pending.setPosition({ static_cast<float>(i % COLUMNS), static_cast<float>(i / COLUMNS) });
+            pending.editSprite().opacity = (i % 2) ? 1.0f : 0.5f;
+        }
+        double buildMs = timer.elapsedMs();
+        timer.restart();
+        pad.instantiate(overrides, objects);
+        double overrideMs = timer.elapsedMs();
+        destroy(objects);
+
+        std::printf("  %d objects: hand-written %.1f ms | prefab with overrides %.1f ms (+%.1f ms building them) | identical bulk %.1f ms\n",
+            OBJECT_COUNT, handMs, overrideMs, buildMs, bulkMs);
+    }
+
+    MeshAllocator::releaseUnusedMeshes();
+}
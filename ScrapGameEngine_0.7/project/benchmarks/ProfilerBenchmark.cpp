@@ -0,0 +1,55 @@
+#include "Benchmark.h"
+#include "Profiler.h"
+#include <cstdint>
+#include <cstdio>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int ZONE_COUNT = 10000000;
+
+    // Stand-in for the body of an instrumented function, each step depends on the last
+    inline uint32_t step(uint32_t state)
+    {
+        return state * 1664525u + 1013904223u;
+    }
+}
+
+SGE_BENCHMARK(ProfilerZoneOverhead)
+{
+    std::printf("  SGE_ENABLE_PROFILER %s in this build\n", Profiler::isCompiledIn() ? "defined" : "not defined");
+
+    uint32_t state = 1;
+    BenchmarkTimer timer;
+    for (int i = 0; i < ZONE_COUNT; ++i)
+    {
+        state = step(state);
+    }
+    keepAlive(state);
+    double baseline = timer.elapsedNs() / ZONE_COUNT;
+
+    // Expands to nothing without SGE_ENABLE_PROFILER, so this must match the baseline
+    timer.restart();
+    for (int i = 0; i < ZONE_COUNT; ++i)
+    {
+        SGE_PROFILE_SCOPE("Benchmark");
+        state = step(state);
+    }
+    keepAlive(state);
+    double macro = timer.elapsedNs() / ZONE_COUNT;
+
+    // What every zone costs when the profiler is compiled in
+    timer.restart();
+    for (int i = 0; i < ZONE_COUNT; ++i)
+    {
+        ProfileZone zone("Benchmark");
+        state = step(state);
+    }
+    keepAlive(state);
+    double recorded = timer.elapsedNs() / ZONE_COUNT;
+    Profiler::clear();
+
+    std::printf("  %d zones, ns per zone: no zone %.2f | SGE_PROFILE_SCOPE %.2f | recorded zone %.2f\n",
+        ZONE_COUNT, baseline, macro, recorded);
+}
@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+#include "Hash.h"
+#include "ResourceAllocator.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int RESOURCE_COUNT = 10000;
+    const int ROUND_COUNT = 100;
+
+    /**
+     * @struct ChurnResource
+     * @brief Small resource, so the benchmark measures the cache rather than loading.
+     */
+    struct ChurnResource
+    {
+        int value; ///< Payload.
+        explicit ChurnResource(int value) : value(value) {}
+    };
+}
+
+SGE_BENCHMARK(ResourceAllocatorChurn)
+{
+    std::vector<AssetId> keys;
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+    {
+        keys.push_back(Hash::xxh64("textures/resource_" + std::to_string(i) + ".png"));
+    }
+
+    ResourceAllocator<ChurnResource> allocator;
+    std::vector<ResourceHandle<ChurnResource>> handles(RESOURCE_COUNT);
+    for (int i = 0; i < RESOURCE_COUNT; ++i)
+    {
+        handles[i] = allocator.acquire(keys[i], i);
+    }
+
+    // Release everything and acquire it again before it expires, as a scene reload does
+    BenchmarkTimer timer;
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        for (ResourceHandle<ChurnResource>& handle : handles)
+        {
+            allocator.release(handle);
+        }
+        for (int i = 0; i < RESOURCE_COUNT; ++i)
+        {
+            handles[i] = allocator.acquire(keys[i], i);
+        }
+        allocator.collect();
+    }
+    double churn = timer.elapsedNs() / (2.0 * RESOURCE_COUNT * ROUND_COUNT);
+
+    // Handle operations never touch the key map
+    timer.restart();
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        for (ResourceHandle<ChurnResource>& handle : handles)
+        {
+            allocator.retain(handle);
+        }
+        for (ResourceHandle<ChurnResource>& handle : handles)
+        {
+            allocator.release(handle);
+        }
+    }
+    double retainRelease = timer.elapsedNs() / (2.0 * RESOURCE_COUNT * ROUND_COUNT);
+
+    // Full turnover: everything is collected and loaded into reused slots
+    timer.restart();
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        for (ResourceHandle<ChurnResource>& handle : handles)
+        {
+            allocator.release(handle);
+        }
+        allocator.collect(true);
+        for (int i = 0; i < RESOURCE_COUNT; ++i)
+        {
+            handles[i] = allocator.acquire(keys[i], i);
+        }
+    }
+    double turnover = timer.elapsedNs() / (2.0 * RESOURCE_COUNT * ROUND_COUNT);
+
+    const ResourceCacheStats& stats = allocator.getStats();
+    std::printf("  %d resources, ns per operation: cached release/acquire %.1f | handle retain/release %.1f | collect and reload %.1f\n",
+        RESOURCE_COUNT, churn, retainRelease, turnover);
+    std::printf("  %llu hits, %llu misses, %llu collisions, %zu resident\n",
+        static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+        static_cast<unsigned long long>(stats.collisions), allocator.getResourceCount());
+
+    for (ResourceHandle<ChurnResource>& handle : handles)
+    {
+        allocator.release(handle);
+    }
+    allocator.collect(true);
+}
@@ -0,0 +1,86 @@
+#include "Benchmark.h"
+#include "SceneFile.h"
+#include "SceneWriter.h"
+#include "SpriteRenderer.h"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int OBJECT_COUNT = 100000;
+    const int RUN_COUNT = 3;
+    const int COLUMNS = 300;
+
+    /**
+     * @brief Deletes the objects of an instance and returns its texture references.
+     * @param instance The instance.
+     */
+    void destroy(SceneInstance& instance)
+    {
+        for (GameObject* object : instance.objects)
+        {
+            delete object;
+        }
+        instance.objects.clear();
+        SceneFile::release(instance);
+    }
+}
+
+SGE_BENCHMARK(SceneFileLoad100k)
+{
+    // Sprites carry no texture, the benchmark runs without a GL context
+    std::string path = (std::filesystem::temp_directory_path() / "sge_benchmark_100k.sgescene").generic_string();
+    BenchmarkTimer timer;
+    {
+        SceneWriter writer;
+        for (int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            uint32_t object = writer.addObject("Object" + std::to_string(i), { static_cast<float>(i % COLUMNS), static_cast<float>(i / COLUMNS) });
+            writer.addSprite(object, "", TextureConfig()).size[0] = 0.5f;
+        }
+        if (!writer.write(path))
+        {
+            std::printf("  Could not write %s\n", path.c_str());
+            return;
+        }
+    }
+    std::printf("  write %d objects: %.1f ms, %ju bytes\n", OBJECT_COUNT, timer.elapsedMs(), static_cast<uintmax_t>(std::filesystem::file_size(path)));
+
+    for (int run = 0; run < RUN_COUNT; ++run)
+    {
+        timer.restart();
+        SceneFile file;
+        file.open(path);
+        double openMs = timer.elapsedMs();
+        SceneInstance instance;
+        file.instantiate(instance, false);
+        double loadMs = timer.elapsedMs();
+        destroy(instance);
+
+        // The same objects built by code, as scenes did before scene files
+        timer.restart();
+        std::vector<GameObject*> objects;
+        objects.reserve(OBJECT_COUNT);
+        for (int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            GameObject* object = GameObject::Create("Object" + std::to_string(i));
+            object->transform->setPosition({ static_cast<float>(i % COLUMNS), static_cast<float>(i / COLUMNS) });
+            object->addComponent<SpriteRenderer>()->setSize(0.5f, 1.0f);
+            objects.push_back(object);
+        }
+        double codeMs = timer.elapsedMs();
+        for (GameObject* object : objects)
+        {
+            delete object;
+        }
+
+        std::printf("  run %d: open and validate %.2f ms, open and instantiate %.1f ms, hand-written code %.1f ms\n",
+            run + 1, openMs, loadMs, codeMs);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "SceneStateMachine.h"
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class SceneFrameDriver
+     * @brief Runs the scene steps of Application::run for benchmarks, which have no window or Application.
+     */
+    class SceneFrameDriver
+    {
+    public:
+        SceneFrameDriver() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Updates the scene state machine and the current scene.
+         * @param deltaTime The time since the last frame, in seconds.
+         */
+        static void update(float deltaTime) { SceneStateMachine::update(deltaTime); }
+
+        /**
+         * @brief Renders the current scene.
+         */
+        static void render() { SceneStateMachine::render(); }
+
+        /**
+         * @brief Deactivates every scene and deletes them.
+         */
+        static void dispose() { SceneStateMachine::dispose(); }
+    };
+}
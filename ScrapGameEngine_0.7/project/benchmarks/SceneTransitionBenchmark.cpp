@@ -0,0 +1,209 @@
+#include "Benchmark.h"
+#include "SceneFrameDriver.h"
+#include "SceneLoader.h"
+#include "SceneManifest.h"
+#include "TextureAllocator.h"
+#include "Texture2D.h"
+#include "SpriteRenderer.h"
+#include "Renderer.h"
+#include "MeshAllocater.h"
+#include "Log.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int SPRITE_COUNT = 2000;
+    const int ROUND_COUNT = 10;
+    const int MAX_PREPARE_FRAMES = 600;
+    const float FRAME_TIME = 1.0f / 60.0f;
+    const char* TEXTURE_PATHS[] = {
+        "../assets/Assets/Game/Game_Tutorial.png",
+        "../assets/Assets/Game/MusicPad0.png",
+        "../assets/Assets/Game/MusicPad1.png",
+        "../assets/Assets/Game/MusicPad2.png",
+        "../assets/Assets/Game/MusicPad3.png",
+        "../assets/Assets/Game/MusicPad4.png",
+        "../assets/Assets/Game/MusicPad5.png",
+        "../assets/Assets/LoadBG.png",
+        "../assets/Assets/LoadBar.png",
+    };
+
+    /**
+     * @brief The configuration every texture of the arena is loaded with.
+     * @return The configuration.
+     */
+    TextureConfig arenaTextureConfig()
+    {
+        TextureConfig cfg{};
+        cfg.filterMode = TextureFilterMode::LINEAR;
+        cfg.generateMipmaps = false;
+        return cfg;
+    }
+
+    /**
+     * @class HubScene
+     * @brief A nearly empty scene the benchmark leaves the arena for.
+     */
+    class HubScene : public BaseScene
+    {
+    public:
+        std::string getName() const override { return "Hub"; }
+    protected:
+        void onInitialize() override { GameObject::Create("Hub"); }
+    };
+
+    /**
+     * @class ArenaScene
+     * @brief A game-sized scene: its textures and a few thousand sprites using them.
+     */
+    class ArenaScene : public BaseScene
+    {
+    public:
+        std::string getName() const override { return "Arena"; }
+
+        void declareAssets(SceneManifest& manifest) const override
+        {
+            for (const char* path : TEXTURE_PATHS)
+            {
+                manifest.addTexture(path, arenaTextureConfig());
+            }
+        }
+
+    protected:
+        void onInitialize() override
+        {
+            TextureConfig cfg = arenaTextureConfig();
+            for (const char* path : TEXTURE_PATHS)
+            {
+                std::string texturePath = path;
+                textures.push_back(TextureAllocator::getTexture(texturePath, cfg));
+            }
+
+            for (int i = 0; i < SPRITE_COUNT; ++i)
+            {
+                GameObject* object = GameObject::Create("Sprite");
+                object->transform->setPosition({ static_cast<float>(i % 50) * 0.04f - 1.0f, static_cast<float>(i / 50) * 0.05f - 1.0f });
+                SpriteRenderer* sprite = object->addComponent<SpriteRenderer>();
+                sprite->awake();
+                sprite->setSize(0.04f, 0.04f);
+                sprite->setTexture(textures[i % textures.size()]);
+            }
+        }
+
+        void onDeactivate() override
+        {
+            for (Texture2D* texture : textures)
+            {
+                TextureAllocator::returnTexture(texture);
+            }
+            textures.clear();
+            TextureAllocator::releaseUnusedTextures();
+        }
+
+    private:
+        std::vector<Texture2D*> textures; ///< Textures held while initialized.
+    };
+
+    /**
+     * @brief Times decoding the arena's textures, the part of a cold switch the recording backend skips.
+     * @return The milliseconds spent.
+     */
+    double timeDecodes()
+    {
+        BenchmarkTimer timer;
+        for (const char* path : TEXTURE_PATHS)
+        {
+            TextureData data;
+            Texture2D::decodeFile(path, data);
+            keepAlive(data.getByteSize());
+        }
+        return timer.elapsedMs();
+    }
+
+    /**
+     * @brief Times one switch to a scene.
+     * @param name The scene.
+     * @return The milliseconds loadScene took.
+     */
+    double timeSwitch(const std::string& name)
+    {
+        BenchmarkTimer timer;
+        SceneStateMachine::loadScene(name);
+        return timer.elapsedMs();
+    }
+}
+
+SGE_BENCHMARK(SceneTransitionColdVersusResident)
+{
+    // Headless textures only read their headers, so the decodes a GPU build does during a cold switch are timed on their own
+    Renderer::setBackend(RendererBackend::RECORDING);
+    SceneStateMachine::addScene<HubScene>();
+    SceneStateMachine::addScene<ArenaScene>();
+
+    // Keep a switch log line per round out of the report
+    Log::setLevel(LogLevel::WARN);
+    SceneStateMachine::loadScene("Hub");
+
+    // Cold: nothing is kept, every visit initializes the arena again
+    SceneStateMachine::setResidentBudget(0);
+    double coldMs = 0.0;
+    double decodeMs = 0.0;
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        coldMs += timeSwitch("Arena");
+        decodeMs += timeDecodes();
+        SceneStateMachine::loadScene("Hub");
+        SceneFrameDriver::update(FRAME_TIME); // Deactivates the arena, over the budget
+    }
+
+    // Prepared: preloaded and initialized over earlier frames while the hub runs, then swapped in
+    double preparedMs = 0.0;
+    double prepareFrames = 0.0;
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        SceneStateMachine::prepareScene("Arena");
+        int frames = 0;
+        while (!SceneStateMachine::isSceneReady("Arena") && frames < MAX_PREPARE_FRAMES)
+        {
+            SceneLoader::update();
+            SceneFrameDriver::update(FRAME_TIME);
+            frames++;
+
+            // The rest of the frame, which the loader's workers get on a machine with few cores
+            std::this_thread::sleep_for(std::chrono::duration<float>(FRAME_TIME));
+        }
+        prepareFrames += frames;
+        preparedMs += timeSwitch("Arena");
+        SceneStateMachine::loadScene("Hub");
+        SceneFrameDriver::update(FRAME_TIME);
+    }
+
+    // Resident: the arena was left with room in the budget, so returning swaps its objects back
+    SceneStateMachine::setResidentBudget(UINT64_MAX);
+    SceneStateMachine::loadScene("Arena");
+    SceneStateMachine::loadScene("Hub");
+    double residentMs = 0.0;
+    for (int round = 0; round < ROUND_COUNT; ++round)
+    {
+        residentMs += timeSwitch("Arena");
+        SceneStateMachine::loadScene("Hub");
+        SceneFrameDriver::update(FRAME_TIME);
+    }
+
+    SceneLoader::finish();
+    SceneFrameDriver::dispose();
+    Log::setLevel(LogLevel::TRACE);
+    MeshAllocator::releaseUnusedMeshes();
+
+    std::printf("  %d sprites, %zu textures, loadScene: cold %.3f ms + %.3f ms of texture decodes | prepared %.1f us (after %.1f frames of preparation) | resident %.1f us\n",
+        SPRITE_COUNT, std::size(TEXTURE_PATHS), coldMs / ROUND_COUNT, decodeMs / ROUND_COUNT, preparedMs / ROUND_COUNT * 1000.0,
+        prepareFrames / ROUND_COUNT, residentMs / ROUND_COUNT * 1000.0);
+}
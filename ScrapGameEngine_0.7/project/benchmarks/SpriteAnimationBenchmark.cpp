@@ -0,0 +1,99 @@
+#include "Benchmark.h"
+#include "SpriteAnimationSystem.h"
+#include "SpriteRenderer.h"
+#include "Renderer.h"
+#include "MemoryTracker.h"
+#include "MeshAllocater.h"
+#include "Log.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int SPRITE_COUNT = 50000;
+    const int FRAME_COUNT = 600;
+    const int WARMUP_FRAMES = 30;
+    const float FRAME_TIME = 1.0f / 60.0f;
+}
+
+SGE_BENCHMARK(SpriteAnimation50k)
+{
+    if (!MemoryTracker::isHeapCountingCompiledIn())
+    {
+        std::printf("  SGE_COUNT_HEAP_ALLOCATIONS not defined in this build, allocation counts read 0\n");
+    }
+
+    // Sprites get their quad without GPU buffers, only the CPU side is measured
+    Renderer::setBackend(RendererBackend::RECORDING);
+
+    // Cells of one 8x8 sheet, with a footstep event in every clip
+    AnimationClip walk = AnimationClip::fromGrid("Walk", 8, 8, 0, 8, 1.0f / 12.0f, AnimationLoopMode::LOOP);
+    walk.addEvent(2, "Step");
+    walk.addEvent(6, "Step");
+    AnimationClip idle = AnimationClip::fromGrid("Idle", 8, 8, 8, 6, 1.0f / 8.0f, AnimationLoopMode::PING_PONG);
+    idle.addEvent(5, "Blink");
+    AnimationClip attack = AnimationClip::fromGrid("Attack", 8, 8, 16, 5, 1.0f / 15.0f, AnimationLoopMode::ONCE);
+    attack.addEvent(3, "Hit");
+    const AnimationClip* clips[] = { &walk, &idle, &attack };
+
+    uint64_t eventCount = 0;
+    uint64_t completionCount = 0;
+    std::vector<GameObject*> objects;
+    objects.reserve(SPRITE_COUNT);
+    for (int i = 0; i < SPRITE_COUNT; ++i)
+    {
+        GameObject* object = GameObject::Create("Animated");
+        object->addComponent<SpriteRenderer>()->awake();
+        SpriteAnimator* animator = object->addComponent<SpriteAnimator>();
+        animator->setEventCallback([&eventCount](const std::string&) { eventCount++; });
+
+        // ONCE clips start over when they end, so every frame has completions
+        const AnimationClip* clip = clips[i % 3];
+        if (clip->getLoopMode() == AnimationLoopMode::ONCE)
+        {
+            animator->setOnComplete([animator, &completionCount]()
+                {
+                    completionCount++;
+                    animator->play(animator->getClip(), true);
+                });
+        }
+        animator->setSpeed(0.75f + (i % 8) * 0.0625f);
+        animator->play(clip);
+        objects.push_back(object);
+    }
+
+    uint64_t heapAllocations = 0;
+    double updateNs = 0.0;
+    for (int frame = 0; frame < WARMUP_FRAMES + FRAME_COUNT; ++frame)
+    {
+        MemoryTracker::beginFrame();
+        BenchmarkTimer timer;
+        SpriteAnimationSystem::update(FRAME_TIME);
+        double elapsedNs = timer.elapsedNs();
+        MemoryTracker::beginFrame();
+
+        if (frame >= WARMUP_FRAMES)
+        {
+            updateNs += elapsedNs;
+            heapAllocations += MemoryTracker::getFrameHeapAllocationCount();
+        }
+    }
+
+    std::printf("  %d sprites (%zu animating): %.3f ms/frame, %.2f heap allocations per frame, %.0f events and %.0f completions per frame\n",
+        SPRITE_COUNT, SpriteAnimationSystem::getActiveCount(), updateNs / FRAME_COUNT / 1e6,
+        static_cast<double>(heapAllocations) / FRAME_COUNT, static_cast<double>(eventCount) / (WARMUP_FRAMES + FRAME_COUNT),
+        static_cast<double>(completionCount) / (WARMUP_FRAMES + FRAME_COUNT));
+
+    // Keep 50k deletion messages out of the report
+    Log::setLevel(LogLevel::WARN);
+    for (GameObject* object : objects)
+    {
+        delete object;
+    }
+    Log::setLevel(LogLevel::TRACE);
+    MeshAllocator::releaseUnusedMeshes();
+}
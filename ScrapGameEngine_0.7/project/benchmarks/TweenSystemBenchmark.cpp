@@ -0,0 +1,123 @@
+#include "Benchmark.h"
+#include "GameObject.h"
+#include "TweenSystem.h"
+#include "Log.h"
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int OBJECT_COUNT = 100000;
+    const int FRAME_COUNT = 300;
+    const float FRAME_TIME = 1.0f / 60.0f;
+    const EasingType CURVES[] = { EasingType::EASE_IN, EasingType::EASE_IN_OUT, EasingType::EASE_IN_ELASTIC };
+
+    /**
+     * @brief A tween as TweenComponent stored it before TweenSystem: one per component, eased through a std::function.
+     */
+    struct PerComponentTween
+    {
+        glm::vec3 start;                    ///< Start value.
+        glm::vec3 end;                      ///< End value.
+        float duration;                     ///< Duration in seconds.
+        float elapsed;                      ///< Elapsed time in seconds.
+        std::function<float(float)> easing; ///< Easing curve.
+        bool playing;                       ///< Whether the tween still runs.
+        GameObject* object;                 ///< Animated object.
+        bool rotation;                      ///< Whether the tween drives rotation rather than position.
+    };
+
+    /**
+     * @brief Gets the old std::function form of one of the benchmark's curves.
+     * @param index The curve index, wrapped.
+     * @return The easing function.
+     */
+    std::function<float(float)> perComponentEasing(int index)
+    {
+        switch (index % 3)
+        {
+        case 0:
+            return [](float t) { return t * t; };
+        case 1:
+            return [](float t) { return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t; };
+        default:
+            return [](float t)
+            {
+                const float period = 0.3f;
+                t -= 1.0f;
+                return -std::pow(2.0f, 10.0f * t) * std::sin((t - period / 4.0f) * 6.2831853f / period);
+            };
+        }
+    }
+}
+
+SGE_BENCHMARK(TweenSystem200k)
+{
+    std::vector<GameObject*> objects;
+    objects.reserve(OBJECT_COUNT);
+    for (int i = 0; i < OBJECT_COUNT; ++i)
+    {
+        objects.push_back(GameObject::Create("Tweened"));
+    }
+
+    // Two tweens per object on mixed curves, with staggered durations so batches shrink as tweens finish
+    int completed = 0;
+    for (int i = 0; i < OBJECT_COUNT; ++i)
+    {
+        TweenSystem::start(objects[i], TweenType::POSITION, { 1.0f, 2.0f, 0.0f, 0.0f }, 1.0f + (i % 100) * 0.05f,
+            CURVES[i % 3], [&completed]() { completed++; });
+        TweenSystem::start(objects[i], TweenType::ROTATION, { 90.0f, 0.0f, 0.0f, 0.0f }, 2.0f, CURVES[(i + 1) % 3]);
+    }
+    size_t started = TweenSystem::getActiveCount();
+
+    BenchmarkTimer timer;
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        TweenSystem::update(FRAME_TIME);
+    }
+    double systemMs = timer.elapsedMs() / FRAME_COUNT;
+    keepAlive(completed);
+
+    std::vector<PerComponentTween> tweens(2 * OBJECT_COUNT);
+    for (int i = 0; i < 2 * OBJECT_COUNT; ++i)
+    {
+        tweens[i] = { glm::vec3(0.0f), glm::vec3(1.0f, 2.0f, 0.0f), 1.0f + (i % 100) * 0.05f, 0.0f,
+            perComponentEasing(i), true, objects[i / 2], (i & 1) != 0 };
+    }
+
+    timer.restart();
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        for (PerComponentTween& tween : tweens)
+        {
+            if (!tween.playing) continue;
+
+            tween.elapsed += FRAME_TIME;
+            if (tween.elapsed >= tween.duration)
+            {
+                tween.playing = false;
+                continue;
+            }
+            glm::vec3 current = glm::mix(tween.start, tween.end, tween.easing(tween.elapsed / tween.duration));
+            if (tween.rotation) tween.object->transform->setRotation(current.y);
+            else tween.object->transform->setPosition(current);
+        }
+    }
+    double componentMs = timer.elapsedMs() / FRAME_COUNT;
+
+    std::printf("  %zu tweens, %d frames: TweenSystem %.3f ms/frame (%d completed) | per-component std::function %.3f ms/frame\n",
+        started, FRAME_COUNT, systemMs, completed, componentMs);
+
+    // Keep 100k deletion messages out of the report
+    Log::setLevel(LogLevel::WARN);
+    for (GameObject* object : objects)
+    {
+        delete object;
+    }
+    Log::setLevel(LogLevel::TRACE);
+    TweenSystem::clear();
+}
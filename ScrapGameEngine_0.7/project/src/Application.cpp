@@ -1,150 +1,380 @@
-#include <glad/glad.h>
-#include "Renderer.h"
-#include "Camera.h"
-#include "Input.h"
-#include "Time.h"
-#include "AppWindow.h"
-#include "SceneStateMachine.h"
-#include "MainMenuScene.h"
-#include <iostream>
-#include "TextureAllocator.h"
-#include "MeshAllocater.h"
-#include "Application.h"
-
-using namespace ScrapGameEngine;
-
-// Application variables ========
-float x = 0;
-float y = 0;
-bool isRunning = true;
-
-float currentTime = 0.0f;
-float prevTime = 0.0f;
-float deltaTime = 0.0f;
-
-unsigned int targetFrameRate = 0;
-float frameTime = 0.0f;
-
-Application* Application::instance = nullptr;
-// ===============================
-int Application::init()
-{
-    windowData = AppWindowData(600, 600, "Scrap Game Engine");
-    int result = window.init(windowData); 
-
-    if (result > 0)
-    {
-        cleanup(); // Cleanup after running
-
-        targetFrameRate = 0;
-        frameTime = 0.0f;
-        isRunning = true;
-
-        window.setWindowEventCallback([this](AppWindowEventType eventType, void* payload)
-            {
-                processWindowEvent(eventType, payload);
-            });
-
-        instance = this;
-    }
-
-    return result;
-}
-
-void Application::processWindowEvent(AppWindowEventType eventType, void* payload)
-{
-    switch (eventType)
-    {
-        case AppWindowEventType::CLOSE:
-        {
-            isRunning = false;
-            break;
-        }
-        case AppWindowEventType::FRAMEBUFFER_RESIZE:
-        {
-            break;
-        }
-    }
-}
-
-void Application::run()
-{
-    Renderer::setClearColor(0.25, 0.25, 0.25, 1.0);
-    Renderer::init();
-
-    CameraConfig cfg;
-    Camera::init(cfg, windowData.width, windowData.height);
-
-    // Late Init
-    Input::init(&window);
-
-    while (isRunning)
-    {
-        // Timing --------------------------------------------------------------
-        Time::processTime(frameTime);
-        float deltaTime = Time::getDeltaTime();
-
-        // Input Processing ----------------------------------------------------
-        Input::process();
-        if (Input::getKey(KeyCode::ESCAPE))
-        {
-            isRunning = false;
-        }
-
-        // Updates -------------------------------------------------------------
-        // Camera update
-        SceneStateMachine::update(deltaTime);
-
-        float y = 0;
-        Camera::setPosition(0, y, 0);
-        glm::vec2 screenPos(300, 150);
-        auto worldPos = Camera::screenToWorld(screenPos);
-
-
-        // Rendering -----------------------------------------------------------
-        Renderer::clear();
-        Renderer::beginFrame();        
-        SceneStateMachine::render();
-        Renderer::endFrame();
-
-        // Finalize ------------------------------------------------------------
-        window.update();
-    }
-
-    // TODO:: should have one allocater to rule them all
-    MeshAllocator::releaseUnusedMeshes();
-    TextureAllocator::releaseUnusedTextures();
-
-    SceneStateMachine::dispose();
-}
-
-void Application::cleanup()
-{
-    // No additional cleanup needed, the window will be automatically cleaned up.
-}
-
-void Application::setTargetFrameRate(unsigned int frameRate)
-{
-    instance->targetFrameRate = frameRate;
-
-    if (frameRate > 0) {
-        // Cap the frame rate
-        instance->frameTime = 1.0f / static_cast<float>(frameRate);
-    }
-    else if (frameRate == -1) {
-        // Uncapped frame rate (no limit)
-        instance->frameTime = 0.0f;  // Could be interpreted as no delay
-    }
-    else {
-        // Handle invalid frame rates (e.g., negative values other than -1)
-        std::cerr << "[FRAMEWORK] Invalid frame rate value." << std::endl;
-        instance->frameTime = 0.0f;  // Default to no frame delay
-    }
-
-    std::cout << "[FRAMEWORK] Setting target frame rate to: " << frameRate << std::endl; // Print the frameRate
-}
-
-void Application::quit()
-{
-    instance->isRunning = false;
+#include <glad/glad.h>
+#include "Renderer.h"
+#include "Camera.h"
+#include "Input.h"
+#include "Time.h"
+#include "Transform.h"
+#include "Clock.h"
+#include "FrameRecorder.h"
+#include "FrameTimingLog.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "AppWindow.h"
+#include "SceneStateMachine.h"
+#include "MainMenuScene.h"
+#include "Log.h"
+#include "TextureAllocator.h"
+#include "MeshAllocater.h"
+#include "ResourceManagementSystem.h"
+#include "DynamicGeometryAllocator.h"
+#include "FrameAllocator.h"
+#include "AssetHotReload.h"
+#include "FontCache.h"
+#include "Text.h"
+#include "TweenSystem.h"
+#include "SpriteAnimationSystem.h"
+#include "EventBus.h"
+#include "SceneLoader.h"
+#include "Application.h"
+
+using namespace ScrapGameEngine;
+
+// Application variables ========
+float x = 0;
+float y = 0;
+bool isRunning = true;
+
+float currentTime = 0.0f;
+float prevTime = 0.0f;
+float deltaTime = 0.0f;
+
+unsigned int targetFrameRate = 0;
+float frameTime = 0.0f;
+
+// Simulated frame time used by headless runs without a target frame rate
+const float headlessFrameTime = 1.0f / 60.0f;
+
+// Upper bound of simulation steps per frame, so a slow frame can't spiral into ever more steps
+const int maxStepsPerFrame = 8;
+
+Application* Application::instance = nullptr;
+// ===============================
+int Application::init()
+{
+    windowData = AppWindowData(600, 600, "Scrap Game Engine");
+    windowData.headless = headless;
+
+    // Without a window there is no GL context, so only record draw commands
+    if (headless)
+    {
+        Renderer::setBackend(RendererBackend::RECORDING);
+    }
+
+    int result = window.init(windowData); 
+
+    if (result > 0)
+    {
+        cleanup(); // Cleanup after running
+
+        targetFrameRate = 0;
+        frameTime = 0.0f;
+        isRunning = true;
+
+        window.setWindowEventCallback([this](AppWindowEventType eventType, void* payload)
+            {
+                processWindowEvent(eventType, payload);
+            });
+
+        instance = this;
+    }
+
+    return result;
+}
+
+void Application::processWindowEvent(AppWindowEventType eventType, void* payload)
+{
+    switch (eventType)
+    {
+        case AppWindowEventType::CLOSE:
+        {
+            isRunning = false;
+            break;
+        }
+        case AppWindowEventType::FRAMEBUFFER_RESIZE:
+        {
+            break;
+        }
+    }
+}
+
+void Application::run()
+{
+    Renderer::setClearColor(0.25, 0.25, 0.25, 1.0);
+    Renderer::init();
+    DynamicGeometryAllocator::init();
+    FrameAllocator::init();
+
+    CameraConfig cfg;
+    Camera::init(cfg, windowData.width, windowData.height);
+
+    // Late Init
+    Input::init(&window);
+    if (!hotReloadPath.empty())
+    {
+        AssetHotReload::init(hotReloadPath);
+    }
+    SGE_PROFILE_THREAD("Main");
+
+    float accumulator = 0.0f;
+
+    // Headless runs are driven by a simulated clock so they run as fast as possible
+    FakeClock headlessClock;
+    HighResolutionClock wallClock;
+    unsigned int frameCount = 0;
+    if (headless)
+    {
+        Time::setClock(&headlessClock);
+    }
+
+    // Frame capture and replay
+    FrameRecorder recorder;
+    FramePlayer player;
+    FrameTimingLog timings;
+    bool replaying = !replayPath.empty() && player.open(replayPath);
+    if (replaying)
+    {
+        Input::setScripted(true);
+        SceneStateMachine::setScriptedPreparation(player.hasPreparedSteps());
+    }
+    if (!recordPath.empty() && !replaying)
+    {
+        recorder.open(recordPath);
+    }
+    if (!timingsPath.empty())
+    {
+        timings.open(timingsPath);
+    }
+
+    while (isRunning)
+    {
+        SGE_PROFILE_SCOPE("Frame");
+        MemoryTracker::beginFrame();
+        FrameAllocator::beginFrame();
+
+        // Replay --------------------------------------------------------------
+        float replayDelta = 0.0f;
+        InputFrame replayFrame;
+        uint8_t replayPreparedStep = 0;
+        if (replaying && !player.readFrame(replayDelta, replayFrame, replayPreparedStep))
+        {
+            break; // End of the recording
+        }
+
+        // Timing --------------------------------------------------------------
+        if (replaying)
+        {
+            // Use the recorded delta verbatim so the run is bit-identical
+            Time::advanceTime(replayDelta);
+        }
+        else if (headless)
+        {
+            headlessClock.advance(frameTime > 0.0f ? frameTime : headlessFrameTime);
+            Time::processTime(0.0f);
+        }
+        else
+        {
+            Time::processTime(frameTime);
+        }
+        float deltaTime = Time::getDeltaTime();
+        double frameStart = wallClock.now();
+
+        // Input Processing ----------------------------------------------------
+        if (replaying)
+        {
+            Input::pushFrame(replayFrame);
+        }
+        Input::process();
+        InputFrame recordedFrame;
+        if (recorder.isOpen())
+        {
+            recordedFrame = Input::captureFrame();
+        }
+
+        if (Input::getKey(KeyCode::ESCAPE))
+        {
+            isRunning = false;
+        }
+
+        // Updates -------------------------------------------------------------
+        uint64_t firstUpdate = SceneStateMachine::getUpdateCount();
+        if (replaying)
+        {
+            SceneStateMachine::schedulePreparation(replayPreparedStep > 0 ? firstUpdate + replayPreparedStep : 0);
+        }
+
+        float fixedDeltaTime = Time::getFixedDeltaTime();
+        if (fixedDeltaTime > 0.0f)
+        {
+            // Run as many fixed steps as the elapsed time allows
+            accumulator += deltaTime;
+
+            int steps = 0;
+            while (accumulator >= fixedDeltaTime && steps < maxStepsPerFrame)
+            {
+                Transform::storePreviousStates();
+                SceneStateMachine::update(fixedDeltaTime);
+                accumulator -= fixedDeltaTime;
+                steps++;
+            }
+
+            // Too far behind, drop the remaining time instead of catching up
+            if (steps == maxStepsPerFrame && accumulator >= fixedDeltaTime)
+            {
+                accumulator = 0.0f;
+            }
+
+            Time::setInterpolationAlpha(accumulator / fixedDeltaTime);
+        }
+        else
+        {
+            accumulator = 0.0f;
+            SceneStateMachine::update(deltaTime);
+            Time::setInterpolationAlpha(1.0f);
+        }
+
+        // Written after the updates, which decide whether a scene preparation finished this frame
+        if (recorder.isOpen())
+        {
+            uint64_t preparedUpdate = SceneStateMachine::getPreparedUpdate();
+            uint8_t preparedStep = preparedUpdate > firstUpdate ? static_cast<uint8_t>(preparedUpdate - firstUpdate) : 0; // At most maxStepsPerFrame
+            recorder.writeFrame(deltaTime, recordedFrame, preparedStep);
+        }
+
+        // Deliver the events published by this frame's updates, scene requests included
+        EventBus::dispatch();
+
+        // Camera update
+        float y = 0;
+        Camera::setPosition(0, y, 0);
+        glm::vec2 screenPos(300, 150);
+        auto worldPos = Camera::screenToWorld(screenPos);
+
+
+        // Rendering -----------------------------------------------------------
+        double renderStart = wallClock.now();
+        Renderer::clear();
+        Renderer::beginFrame();        
+        FontCache::beginFrame();
+        SceneStateMachine::render();
+        FontCache::flush();
+        Renderer::endFrame();
+        Text::endFrame();
+        double renderEnd = wallClock.now();
+
+        // Finalize ------------------------------------------------------------
+        window.update();
+        AssetHotReload::update();
+        SceneLoader::update();
+        ResourceManagementSystem::getInstance().garbageCollect();
+
+        if (timings.isOpen())
+        {
+            timings.writeFrame(frameCount, deltaTime, renderStart - frameStart, renderEnd - renderStart, wallClock.now() - frameStart);
+        }
+
+        frameCount++;
+        if (frameLimit > 0 && frameCount >= frameLimit)
+        {
+            isRunning = false;
+        }
+    }
+
+    if (headless)
+    {
+        double elapsed = wallClock.now();
+        SGE_LOG_INFO(FRAMEWORK, "Headless run: {} frames in {} s ({} fps), {} draw calls recorded",
+            frameCount, elapsed, (elapsed > 0.0 ? frameCount / elapsed : 0.0), Renderer::getStats().totalDrawCalls);
+        SGE_LOG_INFO(FRAMEWORK, "Frame allocator peak: {} of {} bytes, {} overflows",
+            FrameAllocator::getPeakBytes(), FrameAllocator::getCapacity(), FrameAllocator::getOverflowCount());
+        SGE_LOG_INFO(FRAMEWORK, "Text layouts: {} in total, {} in the last frame", Text::getTotalLayouts(), Text::getFrameLayouts());
+        const GlyphCacheStats& glyphs = FontCache::getStats();
+        SGE_LOG_INFO(FRAMEWORK, "Glyph cache: {} lookups, {} misses, {} evictions, {} atlas bytes uploaded",
+            glyphs.lookups, glyphs.misses, glyphs.evictions, glyphs.uploadedBytes);
+        if (MemoryTracker::isHeapCountingCompiledIn())
+        {
+            SGE_LOG_INFO(FRAMEWORK, "Heap allocations in the last frame: {}", MemoryTracker::getFrameHeapAllocationCount());
+        }
+
+        Time::setClock(nullptr);
+    }
+
+    recorder.close();
+    timings.close();
+
+    if (!profilePath.empty())
+    {
+        if (!Profiler::isCompiledIn())
+        {
+            SGE_LOG_WARN(FRAMEWORK, "Profiler not compiled in, define SGE_ENABLE_PROFILER to record zones.");
+        }
+        Profiler::exportChromeTrace(profilePath);
+    }
+
+    AssetHotReload::shutdown();
+    SceneLoader::finish();
+    SceneStateMachine::dispose();
+    TweenSystem::clear();
+    SpriteAnimationSystem::clear();
+    EventBus::clear();
+    FontCache::shutdown();
+    ResourceManagementSystem::getInstance().shutdown();
+    DynamicGeometryAllocator::shutdown();
+    FrameAllocator::shutdown();
+
+    // Everything owned by scenes is gone now, anything still alive has leaked
+    uint64_t leakedObjects = MemoryTracker::getStats(MemoryTag::GAMEOBJECT).currentCount;
+    uint64_t leakedComponents = MemoryTracker::getStats(MemoryTag::COMPONENT).currentCount;
+    if (leakedObjects > 0 || leakedComponents > 0)
+    {
+        SGE_LOG_WARN(FRAMEWORK, "{} GameObjects and {} components were never deleted", leakedObjects, leakedComponents);
+    }
+
+    if (!memoryReportPath.empty())
+    {
+        MemoryTracker::dumpReport(memoryReportPath);
+    }
+}
+
+void Application::cleanup()
+{
+    // No additional cleanup needed, the window will be automatically cleaned up.
+}
+
+void Application::setTargetFrameRate(unsigned int frameRate)
+{
+    instance->targetFrameRate = frameRate;
+
+    if (frameRate > 0) {
+        // Cap the frame rate
+        instance->frameTime = 1.0f / static_cast<float>(frameRate);
+    }
+    else if (frameRate == -1) {
+        // Uncapped frame rate (no limit)
+        instance->frameTime = 0.0f;  // Could be interpreted as no delay
+    }
+    else {
+        // Handle invalid frame rates (e.g., negative values other than -1)
+        SGE_LOG_ERROR(FRAMEWORK, "Invalid frame rate value.");
+        instance->frameTime = 0.0f;  // Default to no frame delay
+    }
+
+    SGE_LOG_INFO(FRAMEWORK, "Setting target frame rate to: {}", frameRate);
+}
+
+void Application::setFixedTimeStep(float stepTime)
+{
+    if (stepTime < 0.0f)
+    {
+        SGE_LOG_ERROR(FRAMEWORK, "Invalid fixed time step value.");
+        stepTime = 0.0f;
+    }
+
+    Time::setFixedDeltaTime(stepTime);
+
+    SGE_LOG_INFO(FRAMEWORK, "Setting fixed time step to: {}", stepTime);
+}
+
+void Application::quit()
+{
+    instance->isRunning = false;
 }
\ No newline at end of file
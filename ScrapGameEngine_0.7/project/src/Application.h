@@ -1,82 +1,167 @@
-#pragma once
-#include "AppWindow.h"
-#include <string>
-
-namespace ScrapGameEngine
-{
-    /**
-     * @class Application
-     * @brief Manages the application lifecycle, including window creation, event processing, and main game loop.
-     *
-     * The `Application` class handles the initialization, running, and cleanup of the game application.
-     * It is responsible for managing the main application window, setting the target frame rate, and controlling
-     * the main game loop. It also handles window events such as resizing or closing.
-     */
-    class Application
-    {
-    public:
-        /**
-         * @brief Constructs an `Application` instance.
-         * @param width The width of the application window.
-         * @param height The height of the application window.
-         * @param title The title of the application window.
-         */
-        Application(int width, int height, const std::string& title)
-            : windowData(width, height, title), window(windowData), targetFrameRate(0), frameTime(0.0f), isRunning(false) {}
-
-        /**
-         * @brief Retrieves the singleton instance of the `Application`.
-         * @return Pointer to the `Application` instance.
-         */
-        static Application* getInstance() { return instance; }
-
-        /**
-         * @brief Initializes the application.
-         * @return 0 on success, non-zero error code on failure.
-         */
-        int init();
-
-        /**
-         * @brief Runs the main application loop.
-         */
-        void run();
-
-        /**
-         * @brief Cleans up resources before exiting the application.
-         */
-        void cleanup();
-
-        /**
-         * @brief Sets the target frame rate for the application.
-         * @param frameRate The desired frame rate in frames per second.
-         */
-        static void setTargetFrameRate(unsigned int frameRate);
-
-        /**
-         * @brief Quits the application, triggering cleanup and exit processes.
-         */
-        static void quit();
-
-        /**
-         * @brief Processes a window event.
-         * @param eventType The type of the window event.
-         * @param payload Additional information associated with the event.
-         */
-        void processWindowEvent(AppWindowEventType eventType, void* payload);
-
-        /**
-         * @brief Provides access to the application window.
-         * @return A reference to the `AppWindow`.
-         */
-        AppWindow& getWindow() { return window; }
-
-    private:
-        static Application* instance; /**< Singleton instance of the `Application`. */
-        AppWindow window; /**< The main application window. */
-        AppWindowData windowData; /**< Data describing the main application window. */
-
-        unsigned int targetFrameRate; /**< Desired frame rate in frames per second. */
-        float frameTime; /**< Time per frame in seconds. */
-        bool isRunning; /**< Flag indicating if the application is currently running. */
-    };
-}
+#pragma once
+#include "AppWindow.h"
+#include <string>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class Application
+     * @brief Manages the application lifecycle, including window creation, event processing, and main game loop.
+     *
+     * The `Application` class handles the initialization, running, and cleanup of the game application.
+     * It is responsible for managing the main application window, setting the target frame rate, and controlling
+     * the main game loop. It also handles window events such as resizing or closing.
+     */
+    class Application
+    {
+    public:
+        /**
+         * @brief Constructs an `Application` instance.
+         * @param width The width of the application window.
+         * @param height The height of the application window.
+         * @param title The title of the application window.
+         */
+        Application(int width, int height, const std::string& title)
+            : windowData(width, height, title), window(windowData), targetFrameRate(0), frameTime(0.0f), isRunning(false),
+            headless(false), frameLimit(0) {}
+
+        /**
+         * @brief Retrieves the singleton instance of the `Application`.
+         * @return Pointer to the `Application` instance.
+         */
+        static Application* getInstance() { return instance; }
+
+        /**
+         * @brief Initializes the application.
+         * @return 0 on success, non-zero error code on failure.
+         */
+        int init();
+
+        /**
+         * @brief Runs the main application loop.
+         */
+        void run();
+
+        /**
+         * @brief Cleans up resources before exiting the application.
+         */
+        void cleanup();
+
+        /**
+         * @brief Sets the target frame rate for the application.
+         * @param frameRate The desired frame rate in frames per second.
+         */
+        static void setTargetFrameRate(unsigned int frameRate);
+
+        /**
+         * @brief Sets a fixed time step for the simulation.
+         *
+         * With a fixed step, scenes are updated zero or more times per frame with a constant delta time,
+         * and rendering interpolates transforms between the last two steps. Pass 0 to update once per
+         * frame with the variable delta time.
+         *
+         * @param stepTime The simulation step in seconds, or 0 for variable steps.
+         */
+        static void setFixedTimeStep(float stepTime);
+
+        /**
+         * @brief Enables headless mode, must be called before init().
+         *
+         * Headless mode uses a null window, the recording renderer backend and scripted input,
+         * so scenes can run on machines without a display or GPU. Frames run as fast as possible
+         * on a simulated clock that advances by the target frame time (1/60 s if uncapped).
+         *
+         * @param enabled True to run headless.
+         */
+        void setHeadless(bool enabled) { headless = enabled; }
+
+        /**
+         * @brief Checks whether the running application is headless.
+         * @return True if the application runs without a window.
+         */
+        static bool isHeadless() { return instance && instance->headless; }
+
+        /**
+         * @brief Limits how many frames run() executes before returning.
+         * @param frames The number of frames to run, or 0 to run until quit.
+         */
+        void setFrameLimit(unsigned int frames) { frameLimit = frames; }
+
+        /**
+         * @brief Records every frame's delta time and input to a file during run().
+         * @param path The recording file to write, or an empty string to disable recording.
+         */
+        void setRecordPath(const std::string& path) { recordPath = path; }
+
+        /**
+         * @brief Replays a recording made with setRecordPath() instead of reading the clock and devices.
+         *
+         * The run ends with the last recorded frame. Frames run as fast as possible.
+         *
+         * @param path The recording file to read, or an empty string to disable replay.
+         */
+        void setReplayPath(const std::string& path) { replayPath = path; }
+
+        /**
+         * @brief Writes per-frame CPU timings as CSV during run().
+         * @param path The CSV file to write, or an empty string to disable timing output.
+         */
+        void setTimingsPath(const std::string& path) { timingsPath = path; }
+
+        /**
+         * @brief Exports the recorded profiler zones as a Chrome trace when run() returns.
+         *
+         * Zones are only recorded in builds with `SGE_ENABLE_PROFILER` defined.
+         *
+         * @param path The JSON file to write, or an empty string to disable the export.
+         */
+        void setProfilePath(const std::string& path) { profilePath = path; }
+
+        /**
+         * @brief Writes the per-tag memory report when run() returns, after all scenes are disposed.
+         * @param path The text file to write, or an empty string to disable the report.
+         */
+        void setMemoryReportPath(const std::string& path) { memoryReportPath = path; }
+
+        /**
+         * @brief Watches an asset directory and reloads textures and fonts when their files change.
+         * @param path The asset directory, or an empty string to disable hot reload.
+         */
+        void setHotReloadPath(const std::string& path) { hotReloadPath = path; }
+
+        /**
+         * @brief Quits the application, triggering cleanup and exit processes.
+         */
+        static void quit();
+
+        /**
+         * @brief Processes a window event.
+         * @param eventType The type of the window event.
+         * @param payload Additional information associated with the event.
+         */
+        void processWindowEvent(AppWindowEventType eventType, void* payload);
+
+        /**
+         * @brief Provides access to the application window.
+         * @return A reference to the `AppWindow`.
+         */
+        AppWindow& getWindow() { return window; }
+
+    private:
+        static Application* instance; /**< Singleton instance of the `Application`. */
+        AppWindow window; /**< The main application window. */
+        AppWindowData windowData; /**< Data describing the main application window. */
+
+        unsigned int targetFrameRate; /**< Desired frame rate in frames per second. */
+        float frameTime; /**< Time per frame in seconds. */
+        bool isRunning; /**< Flag indicating if the application is currently running. */
+        bool headless; /**< Flag indicating if the application runs without a window. */
+        unsigned int frameLimit; /**< Number of frames to run, 0 for no limit. */
+        std::string recordPath; /**< File to record frames to, empty if not recording. */
+        std::string replayPath; /**< File to replay frames from, empty if not replaying. */
+        std::string timingsPath; /**< CSV file for per-frame timings, empty if disabled. */
+        std::string profilePath; /**< Chrome trace file for profiler zones, empty if disabled. */
+        std::string memoryReportPath; /**< Memory report written at shutdown, empty if disabled. */
+        std::string hotReloadPath; /**< Asset directory watched for changes, empty if disabled. */
+    };
+}
@@ -0,0 +1,178 @@
+#include "AssetHotReload.h"
+#include "ResourceManagementSystem.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <filesystem>
+
+using namespace ScrapGameEngine;
+
+FileWatcher AssetHotReload::watcher;
+std::mutex AssetHotReload::mutex;
+std::deque<AssetHotReload::PendingReload> AssetHotReload::pending;
+std::vector<AssetHotReload::ListenerEntry> AssetHotReload::listeners;
+uint64_t AssetHotReload::nextListenerId = 1;
+size_t AssetHotReload::reloadCount = 0;
+std::unordered_map<std::string, std::vector<AssetId>> AssetHotReload::canonicalIds;
+size_t AssetHotReload::canonicalizedCount = 0;
+
+bool AssetHotReload::init(const std::string& directory)
+{
+    reloadCount = 0;
+    return watcher.start(directory, &AssetHotReload::onFileChanged);
+}
+
+void AssetHotReload::onFileChanged(const std::string& path)
+{
+    // Paths nobody ever loaded or listened to were never interned
+    std::vector<AssetId> ids = findAssets(canonicalize(path));
+    if (ids.empty()) return;
+
+    // The same file may have been loaded under several spellings, decode it once for all of them
+    bool decoded = false;
+    TextureImage image;
+    std::vector<PendingReload> reloads;
+    for (AssetId id : ids)
+    {
+        PendingReload reload;
+        reload.id = id;
+        reload.path = path;
+
+        if (TextureProcessing::isImageFile(path) && ResourceManagementSystem::getInstance().find<Texture2D>(id))
+        {
+            if (!decoded)
+            {
+                SGE_PROFILE_SCOPE("AssetHotReload::decode");
+                if (!Texture2D::decodeImage(path, image))
+                {
+                    SGE_LOG_ERROR(RENDERER, "Hot reload failed to decode {}", path);
+                    return;
+                }
+                decoded = true;
+            }
+            reload.hasImage = true;
+            reload.image = image;
+        }
+        reloads.push_back(std::move(reload));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (PendingReload& reload : reloads)
+    {
+        pending.push_back(std::move(reload));
+    }
+}
+
+std::string AssetHotReload::canonicalize(const std::string& path)
+{
+    // weakly_canonical also resolves files that were just deleted or are being replaced
+    std::error_code error;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(std::filesystem::path(AssetPaths::normalize(path)), error);
+    return error ? AssetPaths::normalize(path) : canonical.generic_string();
+}
+
+std::vector<AssetId> AssetHotReload::findAssets(const std::string& canonicalPath)
+{
+    // Interned paths are never removed, so a changed count means new paths to resolve
+    if (AssetPaths::getCount() != canonicalizedCount)
+    {
+        std::vector<std::pair<AssetId, std::string>> interned = AssetPaths::getAll();
+        canonicalIds.clear();
+        for (const std::pair<AssetId, std::string>& entry : interned)
+        {
+            canonicalIds[canonicalize(entry.second)].push_back(entry.first);
+        }
+        canonicalizedCount = interned.size();
+    }
+
+    auto it = canonicalIds.find(canonicalPath);
+    return it != canonicalIds.end() ? it->second : std::vector<AssetId>();
+}
+
+void AssetHotReload::update()
+{
+    if (!watcher.isRunning()) return;
+    SGE_PROFILE_SCOPE("AssetHotReload::update");
+
+    for (int i = 0; i < MAX_UPLOADS_PER_FRAME; ++i)
+    {
+        PendingReload reload;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pending.empty()) break;
+            reload = std::move(pending.front());
+            pending.pop_front();
+        }
+
+        bool reloaded = false;
+        if (reload.hasImage)
+        {
+            // Looked up again, the texture may have been collected since it was decoded
+            Texture2D* texture = ResourceManagementSystem::getInstance().find<Texture2D>(reload.id);
+            if (texture)
+            {
+                texture->reload(reload.image);
+                reloaded = true;
+            }
+        }
+
+        // Listeners may add or remove listeners, so match by ID and look each one up again
+        std::vector<uint64_t> matching;
+        for (const ListenerEntry& entry : listeners)
+        {
+            if (entry.asset == reload.id) matching.push_back(entry.id);
+        }
+        for (uint64_t listenerId : matching)
+        {
+            auto it = std::find_if(listeners.begin(), listeners.end(),
+                [listenerId](const ListenerEntry& entry) { return entry.id == listenerId; });
+            if (it == listeners.end()) continue;
+
+            Listener callback = it->callback;
+            callback(reload.path);
+            reloaded = true;
+        }
+
+        if (reloaded)
+        {
+            reloadCount++;
+            SGE_LOG_INFO(FRAMEWORK, "Hot reloaded {}", reload.path);
+        }
+    }
+}
+
+void AssetHotReload::shutdown()
+{
+    watcher.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.clear();
+    listeners.clear();
+    canonicalIds.clear();
+    canonicalizedCount = 0;
+}
+
+bool AssetHotReload::isEnabled()
+{
+    return watcher.isRunning();
+}
+
+uint64_t AssetHotReload::addListener(const std::string& path, Listener listener)
+{
+    uint64_t id = nextListenerId++;
+    listeners.push_back({ id, AssetPaths::intern(path), std::move(listener) });
+    return id;
+}
+
+void AssetHotReload::removeListener(uint64_t id)
+{
+    if (id == 0) return;
+
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+        [id](const ListenerEntry& entry) { return entry.id == id; }), listeners.end());
+}
+
+size_t AssetHotReload::getReloadCount()
+{
+    return reloadCount;
+}
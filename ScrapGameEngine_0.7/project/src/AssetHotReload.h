@@ -0,0 +1,135 @@
+#pragma once
+#include "FileWatcher.h"
+#include "Texture2D.h"
+#include "Hash.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class AssetHotReload
+     * @brief Reloads assets while the game runs when their files change on disk.
+     *
+     * A `FileWatcher` reports modified files under the asset directory. Textures that are
+     * loaded are decoded on the watcher thread and the pixels are swapped into the existing
+     * `Texture2D` on the main thread by update(), a few per frame, so pointers and handles
+     * stay valid and no frame waits for disk or decoding. Other assets, such as fonts, are
+     * reloaded by listeners registered with addListener(). Watched and loaded paths are compared
+     * in canonical form, so "../assets/a.png" and "./../assets/a.png" name the same file.
+     */
+    class AssetHotReload
+    {
+    public:
+        AssetHotReload() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @typedef Listener
+         * @brief Called on the main thread with the path of a modified file.
+         */
+        using Listener = std::function<void(const std::string& path)>;
+
+        static constexpr int MAX_UPLOADS_PER_FRAME = 2; ///< Texture swaps applied per update().
+
+        /**
+         * @brief Starts watching an asset directory.
+         * @param directory The root of the assets, e.g. "../assets".
+         * @return False if the directory cannot be watched.
+         */
+        static bool init(const std::string& directory);
+
+        /**
+         * @brief Applies finished reloads. Call once per frame on the main thread.
+         */
+        static void update();
+
+        /**
+         * @brief Stops watching and drops pending reloads.
+         */
+        static void shutdown();
+
+        /**
+         * @brief Checks whether hot reload is running.
+         * @return True after a successful init().
+         */
+        static bool isEnabled();
+
+        /**
+         * @brief Registers a callback for changes to one file.
+         * @param path The file path, as passed to the loader.
+         * @param listener Called on the main thread when the file changes.
+         * @return An ID for removeListener().
+         */
+        static uint64_t addListener(const std::string& path, Listener listener);
+
+        /**
+         * @brief Unregisters a callback.
+         * @param id The ID returned by addListener(), 0 is ignored.
+         */
+        static void removeListener(uint64_t id);
+
+        /**
+         * @brief Gets the number of assets reloaded since init().
+         * @return The reload count.
+         */
+        static size_t getReloadCount();
+
+    private:
+        /**
+         * @struct PendingReload
+         * @brief A modified file waiting for the main thread.
+         */
+        struct PendingReload
+        {
+            AssetId id = 0;         /**< Interned path. */
+            std::string path;       /**< Path as reported by the watcher. */
+            bool hasImage = false;  /**< True if `image` holds a decoded texture. */
+            TextureImage image;     /**< Decoded pixels of a texture. */
+        };
+
+        /**
+         * @struct ListenerEntry
+         * @brief A registered listener.
+         */
+        struct ListenerEntry
+        {
+            uint64_t id;            /**< Returned by addListener(). */
+            AssetId asset;          /**< Interned path of the watched file. */
+            Listener callback;      /**< The callback. */
+        };
+
+        /**
+         * @brief Runs on the watcher thread for every modified file.
+         * @param path The file path.
+         */
+        static void onFileChanged(const std::string& path);
+
+        /**
+         * @brief Resolves a path to its absolute canonical form, so different spellings of a file compare equal.
+         * @param path The path.
+         * @return The canonical path, or the normalized path if it cannot be resolved.
+         */
+        static std::string canonicalize(const std::string& path);
+
+        /**
+         * @brief Finds the interned IDs of every spelling of a file. Watcher thread only.
+         * @param canonicalPath The canonical path of the file.
+         * @return The IDs, empty if the file was never loaded or listened to.
+         */
+        static std::vector<AssetId> findAssets(const std::string& canonicalPath);
+
+        static FileWatcher watcher;                     /**< Reports modified files. */
+        static std::mutex mutex;                        /**< Guards `pending`. */
+        static std::deque<PendingReload> pending;       /**< Reloads ready for the main thread. */
+        static std::vector<ListenerEntry> listeners;    /**< Main thread only. */
+        static uint64_t nextListenerId;                 /**< ID of the next listener. */
+        static size_t reloadCount;                      /**< Assets reloaded. */
+        static std::unordered_map<std::string, std::vector<AssetId>> canonicalIds; /**< Interned IDs by canonical path, watcher thread only. */
+        static size_t canonicalizedCount;               /**< Interned paths added to `canonicalIds`. */
+    };
+}
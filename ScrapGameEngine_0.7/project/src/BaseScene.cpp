@@ -1,38 +1,46 @@
-#include "BaseScene.h"
-#include "GameObjectCollection.h"
-
-using namespace ScrapGameEngine;
-
-// Called first when changed to this scene.
-void BaseScene::initialize()
-{
-    onInitialize();
-}
-
-// Called second when changed to this scene.
-void BaseScene::activate()
-{
-    onActivate();
-}
-
-// Called before changing to a different scene.
-void BaseScene::deactivate()
-{
-    // Dispose all gameObjects
-    GameObjectCollection::dispose(); 
-    onDeactivate();
-}
-
-void BaseScene::update(float deltaTime)
-{
-    // Update all gameObjects
-    GameObjectCollection::update(deltaTime); 
-    onUpdate(deltaTime);
-}
-
-void BaseScene::render()
-{
-    // Render all gameObjects
-    GameObjectCollection::render(); 
-    onRender();
-}
+#include "BaseScene.h"
+#include "GameObjectCollection.h"
+
+using namespace ScrapGameEngine;
+
+// Called first when changed to this scene.
+void BaseScene::initialize()
+{
+    onInitialize();
+    initialized = true;
+}
+
+// Called second when changed to this scene.
+void BaseScene::activate()
+{
+    onActivate();
+}
+
+// Called before changing to a different scene.
+void BaseScene::deactivate()
+{
+    // Dispose all gameObjects
+    GameObjectCollection::dispose(); 
+    onDeactivate();
+    initialized = false;
+}
+
+// Called instead of deactivate when the scene stays resident.
+void BaseScene::suspend()
+{
+    onSuspend();
+}
+
+void BaseScene::update(float deltaTime)
+{
+    // Update all gameObjects
+    GameObjectCollection::update(deltaTime); 
+    onUpdate(deltaTime);
+}
+
+void BaseScene::render()
+{
+    // Render all gameObjects
+    GameObjectCollection::render(); 
+    onRender();
+}
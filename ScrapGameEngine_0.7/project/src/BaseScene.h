@@ -1,93 +1,133 @@
-#pragma once
-#include <string>
-#include <vector>
-#include "GameObject.h"
-
-namespace ScrapGameEngine
-{
-    /**
-     * @class BaseScene
-     * @brief Represents the base class for all scenes in the ScrapGameEngine.
-     *
-     * The `BaseScene` class defines the lifecycle of a scene, including initialization,
-     * activation, deactivation, updates, and rendering. Derived classes must implement
-     * the required functions to provide custom behavior.
-     */
-    class BaseScene
-    {
-    protected:
-        /**
-         * @brief Initializes the scene.
-         *
-         * This pure virtual function must be implemented by derived classes to
-         * provide custom initialization logic for the scene.
-         */
-        virtual void onInitialize() = 0;
-
-        /**
-         * @brief Activates the scene.
-         *
-         * Called when the scene becomes active. Can be overridden by derived classes
-         * to provide custom logic when the scene is activated.
-         */
-        virtual void onActivate() {};
-
-        /**
-         * @brief Deactivates the scene.
-         *
-         * Called when the scene becomes inactive. Can be overridden by derived classes
-         * to provide custom logic when the scene is deactivated.
-         */
-        virtual void onDeactivate() {};
-
-        /**
-         * @brief Updates the scene.
-         * @param deltaTime Time elapsed since the last frame.
-         *
-         * Can be overridden by derived classes to provide custom update logic for the scene.
-         */
-        virtual void onUpdate(float deltaTime) {};
-
-        /**
-         * @brief Renders the scene.
-         *
-         * Can be overridden by derived classes to provide custom rendering logic for the scene.
-         */
-        virtual void onRender() {};
-
-    public:
-        /**
-         * @brief Gets the name of the scene.
-         * @return A string representing the name of the scene.
-         *
-         * This pure virtual function must be implemented by derived classes to return the scene's name.
-         */
-        virtual std::string getName() const = 0;
-
-        /**
-         * @brief Initializes the scene by calling `onInitialize`.
-         */
-        void initialize();
-
-        /**
-         * @brief Activates the scene by calling `onActivate`.
-         */
-        void activate();
-
-        /**
-         * @brief Deactivates the scene by calling `onDeactivate`.
-         */
-        void deactivate();
-
-        /**
-         * @brief Updates the scene by calling `onUpdate`.
-         * @param deltaTime Time elapsed since the last frame.
-         */
-        void update(float deltaTime);
-
-        /**
-         * @brief Renders the scene by calling `onRender`.
-         */
-        void render();
-    };
-}
+#pragma once
+#include <string>
+#include <vector>
+#include "GameObject.h"
+#include "MemoryTracker.h"
+#include "SceneManifest.h"
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class BaseScene
+     * @brief Represents the base class for all scenes in the ScrapGameEngine.
+     *
+     * The `BaseScene` class defines the lifecycle of a scene, including initialization,
+     * activation, deactivation, updates, and rendering. Derived classes must implement
+     * the required functions to provide custom behavior.
+     */
+    class BaseScene : public TrackedAllocation<MemoryTag::SCENE>
+    {
+    protected:
+        /**
+         * @brief Initializes the scene.
+         *
+         * This pure virtual function must be implemented by derived classes to
+         * provide custom initialization logic for the scene.
+         */
+        virtual void onInitialize() = 0;
+
+        /**
+         * @brief Activates the scene.
+         *
+         * Called when the scene becomes active. Can be overridden by derived classes
+         * to provide custom logic when the scene is activated.
+         */
+        virtual void onActivate() {};
+
+        /**
+         * @brief Deactivates the scene.
+         *
+         * Called when the scene becomes inactive. Can be overridden by derived classes
+         * to provide custom logic when the scene is deactivated.
+         */
+        virtual void onDeactivate() {};
+
+        /**
+         * @brief Suspends the scene.
+         *
+         * Called instead of `onDeactivate` when the scene is left but stays resident, so its
+         * objects survive for the next activation. Can be overridden by derived classes to
+         * pause anything that keeps running outside the update, such as audio.
+         */
+        virtual void onSuspend() {};
+
+        /**
+         * @brief Updates the scene.
+         * @param deltaTime Time elapsed since the last frame.
+         *
+         * Can be overridden by derived classes to provide custom update logic for the scene.
+         */
+        virtual void onUpdate(float deltaTime) {};
+
+        /**
+         * @brief Renders the scene.
+         *
+         * Can be overridden by derived classes to provide custom rendering logic for the scene.
+         */
+        virtual void onRender() {};
+
+    public:
+        /**
+         * @brief Virtual destructor, scenes are deleted through `BaseScene` pointers.
+         */
+        virtual ~BaseScene() = default;
+
+        /**
+         * @brief Gets the name of the scene.
+         * @return A string representing the name of the scene.
+         *
+         * This pure virtual function must be implemented by derived classes to return the scene's name.
+         */
+        virtual std::string getName() const = 0;
+
+        /**
+         * @brief Declares the assets the scene loads in `onInitialize`.
+         * @param manifest Receives the assets.
+         *
+         * Can be overridden by derived classes so `SceneLoader` can preload the assets
+         * before the scene is switched to. Declared textures must use the same
+         * configuration as the scene's own loads.
+         */
+        virtual void declareAssets(SceneManifest& /*manifest*/) const {};
+
+        /**
+         * @brief Initializes the scene by calling `onInitialize`.
+         */
+        void initialize();
+
+        /**
+         * @brief Activates the scene by calling `onActivate`.
+         */
+        void activate();
+
+        /**
+         * @brief Deactivates the scene by calling `onDeactivate`. The scene must be initialized again before use.
+         */
+        void deactivate();
+
+        /**
+         * @brief Suspends the scene by calling `onSuspend`. The scene stays initialized.
+         */
+        void suspend();
+
+        /**
+         * @brief Checks whether the scene is initialized and not yet deactivated.
+         * @return True if the scene's objects exist.
+         */
+        bool isInitialized() const { return initialized; }
+
+        /**
+         * @brief Updates the scene by calling `onUpdate`.
+         * @param deltaTime Time elapsed since the last frame.
+         */
+        void update(float deltaTime);
+
+        /**
+         * @brief Renders the scene by calling `onRender`.
+         */
+        void render();
+
+    private:
+        bool initialized = false; /**< Set by initialize(), cleared by deactivate(). */
+    };
+}
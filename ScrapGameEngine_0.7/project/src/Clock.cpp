@@ -0,0 +1,47 @@
+#include "Clock.h"
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+using namespace ScrapGameEngine;
+
+HighResolutionClock::HighResolutionClock()
+    : start(std::chrono::steady_clock::now())
+{
+#ifdef _WIN32
+    timeBeginPeriod(1); // Request 1 ms scheduler granularity for accurate sleeps
+#endif
+}
+
+HighResolutionClock::~HighResolutionClock()
+{
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+}
+
+double HighResolutionClock::now() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void HighResolutionClock::sleepFor(double seconds)
+{
+    if (seconds <= 0.0) return;
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+}
+
+void HighResolutionClock::spinPause()
+{
+    std::this_thread::yield();
+}
+
+void FakeClock::sleepFor(double seconds)
+{
+    if (seconds <= 0.0) return;
+    currentTime += seconds + oversleep;
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <chrono>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class IClock
+     * @brief Interface for a monotonic clock used to drive the frame loop.
+     *
+     * Time is reported in seconds since the clock was created. Abstracting the clock lets the
+     * frame limiter and the simulation run against a fake clock for deterministic pacing tests.
+     */
+    class IClock
+    {
+    public:
+        virtual ~IClock() = default;
+
+        /**
+         * @brief Gets the current time.
+         * @return Seconds elapsed since the clock was created.
+         */
+        virtual double now() const = 0;
+
+        /**
+         * @brief Suspends the calling thread for roughly the given duration.
+         *
+         * Implementations may oversleep; callers that need precision should spin for the remainder.
+         *
+         * @param seconds The duration to sleep in seconds.
+         */
+        virtual void sleepFor(double seconds) = 0;
+
+        /**
+         * @brief Called on every iteration of a busy-wait loop.
+         *
+         * Real clocks yield the time slice, fake clocks advance by a small quantum so spinning terminates.
+         */
+        virtual void spinPause() = 0;
+    };
+
+    /**
+     * @class HighResolutionClock
+     * @brief Monotonic wall clock based on `std::chrono::steady_clock`.
+     *
+     * On Windows the system timer resolution is raised to 1 ms while the clock is alive so that
+     * short sleeps are not rounded up to the default 15.6 ms tick.
+     */
+    class HighResolutionClock : public IClock
+    {
+    public:
+        /**
+         * @brief Constructs the clock and starts counting from zero.
+         */
+        HighResolutionClock();
+
+        /**
+         * @brief Restores the system timer resolution.
+         */
+        ~HighResolutionClock() override;
+
+        /**
+         * @brief Gets the current time.
+         * @return Seconds elapsed since the clock was created.
+         */
+        double now() const override;
+
+        /**
+         * @brief Sleeps the calling thread.
+         * @param seconds The duration to sleep in seconds.
+         */
+        void sleepFor(double seconds) override;
+
+        /**
+         * @brief Yields the rest of the time slice while spinning.
+         */
+        void spinPause() override;
+
+    private:
+        std::chrono::steady_clock::time_point start; ///< Time point the clock counts from.
+    };
+
+    /**
+     * @class FakeClock
+     * @brief Manually advanced clock for deterministic runs and pacing tests.
+     *
+     * Sleeping advances the clock by the requested duration plus an optional simulated
+     * oversleep, which allows measuring limiter jitter without depending on the OS scheduler.
+     */
+    class FakeClock : public IClock
+    {
+    public:
+        /**
+         * @brief Gets the current fake time.
+         * @return The accumulated time in seconds.
+         */
+        double now() const override { return currentTime; }
+
+        /**
+         * @brief Advances the clock as if the thread had slept.
+         * @param seconds The requested sleep duration in seconds.
+         */
+        void sleepFor(double seconds) override;
+
+        /**
+         * @brief Advances the clock by the spin quantum.
+         */
+        void spinPause() override { currentTime += spinQuantum; }
+
+        /**
+         * @brief Advances the clock by the given amount.
+         * @param seconds The duration to advance in seconds.
+         */
+        void advance(double seconds) { if (seconds > 0.0) currentTime += seconds; }
+
+        /**
+         * @brief Sets the amount every sleep overshoots its request, emulating a coarse OS timer.
+         * @param seconds The oversleep in seconds.
+         */
+        void setOversleep(double seconds) { oversleep = seconds; }
+
+    private:
+        double currentTime = 0.0; ///< Current fake time in seconds.
+        double oversleep = 0.0;   ///< Simulated oversleep added to every sleep.
+        double spinQuantum = 0.00001; ///< Time consumed by one spin iteration (10 us).
+    };
+}
@@ -0,0 +1,181 @@
+#include "DynamicGeometryAllocator.h"
+#include "Renderer.h"
+#include "MemoryTracker.h"
+#include <glad/glad.h>
+#include <glfw/glfw3.h>
+#include <cstring>
+#include "Log.h"
+
+// The loader only exposes OpenGL 2.1, so the buffer storage and sync entry points are fetched manually.
+#define SGE_GL_MAP_WRITE_BIT                0x0002
+#define SGE_GL_MAP_PERSISTENT_BIT           0x0040
+#define SGE_GL_MAP_COHERENT_BIT             0x0080
+#define SGE_GL_SYNC_GPU_COMMANDS_COMPLETE   0x9117
+#define SGE_GL_SYNC_FLUSH_COMMANDS_BIT      0x00000001
+#define SGE_GL_ALREADY_SIGNALED             0x911A
+#define SGE_GL_CONDITION_SATISFIED          0x911C
+
+typedef struct __GLsync* SGE_GLsync;
+typedef void (APIENTRYP SGE_PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+typedef void* (APIENTRYP SGE_PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef SGE_GLsync (APIENTRYP SGE_PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
+typedef GLenum (APIENTRYP SGE_PFNGLCLIENTWAITSYNCPROC)(SGE_GLsync sync, GLbitfield flags, unsigned long long timeout);
+typedef void (APIENTRYP SGE_PFNGLDELETESYNCPROC)(SGE_GLsync sync);
+
+static SGE_PFNGLBUFFERSTORAGEPROC sge_glBufferStorage = nullptr;
+static SGE_PFNGLMAPBUFFERRANGEPROC sge_glMapBufferRange = nullptr;
+static SGE_PFNGLFENCESYNCPROC sge_glFenceSync = nullptr;
+static SGE_PFNGLCLIENTWAITSYNCPROC sge_glClientWaitSync = nullptr;
+static SGE_PFNGLDELETESYNCPROC sge_glDeleteSync = nullptr;
+
+// Try to load everything needed for a persistently mapped buffer
+static bool loadPersistentMappingFunctions()
+{
+    if (!glfwGetCurrentContext()) return false;
+    if (!glfwExtensionSupported("GL_ARB_buffer_storage") || !glfwExtensionSupported("GL_ARB_sync")) return false;
+
+    sge_glBufferStorage = (SGE_PFNGLBUFFERSTORAGEPROC)glfwGetProcAddress("glBufferStorage");
+    sge_glMapBufferRange = (SGE_PFNGLMAPBUFFERRANGEPROC)glfwGetProcAddress("glMapBufferRange");
+    sge_glFenceSync = (SGE_PFNGLFENCESYNCPROC)glfwGetProcAddress("glFenceSync");
+    sge_glClientWaitSync = (SGE_PFNGLCLIENTWAITSYNCPROC)glfwGetProcAddress("glClientWaitSync");
+    sge_glDeleteSync = (SGE_PFNGLDELETESYNCPROC)glfwGetProcAddress("glDeleteSync");
+
+    return sge_glBufferStorage && sge_glMapBufferRange && sge_glFenceSync && sge_glClientWaitSync && sge_glDeleteSync;
+}
+
+namespace ScrapGameEngine
+{
+    std::unique_ptr<RingBufferAllocator> DynamicGeometryAllocator::ring;
+    std::vector<unsigned char> DynamicGeometryAllocator::staging;
+    unsigned char* DynamicGeometryAllocator::mapped = nullptr;
+    unsigned int DynamicGeometryAllocator::bufferId = 0;
+    bool DynamicGeometryAllocator::persistent = false;
+
+    void DynamicGeometryAllocator::init(unsigned int capacity, unsigned int maxFramesInFlight)
+    {
+        shutdown();
+
+        if (Renderer::isGpuBackend())
+        {
+            glGenBuffers(1, &bufferId);
+            glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+
+            persistent = loadPersistentMappingFunctions();
+            if (persistent)
+            {
+                GLbitfield flags = SGE_GL_MAP_WRITE_BIT | SGE_GL_MAP_PERSISTENT_BIT | SGE_GL_MAP_COHERENT_BIT;
+                sge_glBufferStorage(GL_ARRAY_BUFFER, capacity, nullptr, flags);
+                mapped = static_cast<unsigned char*>(sge_glMapBufferRange(GL_ARRAY_BUFFER, 0, capacity, flags));
+                persistent = (mapped != nullptr);
+            }
+
+            if (!persistent)
+            {
+                // Fallback: stage on the CPU and orphan the buffer every frame
+                glBufferData(GL_ARRAY_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            MemoryTracker::recordAllocation(MemoryTag::GPU_BUFFER, capacity);
+        }
+
+        // Without a GPU (headless) the staging copy is all there is
+        if (!persistent) staging.resize(capacity);
+
+        FenceWaitFn waitFn = [](FenceHandle fence, bool block) -> bool
+            {
+                if (!fence || !sge_glClientWaitSync) return true;
+
+                unsigned long long timeout = block ? 1000000000ull : 0ull; // 1 second when blocking
+                GLenum result = sge_glClientWaitSync(static_cast<SGE_GLsync>(fence), block ? SGE_GL_SYNC_FLUSH_COMMANDS_BIT : 0, timeout);
+                return result == SGE_GL_ALREADY_SIGNALED || result == SGE_GL_CONDITION_SATISFIED;
+            };
+
+        FenceReleaseFn releaseFn = [](FenceHandle fence)
+            {
+                if (fence && sge_glDeleteSync) sge_glDeleteSync(static_cast<SGE_GLsync>(fence));
+            };
+
+        ring = std::make_unique<RingBufferAllocator>(capacity, maxFramesInFlight, waitFn, releaseFn);
+
+        SGE_LOG_INFO(RENDERER, "Dynamic geometry buffer: {} bytes, {}", capacity,
+            (persistent ? "persistent mapping" : bufferId != 0 ? "orphaning" : "CPU only"));
+    }
+
+    void DynamicGeometryAllocator::shutdown()
+    {
+        size_t capacity = ring ? ring->getCapacity() : 0;
+        ring.reset();
+        staging.clear();
+        staging.shrink_to_fit();
+
+        if (bufferId != 0)
+        {
+            // Deleting the buffer also unmaps it
+            glDeleteBuffers(1, &bufferId);
+            bufferId = 0;
+            MemoryTracker::recordFree(MemoryTag::GPU_BUFFER, capacity);
+        }
+
+        mapped = nullptr;
+        persistent = false;
+    }
+
+    DynamicAllocation DynamicGeometryAllocator::allocate(unsigned int size, unsigned int alignment)
+    {
+        DynamicAllocation allocation;
+        if (!ring) return allocation;
+
+        size_t offset = 0;
+        if (!ring->allocate(size, alignment, offset))
+        {
+            SGE_LOG_ERROR(RENDERER, "Dynamic geometry buffer exhausted, dropping {} bytes.", size);
+            return allocation;
+        }
+
+        unsigned char* base = persistent ? mapped : staging.data();
+        allocation.data = base + offset;
+        allocation.bufferId = bufferId;
+        allocation.offset = static_cast<unsigned int>(offset);
+        allocation.size = size;
+        return allocation;
+    }
+
+    void DynamicGeometryAllocator::flush()
+    {
+        // Coherent mappings are visible to the GPU without an explicit upload
+        if (!ring || persistent || bufferId == 0 || ring->getFrameBytes() == 0) return;
+
+        size_t begin = ring->getFrameBegin();
+        size_t head = ring->getHead();
+
+        glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+
+        // Orphan the old storage so the driver does not have to wait for previous draws
+        glBufferData(GL_ARRAY_BUFFER, ring->getCapacity(), nullptr, GL_STREAM_DRAW);
+
+        if (ring->frameWrapped())
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, begin, ring->getCapacity() - begin, staging.data() + begin);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, head, staging.data());
+        }
+        else
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, begin, head - begin, staging.data() + begin);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void DynamicGeometryAllocator::endFrame()
+    {
+        if (!ring) return;
+
+        FenceHandle fence = nullptr;
+        if (persistent && ring->getFrameBytes() > 0)
+        {
+            fence = sge_glFenceSync(SGE_GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+
+        ring->endFrame(fence);
+    }
+}
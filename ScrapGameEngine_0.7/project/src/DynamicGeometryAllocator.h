@@ -0,0 +1,97 @@
+#pragma once
+#include "RingBufferAllocator.h"
+#include <memory>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct DynamicAllocation
+     * @brief A block of transient vertex memory valid for the current frame.
+     *
+     * Write the vertex data through `data` and reference `bufferId` and `offset`
+     * from a `DrawCommand`.
+     */
+    struct DynamicAllocation
+    {
+        void* data = nullptr;        ///< CPU-writable pointer to the block.
+        unsigned int bufferId = 0;   ///< ID of the vertex buffer holding the block.
+        unsigned int offset = 0;     ///< Byte offset of the block inside the buffer.
+        unsigned int size = 0;       ///< Size of the block in bytes.
+
+        /**
+         * @brief Checks whether the allocation succeeded.
+         * @return True if the block can be written to.
+         */
+        bool isValid() const { return data != nullptr; }
+    };
+
+    /**
+     * @class DynamicGeometryAllocator
+     * @brief Sub-allocates per-frame vertex data from a single ring buffer.
+     *
+     * Dynamic geometry (text quads, batched sprites, debug lines) is written into a
+     * ring buffer instead of creating a new `Mesh` every frame. When the context supports
+     * `GL_ARB_buffer_storage` and `GL_ARB_sync` the buffer is persistently mapped and each
+     * frame is protected by a fence. Otherwise the data is staged on the CPU and uploaded
+     * once per frame after orphaning the buffer.
+     */
+    class DynamicGeometryAllocator
+    {
+    public:
+        DynamicGeometryAllocator() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Creates the ring buffer.
+         * @param capacity Size of the ring buffer in bytes.
+         * @param maxFramesInFlight Number of frames the CPU may run ahead of the GPU.
+         */
+        static void init(unsigned int capacity = 4 * 1024 * 1024, unsigned int maxFramesInFlight = 3);
+
+        /**
+         * @brief Destroys the ring buffer and all fences.
+         */
+        static void shutdown();
+
+        /**
+         * @brief Allocates a block of vertex memory for the current frame.
+         * @param size Size of the block in bytes.
+         * @param alignment Required alignment of the block in bytes.
+         * @return The allocation, invalid if the ring buffer is not initialized or too small.
+         */
+        static DynamicAllocation allocate(unsigned int size, unsigned int alignment = 16);
+
+        /**
+         * @brief Makes the current frame's data visible to the GPU.
+         *
+         * Called by the Renderer before executing draw commands.
+         */
+        static void flush();
+
+        /**
+         * @brief Closes the current frame and fences its allocations.
+         *
+         * Called by the Renderer after all draw commands were issued.
+         */
+        static void endFrame();
+
+        /**
+         * @brief Checks whether the buffer is persistently mapped.
+         * @return True if persistent mapping is in use, false if orphaning is used.
+         */
+        static bool isPersistent() { return persistent; }
+
+        /**
+         * @brief Gets the bookkeeping of the ring buffer.
+         * @return Pointer to the ring buffer allocator, or nullptr if not initialized.
+         */
+        static const RingBufferAllocator* getRing() { return ring.get(); }
+
+    private:
+        static std::unique_ptr<RingBufferAllocator> ring; /**< Backend-independent bookkeeping. */
+        static std::vector<unsigned char> staging;        /**< CPU copy of the buffer used when orphaning. */
+        static unsigned char* mapped;                     /**< Persistently mapped pointer, if any. */
+        static unsigned int bufferId;                     /**< OpenGL buffer ID. */
+        static bool persistent;                           /**< True if the buffer is persistently mapped. */
+    };
+}
@@ -0,0 +1,179 @@
+#include "EventBus.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <algorithm>
+
+using namespace ScrapGameEngine;
+
+std::vector<std::unique_ptr<EventBus::QueueBase>> EventBus::queues;
+std::unordered_map<uint64_t, size_t> EventBus::subscriptionTypes;
+size_t EventBus::typeCount = 0;
+uint64_t EventBus::lastSubscription = 0;
+bool EventBus::dispatching = false;
+std::vector<std::function<void()>> EventBus::jobs;
+std::atomic<size_t> EventBus::nextJob(0);
+std::vector<std::thread> EventBus::workers;
+std::mutex EventBus::mutex;
+std::condition_variable EventBus::wake;
+std::condition_variable EventBus::done;
+uint64_t EventBus::generation = 0;
+size_t EventBus::finishedWorkers = 0;
+bool EventBus::stopping = false;
+
+bool EventBus::unsubscribe(uint64_t id)
+{
+    auto it = subscriptionTypes.find(id);
+    if (it == subscriptionTypes.end())
+    {
+        return false;
+    }
+
+    size_t index = it->second;
+    subscriptionTypes.erase(it);
+    bool found = index < queues.size() && queues[index] && queues[index]->deactivate(id);
+
+    // Removed from the list once no dispatch is walking it
+    if (found && !dispatching)
+    {
+        queues[index]->endDispatch();
+    }
+    return found;
+}
+
+void EventBus::dispatch()
+{
+    SGE_PROFILE_SCOPE("EventBus::dispatch");
+
+    if (dispatching)
+    {
+        SGE_LOG_WARN(FRAMEWORK, "EventBus::dispatch called from a consumer, ignored");
+        return;
+    }
+    dispatching = true;
+
+    size_t eventCount = 0;
+    for (auto& queue : queues)
+    {
+        if (queue) eventCount += queue->beginDispatch();
+    }
+
+    if (eventCount > 0)
+    {
+        for (auto& queue : queues)
+        {
+            if (queue) queue->collectParallel(jobs);
+        }
+
+        // Parallel consumers take the next job until none are left, next to the main thread ones
+        if (!jobs.empty())
+        {
+            if (workers.empty())
+            {
+                unsigned int workerCount = std::min<unsigned int>(MAX_WORKERS, std::max(1u, std::thread::hardware_concurrency()));
+                for (unsigned int i = 0; i < workerCount; ++i)
+                {
+                    workers.emplace_back(&EventBus::workerLoop, generation);
+                }
+            }
+
+            nextJob = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finishedWorkers = 0;
+                generation++;
+            }
+            wake.notify_all();
+        }
+
+        // Consumers may add queues, so walk by index
+        for (size_t i = 0; i < queues.size(); ++i)
+        {
+            if (queues[i]) queues[i]->runSerial();
+        }
+
+        if (!jobs.empty())
+        {
+            runJobs();
+
+            // Every worker must be done with the round before `jobs` is reused
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [] { return finishedWorkers == workers.size(); });
+            jobs.clear();
+        }
+    }
+
+    for (auto& queue : queues)
+    {
+        if (queue) queue->endDispatch();
+    }
+    dispatching = false;
+}
+
+size_t EventBus::getPendingCount()
+{
+    size_t count = 0;
+    for (const auto& queue : queues)
+    {
+        if (queue) count += queue->getPendingCount();
+    }
+    return count;
+}
+
+void EventBus::clear()
+{
+    if (dispatching)
+    {
+        SGE_LOG_WARN(FRAMEWORK, "EventBus::clear called from a consumer, ignored");
+        return;
+    }
+
+    queues.clear();
+    subscriptionTypes.clear();
+    stopWorkers();
+}
+
+void EventBus::workerLoop(uint64_t seen)
+{
+    SGE_PROFILE_THREAD("EventBus Worker");
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&seen] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        runJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finishedWorkers++;
+        }
+        done.notify_one();
+    }
+}
+
+void EventBus::runJobs()
+{
+    for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+    {
+        jobs[i]();
+    }
+}
+
+void EventBus::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+    stopping = false;
+}
@@ -0,0 +1,293 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class EventBus
+     * @brief Queues events by type and delivers them in one batch per frame.
+     *
+     * Publishing only appends the event to its type's queue, so a producer never runs a consumer's
+     * code. The application calls dispatch() once per frame, after the scene updates and before
+     * rendering, and every consumer receives the events of its type as one contiguous batch.
+     * Events published during dispatch are delivered in the next one, and so are consumers
+     * subscribed during dispatch.
+     *
+     * Consumers run on the main thread unless subscribed as parallel. Parallel consumers run on
+     * worker threads while the main thread consumers run, and only get to read the batch: they
+     * must not publish, subscribe or touch engine state. The workers are started by the first
+     * dispatch with a parallel consumer and kept until clear(). Every other function is main
+     * thread only.
+     */
+    class EventBus
+    {
+    public:
+        EventBus() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Queues an event for the next dispatch.
+         * @tparam E The event type.
+         * @param event The event.
+         */
+        template<typename E>
+        static void publish(E event)
+        {
+            getQueue<E>().pending.push_back(std::move(event));
+        }
+
+        /**
+         * @brief Calls a consumer once for every event of a type, on the main thread.
+         * @tparam E The event type.
+         * @param consumer The consumer.
+         * @return The subscription ID.
+         */
+        template<typename E>
+        static uint64_t subscribe(std::function<void(const E&)> consumer)
+        {
+            return subscribeBatch<E>([consumer](const E* events, size_t count)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        consumer(events[i]);
+                    }
+                });
+        }
+
+        /**
+         * @brief Calls a consumer once per dispatch with every event of a type.
+         * @tparam E The event type.
+         * @param consumer The consumer, given the events in publishing order and their count.
+         * @param parallel True to run it on a worker thread, see the class description.
+         * @return The subscription ID.
+         */
+        template<typename E>
+        static uint64_t subscribeBatch(std::function<void(const E*, size_t)> consumer, bool parallel = false)
+        {
+            Queue<E>& queue = getQueue<E>();
+            uint64_t id = ++lastSubscription;
+
+            // A consumer may be running from `consumers`, so growing it now could move that consumer
+            std::vector<typename Queue<E>::Consumer>& list = dispatching ? queue.added : queue.consumers;
+            list.push_back({ id, std::move(consumer), parallel, true });
+            subscriptionTypes[id] = getTypeIndex<E>();
+            return id;
+        }
+
+        /**
+         * @brief Removes a consumer. During dispatch, it receives no further batches.
+         * @param id The subscription ID.
+         * @return False if there is no such subscription.
+         */
+        static bool unsubscribe(uint64_t id);
+
+        /**
+         * @brief Delivers every queued event to its consumers.
+         */
+        static void dispatch();
+
+        /**
+         * @brief Gets the number of events waiting for dispatch.
+         * @return The event count over every type.
+         */
+        static size_t getPendingCount();
+
+        /**
+         * @brief Drops every queued event and every subscription and stops the workers. Not callable from a consumer.
+         */
+        static void clear();
+
+        static constexpr unsigned int MAX_WORKERS = 4;  ///< Upper bound on parallel consumer threads.
+
+    private:
+        /**
+         * @struct QueueBase
+         * @brief The type independent part of a queue.
+         */
+        struct QueueBase
+        {
+            virtual ~QueueBase() = default;
+
+            /** @brief Moves the pending events aside for delivery. @return The number moved. */
+            virtual size_t beginDispatch() = 0;
+            /** @brief Collects a job per active parallel consumer. @param jobs Receives the jobs. */
+            virtual void collectParallel(std::vector<std::function<void()>>& jobs) = 0;
+            /** @brief Runs the main thread consumers over the events being delivered. */
+            virtual void runSerial() = 0;
+            /** @brief Drops the delivered events and the removed consumers, and joins the added ones. */
+            virtual void endDispatch() = 0;
+            /** @brief Marks a consumer removed. @param id The subscription ID. @return False if it is not here. */
+            virtual bool deactivate(uint64_t id) = 0;
+            /** @brief Gets the events waiting for dispatch. @return The count. */
+            virtual size_t getPendingCount() const = 0;
+        };
+
+        /**
+         * @struct Queue
+         * @brief The events and consumers of one type.
+         * @tparam E The event type.
+         */
+        template<typename E>
+        struct Queue : QueueBase
+        {
+            /**
+             * @struct Consumer
+             * @brief A subscription.
+             */
+            struct Consumer
+            {
+                uint64_t id;                                        /**< Subscription ID. */
+                std::function<void(const E*, size_t)> function;     /**< Called with each batch. */
+                bool parallel;                                      /**< Run on a worker thread. */
+                bool active;                                        /**< Cleared by unsubscribe, removed after dispatch. */
+            };
+
+            std::vector<E> pending;             /**< Events published since the last dispatch. */
+            std::vector<E> delivering;          /**< Events of the dispatch in progress. */
+            std::vector<Consumer> consumers;    /**< Subscriptions, in subscribing order. */
+            std::vector<Consumer> added;        /**< Subscribed during dispatch, moved to `consumers` after it. */
+
+            size_t beginDispatch() override
+            {
+                delivering.swap(pending);
+                return delivering.size();
+            }
+
+            void collectParallel(std::vector<std::function<void()>>& jobs) override
+            {
+                if (delivering.empty()) return;
+
+                // Consumers subscribed during dispatch go to `added`, so `consumers` stays put until endDispatch()
+                for (const Consumer& consumer : consumers)
+                {
+                    if (consumer.parallel && consumer.active)
+                    {
+                        const E* events = delivering.data();
+                        size_t count = delivering.size();
+                        const std::function<void(const E*, size_t)>* function = &consumer.function;
+                        jobs.push_back([function, events, count]() { (*function)(events, count); });
+                    }
+                }
+            }
+
+            void runSerial() override
+            {
+                if (delivering.empty()) return;
+
+                for (Consumer& consumer : consumers)
+                {
+                    if (!consumer.parallel && consumer.active)
+                    {
+                        consumer.function(delivering.data(), delivering.size());
+                    }
+                }
+            }
+
+            void endDispatch() override
+            {
+                delivering.clear();
+                consumers.erase(std::remove_if(consumers.begin(), consumers.end(),
+                    [](const Consumer& consumer) { return !consumer.active; }), consumers.end());
+                for (Consumer& consumer : added)
+                {
+                    if (consumer.active) consumers.push_back(std::move(consumer));
+                }
+                added.clear();
+            }
+
+            bool deactivate(uint64_t id) override
+            {
+                for (std::vector<Consumer>* list : { &consumers, &added })
+                {
+                    for (Consumer& consumer : *list)
+                    {
+                        if (consumer.id == id && consumer.active)
+                        {
+                            consumer.active = false;
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            size_t getPendingCount() const override
+            {
+                return pending.size();
+            }
+        };
+
+        /**
+         * @brief Gets the index of an event type, assigned on first use.
+         * @tparam E The event type.
+         * @return The index into `queues`.
+         */
+        template<typename E>
+        static size_t getTypeIndex()
+        {
+            static const size_t index = typeCount++;
+            return index;
+        }
+
+        /**
+         * @brief Gets the queue of an event type, creating it on first use.
+         * @tparam E The event type.
+         * @return The queue.
+         */
+        template<typename E>
+        static Queue<E>& getQueue()
+        {
+            size_t index = getTypeIndex<E>();
+            if (index >= queues.size())
+            {
+                queues.resize(index + 1);
+            }
+            if (!queues[index])
+            {
+                queues[index] = std::make_unique<Queue<E>>();
+            }
+            return static_cast<Queue<E>&>(*queues[index]);
+        }
+
+        /**
+         * @brief Runs the parallel jobs of each dispatch until clear() stops the workers.
+         * @param seen The `generation` when the worker was started.
+         */
+        static void workerLoop(uint64_t seen);
+
+        /**
+         * @brief Takes jobs until none are left. Called by the workers and the main thread.
+         */
+        static void runJobs();
+
+        /**
+         * @brief Wakes the workers and joins them.
+         */
+        static void stopWorkers();
+
+        static std::vector<std::unique_ptr<QueueBase>> queues;          ///< Queues by type index, null until used.
+        static std::unordered_map<uint64_t, size_t> subscriptionTypes;  ///< Type index of every subscription.
+        static size_t typeCount;                                        ///< Type indices handed out.
+        static uint64_t lastSubscription;                               ///< Last subscription ID handed out.
+        static bool dispatching;                                        ///< Whether dispatch() is running.
+        static std::vector<std::function<void()>> jobs;                 ///< Parallel consumers of the dispatch in progress.
+        static std::atomic<size_t> nextJob;                             ///< Next job to take.
+        static std::vector<std::thread> workers;                        ///< Worker threads, started on first use.
+        static std::mutex mutex;                                        ///< Guards the fields below.
+        static std::condition_variable wake;                            ///< Signals workers when `generation` changes.
+        static std::condition_variable done;                            ///< Signals the main thread when a worker finishes a round.
+        static uint64_t generation;                                     ///< Dispatches that had parallel jobs.
+        static size_t finishedWorkers;                                  ///< Workers done with the current round.
+        static bool stopping;                                           ///< Tells the workers to exit.
+    };
+}
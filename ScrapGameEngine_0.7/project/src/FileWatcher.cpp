@@ -0,0 +1,212 @@
+#include "FileWatcher.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <chrono>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace ScrapGameEngine;
+namespace fs = std::filesystem;
+
+// Seconds on a monotonic clock, only used to measure settle times
+static double monotonicSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+FileWatcher::~FileWatcher()
+{
+    stop();
+}
+
+bool FileWatcher::start(const std::string& directory, Callback onChanged, int pollIntervalMs)
+{
+    if (running) return false;
+
+    std::error_code error;
+    if (!fs::is_directory(directory, error))
+    {
+        SGE_LOG_ERROR(FRAMEWORK, "Cannot watch {}, not a directory", directory);
+        return false;
+    }
+
+    this->directory = fs::path(directory).generic_string();
+    while (this->directory.size() > 1 && this->directory.back() == '/')
+    {
+        this->directory.pop_back();
+    }
+    this->callback = std::move(onChanged);
+    this->pollIntervalMs = pollIntervalMs;
+
+    running = true;
+    thread = std::thread(&FileWatcher::run, this);
+    return true;
+}
+
+void FileWatcher::stop()
+{
+    running = false;
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+}
+
+void FileWatcher::run()
+{
+    SGE_PROFILE_THREAD("FileWatcher");
+
+    std::unordered_map<std::string, double> pending;
+    std::vector<std::string> settled;
+
+    bool notify = false;
+#ifdef __linux__
+    notify = openNotify();
+#endif
+    if (!notify)
+    {
+        scanTimestamps(pending, false);
+    }
+    SGE_LOG_INFO(FRAMEWORK, "Watching {} for changes ({})", directory, notify ? "inotify" : "polling");
+
+    while (running)
+    {
+#ifdef __linux__
+        if (notify)
+        {
+            readNotifyEvents(pending);
+        }
+        else
+#endif
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(pollIntervalMs));
+            scanTimestamps(pending, true);
+        }
+
+        // Report the files that have stopped changing
+        double now = monotonicSeconds();
+        settled.clear();
+        for (const auto& entry : pending)
+        {
+            if ((now - entry.second) * 1000.0 >= SETTLE_MS)
+            {
+                settled.push_back(entry.first);
+            }
+        }
+        for (const std::string& path : settled)
+        {
+            pending.erase(path);
+            callback(path);
+        }
+    }
+
+#ifdef __linux__
+    closeNotify();
+#endif
+}
+
+void FileWatcher::scanTimestamps(std::unordered_map<std::string, double>& pending, bool report)
+{
+    std::error_code error;
+    fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error))
+    {
+        if (!it->is_regular_file(error)) continue;
+
+        fs::file_time_type writeTime = it->last_write_time(error);
+        if (error) continue;
+
+        std::string path = it->path().generic_string();
+        auto found = timestamps.find(path);
+        if (found == timestamps.end())
+        {
+            timestamps.emplace(path, writeTime);
+            if (report) pending[path] = monotonicSeconds(); // Created after the watch started
+        }
+        else if (found->second != writeTime)
+        {
+            found->second = writeTime;
+            if (report) pending[path] = monotonicSeconds();
+        }
+    }
+}
+
+#ifdef __linux__
+bool FileWatcher::openNotify()
+{
+    notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (notifyFd < 0)
+    {
+        SGE_LOG_WARN(FRAMEWORK, "inotify unavailable, falling back to polling");
+        return false;
+    }
+
+    addNotifyWatches(directory);
+    return true;
+}
+
+void FileWatcher::addNotifyWatches(const fs::path& root)
+{
+    const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+    int wd = inotify_add_watch(notifyFd, root.c_str(), mask);
+    if (wd >= 0) watchedDirs[wd] = root.generic_string();
+
+    // inotify is not recursive, every subdirectory needs its own watch
+    std::error_code error;
+    fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error))
+    {
+        if (!it->is_directory(error)) continue;
+
+        wd = inotify_add_watch(notifyFd, it->path().c_str(), mask);
+        if (wd >= 0) watchedDirs[wd] = it->path().generic_string();
+    }
+}
+
+void FileWatcher::readNotifyEvents(std::unordered_map<std::string, double>& pending)
+{
+    pollfd descriptor = { notifyFd, POLLIN, 0 };
+    if (poll(&descriptor, 1, pollIntervalMs) <= 0) return;
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(notifyFd, buffer, sizeof(buffer))) > 0)
+    {
+        for (char* p = buffer; p < buffer + length; )
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+            p += sizeof(inotify_event) + event->len;
+
+            auto dir = watchedDirs.find(event->wd);
+            if (dir == watchedDirs.end() || event->len == 0) continue;
+
+            std::string path = dir->second + "/" + event->name;
+            if (event->mask & IN_ISDIR)
+            {
+                // Watch directories created after the watcher started
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) addNotifyWatches(path);
+            }
+            else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+            {
+                pending[path] = monotonicSeconds();
+            }
+        }
+    }
+}
+
+void FileWatcher::closeNotify()
+{
+    if (notifyFd >= 0)
+    {
+        close(notifyFd);
+        notifyFd = -1;
+    }
+    watchedDirs.clear();
+}
+#endif
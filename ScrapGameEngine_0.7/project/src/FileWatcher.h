@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class FileWatcher
+     * @brief Watches a directory tree on a background thread and reports modified files.
+     *
+     * On Linux the watcher is driven by inotify; elsewhere, or if inotify is unavailable, it
+     * polls the modification times of the files. Editors often write a file in several steps,
+     * so a path is only reported once it has stayed unchanged for `SETTLE_MS` milliseconds.
+     *
+     * The callback runs on the watcher thread.
+     */
+    class FileWatcher
+    {
+    public:
+        /**
+         * @typedef Callback
+         * @brief Called with the path of a modified file, using forward slashes.
+         */
+        using Callback = std::function<void(const std::string& path)>;
+
+        static constexpr int SETTLE_MS = 100; ///< Quiet time before a modified file is reported.
+
+        FileWatcher() = default;
+
+        /**
+         * @brief Stops the watcher thread.
+         */
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * @brief Starts watching a directory and its subdirectories.
+         * @param directory The root directory.
+         * @param onChanged Called on the watcher thread for every modified file.
+         * @param pollIntervalMs Interval between checks for changes.
+         * @return False if the directory does not exist or the watcher is already running.
+         */
+        bool start(const std::string& directory, Callback onChanged, int pollIntervalMs = 250);
+
+        /**
+         * @brief Stops watching and joins the thread. Safe to call when not running.
+         */
+        void stop();
+
+        /**
+         * @brief Checks whether the watcher thread is running.
+         * @return True if running.
+         */
+        bool isRunning() const { return running; }
+
+    private:
+        void run();
+
+        /**
+         * @brief Records the modification time of every file, reporting the ones that changed.
+         * @param pending Modified paths with the time they were last seen changing.
+         * @param report False for the first scan, which only takes the baseline.
+         */
+        void scanTimestamps(std::unordered_map<std::string, double>& pending, bool report);
+
+#ifdef __linux__
+        bool openNotify();
+        void addNotifyWatches(const std::filesystem::path& directory);
+        void readNotifyEvents(std::unordered_map<std::string, double>& pending);
+        void closeNotify();
+
+        int notifyFd = -1;                                  ///< inotify instance, -1 when polling.
+        std::unordered_map<int, std::string> watchedDirs;   ///< inotify watch descriptor to directory.
+#endif
+
+        std::string directory;                              ///< Root of the watched tree.
+        Callback callback;                                  ///< Receives modified paths.
+        int pollIntervalMs = 250;                           ///< Interval between checks.
+        std::unordered_map<std::string, std::filesystem::file_time_type> timestamps; ///< Last seen write times, polling only.
+        std::thread thread;                                 ///< The watcher thread.
+        std::atomic<bool> running{ false };                 ///< Cleared to stop the thread.
+    };
+}
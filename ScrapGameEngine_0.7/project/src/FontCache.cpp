@@ -0,0 +1,719 @@
+#include "FontCache.h"
+#include "AssetHotReload.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <glm/common.hpp>
+
+using namespace ScrapGameEngine;
+
+FT_Library FontCache::library = nullptr;
+std::map<std::tuple<std::string, int, bool>, FontCache::Entry> FontCache::fonts;
+uint64_t FontCache::frame = 0;
+GlyphCacheStats FontCache::stats;
+unsigned int FontCache::frameUploadBytes = 0;
+
+namespace
+{
+    // Squared distance transform of one row or column (Felzenszwalb and Huttenlocher).
+    // f holds 0 on feature pixels and infinity elsewhere; d receives the squared distances.
+    void distanceTransform(const float* f, int n, float* d, int* v, float* z)
+    {
+        const float infinity = std::numeric_limits<float>::infinity();
+        int k = 0;
+        v[0] = 0;
+        z[0] = -infinity;
+        z[1] = infinity;
+        for (int q = 1; q < n; ++q)
+        {
+            if (f[q] == infinity) continue;
+            if (f[v[k]] == infinity)
+            {
+                v[k] = q;
+                continue;
+            }
+            float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+            while (s <= z[k])
+            {
+                k--;
+                s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+            }
+            k++;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = infinity;
+        }
+
+        k = 0;
+        for (int q = 0; q < n; ++q)
+        {
+            while (z[k + 1] < q) k++;
+            float offset = static_cast<float>(q - v[k]);
+            d[q] = f[v[k]] == infinity ? infinity : offset * offset + f[v[k]];
+        }
+    }
+
+    // Squared distance from every pixel of a grid to the nearest feature pixel, in place
+    void distanceTransform(std::vector<float>& grid, int width, int height)
+    {
+        const int length = std::max(width, height);
+        std::vector<float> f(length), d(length), z(length + 1);
+        std::vector<int> v(length);
+
+        for (int x = 0; x < width; ++x)
+        {
+            for (int y = 0; y < height; ++y) f[y] = grid[y * width + x];
+            distanceTransform(f.data(), height, d.data(), v.data(), z.data());
+            for (int y = 0; y < height; ++y) grid[y * width + x] = d[y];
+        }
+        for (int y = 0; y < height; ++y)
+        {
+            float* row = &grid[y * width];
+            std::copy(row, row + width, f.begin());
+            distanceTransform(f.data(), width, d.data(), v.data(), z.data());
+            std::copy(d.begin(), d.begin() + width, row);
+        }
+    }
+}
+
+Font* FontCache::getFont(const std::string& path, int pixelSize, bool distanceField)
+{
+    auto key = std::make_tuple(path, pixelSize, distanceField);
+    auto it = fonts.find(key);
+    if (it != fonts.end())
+    {
+        it->second.references++;
+        return it->second.font.get();
+    }
+
+    if (!library && FT_Init_FreeType(&library))
+    {
+        SGE_LOG_ERROR(TEXT, "Could not initialize FreeType library");
+        library = nullptr;
+        return nullptr;
+    }
+
+    auto font = std::make_unique<Font>();
+    font->path = path;
+    font->pixelSize = pixelSize;
+    font->distanceField = distanceField;
+    if (!rasterize(*font))
+    {
+        return nullptr;
+    }
+
+    Entry& entry = fonts[key];
+    entry.font = std::move(font);
+    entry.references = 1;
+
+    // Rebuild the glyphs and atlas in place, text keeps its Font pointer
+    Font* cached = entry.font.get();
+    entry.listener = AssetHotReload::addListener(path, [cached](const std::string&)
+        {
+            rasterize(*cached);
+        });
+    return cached;
+}
+
+void FontCache::returnFont(Font* font)
+{
+    if (!font) return;
+
+    auto it = fonts.find(std::make_tuple(font->path, font->pixelSize, font->distanceField));
+    if (it == fonts.end() || it->second.font.get() != font)
+    {
+        SGE_LOG_ERROR(TEXT, "Error: Font not found in the cache when returning.");
+        return;
+    }
+    it->second.references--;
+}
+
+void FontCache::releaseUnusedFonts()
+{
+    for (auto it = fonts.begin(); it != fonts.end();)
+    {
+        if (it->second.references <= 0)
+        {
+            AssetHotReload::removeListener(it->second.listener);
+            it = fonts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void FontCache::shutdown()
+{
+    size_t referenced = 0;
+    for (auto& pair : fonts)
+    {
+        if (pair.second.references > 0) referenced++;
+        AssetHotReload::removeListener(pair.second.listener);
+    }
+    if (referenced > 0)
+    {
+        SGE_LOG_WARN(TEXT, "{} fonts were still referenced at shutdown", referenced);
+    }
+    fonts.clear();
+
+    if (library)
+    {
+        FT_Done_FreeType(library);
+        library = nullptr;
+    }
+}
+
+void FontCache::beginFrame()
+{
+    frame++;
+
+    for (auto& pair : fonts)
+    {
+        Font& font = *pair.second.font;
+        if (font.censusFrame != 0)
+        {
+            // Every text laid out again last frame, glyphs not used since are safe to drop
+            size_t before = font.glyphs.size();
+            repack(font, font.image.width, font.censusFrame);
+            font.censusFrame = 0;
+            SGE_LOG_DEBUG(TEXT, "Evicted {} glyphs of {} at {} px", before - font.glyphs.size(), font.path, font.pixelSize);
+            if (font.needsSpace)
+            {
+                SGE_LOG_WARN(TEXT, "The {}x{} atlas of {} cannot hold the glyphs in use", font.image.width, font.image.height, font.path);
+                font.needsSpace = false; // Retried when another glyph misses
+            }
+        }
+        else if (font.needsSpace)
+        {
+            if (font.image.width < Font::MAX_ATLAS_SIZE)
+            {
+                repack(font, font.image.width * 2, 0);
+                SGE_LOG_DEBUG(TEXT, "Grew the atlas of {} at {} px to {}x{}", font.path, font.pixelSize, font.image.width, font.image.height);
+            }
+            else
+            {
+                // Text only looks glyphs up when it lays out, so make every text lay out this frame
+                font.censusFrame = frame;
+                font.generation++;
+            }
+        }
+    }
+}
+
+void FontCache::flush()
+{
+    SGE_PROFILE_SCOPE("FontCache::flush");
+
+    for (auto& pair : fonts)
+    {
+        Font& font = *pair.second.font;
+        if (font.dirtyRects.empty()) continue;
+
+        // Many small uploads cost more than one covering them
+        if (font.dirtyRects.size() > MAX_DIRTY_RECTS)
+        {
+            glm::ivec2 min(font.image.width, font.image.height);
+            glm::ivec2 max(0, 0);
+            for (const glm::ivec4& rect : font.dirtyRects)
+            {
+                min = glm::min(min, glm::ivec2(rect.x, rect.y));
+                max = glm::max(max, glm::ivec2(rect.x + rect.z, rect.y + rect.w));
+            }
+            font.dirtyRects.assign(1, glm::ivec4(min, max - min));
+        }
+
+        for (const glm::ivec4& rect : font.dirtyRects)
+        {
+            font.atlas->updateRegion(font.image, rect.x, rect.y, rect.z, rect.w);
+            frameUploadBytes += static_cast<unsigned int>(rect.z * rect.w * font.image.channels);
+        }
+        font.dirtyRects.clear();
+    }
+
+    stats.frameUploadedBytes = frameUploadBytes;
+    stats.uploadedBytes += frameUploadBytes;
+    frameUploadBytes = 0;
+}
+
+Font::~Font()
+{
+    if (face) FT_Done_Face(face);
+}
+
+const Glyph* Font::getGlyph(uint32_t codepoint)
+{
+    return FontCache::findGlyph(*this, codepoint);
+}
+
+const Glyph* FontCache::findGlyph(Font& font, uint32_t codepoint)
+{
+    stats.lookups++;
+    auto it = font.glyphs.find(codepoint);
+    if (it != font.glyphs.end())
+    {
+        it->second.lastUsed = frame;
+        return &it->second.glyph;
+    }
+
+    SGE_PROFILE_SCOPE("FontCache::findGlyph miss");
+    stats.misses++;
+
+    std::vector<Glyph> metrics(1);
+    std::vector<Font::Bitmap> bitmaps(1);
+    if (!loadGlyph(font, codepoint, metrics[0], bitmaps[0])) return nullptr;
+    if (font.distanceField)
+    {
+        generateDistanceFields(metrics, bitmaps);
+    }
+
+    Font::CachedGlyph& cached = font.glyphs[codepoint];
+    cached.glyph = metrics[0];
+    cached.extent = glm::ivec2(bitmaps[0].width, bitmaps[0].rows);
+    cached.lastUsed = frame;
+    place(font, cached, std::move(bitmaps[0]));
+    return &cached.glyph;
+}
+
+bool FontCache::rasterize(Font& font)
+{
+    SGE_PROFILE_SCOPE("FontCache::rasterize");
+
+    if (font.face)
+    {
+        FT_Done_Face(font.face);
+        font.face = nullptr;
+    }
+    if (FT_New_Face(library, font.path.c_str(), 0, &font.face))
+    {
+        SGE_LOG_ERROR(TEXT, "Failed to load font: {}", font.path);
+        font.face = nullptr;
+        return false;
+    }
+
+    // Distance fields measure the outline at a higher resolution than they are stored at
+    const int oversample = font.distanceField ? Font::DISTANCE_FIELD_OVERSAMPLE : 1;
+    FT_Set_Pixel_Sizes(font.face, 0, font.pixelSize * oversample);
+    const FT_Size_Metrics& sizeMetrics = font.face->size->metrics;
+    font.lineHeight = sizeMetrics.height > 0 ? static_cast<float>(sizeMetrics.height >> 6) / oversample : static_cast<float>(font.pixelSize);
+
+    std::vector<uint32_t> codepoints;
+    std::vector<Glyph> metrics;
+    std::vector<Font::Bitmap> bitmaps;
+    for (uint32_t c = Font::FIRST_CHARACTER; c <= Font::LAST_CHARACTER; ++c)
+    {
+        Glyph glyph{};
+        Font::Bitmap bitmap;
+        if (!loadGlyph(font, c, glyph, bitmap)) continue;
+        codepoints.push_back(c);
+        metrics.push_back(glyph);
+        bitmaps.push_back(std::move(bitmap));
+    }
+
+    if (font.distanceField)
+    {
+        generateDistanceFields(metrics, bitmaps);
+    }
+
+    // Leave as much room again for glyphs added later
+    size_t area = 0;
+    for (const Font::Bitmap& bitmap : bitmaps)
+    {
+        area += static_cast<size_t>(bitmap.width + 1) * (bitmap.rows + 1);
+    }
+    int atlasSize = Font::MIN_ATLAS_SIZE;
+    while (atlasSize < Font::MAX_ATLAS_SIZE && static_cast<size_t>(atlasSize) * atlasSize < area * 2) atlasSize *= 2;
+
+    // Tallest first, the skyline wastes the least space that way
+    std::vector<size_t> order(codepoints.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&bitmaps](size_t a, size_t b) { return bitmaps[a].rows > bitmaps[b].rows; });
+
+    for (;;)
+    {
+        resetAtlas(font, atlasSize);
+        font.glyphs.clear();
+        font.needsSpace = false;
+        font.censusFrame = 0;
+
+        for (size_t i : order)
+        {
+            Font::CachedGlyph& cached = font.glyphs[codepoints[i]];
+            cached.glyph = metrics[i];
+            cached.extent = glm::ivec2(bitmaps[i].width, bitmaps[i].rows);
+            cached.lastUsed = frame;
+            Font::Bitmap copy = bitmaps[i];
+            place(font, cached, std::move(copy));
+        }
+
+        if (!font.needsSpace || atlasSize >= Font::MAX_ATLAS_SIZE) break;
+        atlasSize *= 2;
+    }
+
+    font.dirtyRects.clear();
+    uploadAtlas(font);
+    font.generation++;
+
+    SGE_LOG_DEBUG(TEXT, "Rasterized {} at {} px into a {}x{} {} atlas", font.path, font.pixelSize, atlasSize, atlasSize,
+        (font.distanceField ? "distance field" : "coverage"));
+    return true;
+}
+
+bool FontCache::loadGlyph(Font& font, uint32_t codepoint, Glyph& glyph, Font::Bitmap& bitmap)
+{
+    if (FT_Load_Char(font.face, codepoint, FT_LOAD_RENDER))
+    {
+        SGE_LOG_ERROR(TEXT, "Failed to load character: {}", codepoint);
+        return false;
+    }
+
+    // The glyph slot is reused by every FT_Load_Char, keep a copy of the bitmap
+    const FT_GlyphSlot slot = font.face->glyph;
+    bitmap.width = static_cast<int>(slot->bitmap.width);
+    bitmap.rows = static_cast<int>(slot->bitmap.rows);
+    bitmap.coverage.clear();
+    for (int y = 0; y < bitmap.rows; ++y)
+    {
+        const unsigned char* row = slot->bitmap.buffer + y * slot->bitmap.pitch;
+        bitmap.coverage.insert(bitmap.coverage.end(), row, row + bitmap.width);
+    }
+
+    const float pixelsPerUnit = 1.0f / (font.distanceField ? Font::DISTANCE_FIELD_OVERSAMPLE : 1);
+    glyph.size = glm::vec2(bitmap.width, bitmap.rows) * pixelsPerUnit;
+    glyph.advance = glm::vec2(static_cast<float>(slot->advance.x >> 6), static_cast<float>(slot->advance.y >> 6)) * pixelsPerUnit;
+    glyph.offset = glm::vec2(slot->bitmap_left, slot->bitmap_top) * pixelsPerUnit;
+    return true;
+}
+
+bool FontCache::place(Font& font, Font::CachedGlyph& cached, Font::Bitmap&& bitmap)
+{
+    const int atlasSize = font.image.width;
+    if (cached.extent.x == 0 || cached.extent.y == 0)
+    {
+        // Blank, only the advance matters
+        cached.resident = true;
+        cached.glyph.size = glm::vec2(0.0f);
+        return true;
+    }
+
+    // One texel of padding right and below keeps filtering from bleeding into the neighbours
+    glm::ivec2 origin;
+    if (!allocate(font, cached.extent.x + 1, cached.extent.y + 1, origin))
+    {
+        cached.resident = false;
+        cached.glyph.size = glm::vec2(0.0f);
+        cached.pending = std::move(bitmap);
+        font.needsSpace = true;
+        return false;
+    }
+
+    // White texels with the coverage or distance as alpha, so the tint colors the text
+    for (int y = 0; y < cached.extent.y; ++y)
+    {
+        unsigned char* texel = &font.image.pixels[(static_cast<size_t>(origin.y + y) * atlasSize + origin.x) * 4];
+        const unsigned char* coverage = &bitmap.coverage[static_cast<size_t>(y) * cached.extent.x];
+        for (int x = 0; x < cached.extent.x; ++x, texel += 4)
+        {
+            texel[3] = coverage[x];
+        }
+    }
+    font.dirtyRects.push_back(glm::ivec4(origin, cached.extent));
+
+    cached.origin = origin;
+    cached.resident = true;
+    cached.pending = Font::Bitmap();
+    cached.glyph.size = glm::vec2(cached.extent);
+    cached.glyph.textureCoords = glm::vec2(origin) / static_cast<float>(atlasSize);
+    cached.glyph.textureSize = glm::vec2(cached.extent) / static_cast<float>(atlasSize);
+    return true;
+}
+
+bool FontCache::allocate(Font& font, int width, int height, glm::ivec2& origin)
+{
+    std::vector<Font::SkylineNode>& skyline = font.skyline;
+    const int atlasSize = font.image.width;
+
+    // Bottom-left rule: the lowest resting place, the narrowest segment on ties
+    size_t best = skyline.size();
+    int bestY = atlasSize;
+    int bestWidth = atlasSize + 1;
+    for (size_t i = 0; i < skyline.size(); ++i)
+    {
+        const int x = skyline[i].x;
+        if (x + width > atlasSize) break;
+
+        // The rectangle rests on the highest segment under it
+        int y = 0;
+        int covered = 0;
+        for (size_t j = i; covered < width; ++j)
+        {
+            y = std::max(y, skyline[j].y);
+            covered += skyline[j].width;
+        }
+        if (y + height > atlasSize) continue;
+
+        if (y < bestY || (y == bestY && skyline[i].width < bestWidth))
+        {
+            best = i;
+            bestY = y;
+            bestWidth = skyline[i].width;
+        }
+    }
+    if (best == skyline.size()) return false;
+
+    origin = glm::ivec2(skyline[best].x, bestY);
+    Font::SkylineNode node{ origin.x, bestY + height, width };
+    skyline.insert(skyline.begin() + best, node);
+
+    // Trim the segments now under the new one
+    for (size_t i = best + 1; i < skyline.size();)
+    {
+        const int end = skyline[i - 1].x + skyline[i - 1].width;
+        if (skyline[i].x >= end) break;
+
+        const int shrink = end - skyline[i].x;
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+        if (skyline[i].width > 0) break;
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return true;
+}
+
+void FontCache::repack(Font& font, int atlasSize, uint64_t liveSince)
+{
+    SGE_PROFILE_SCOPE("FontCache::repack");
+
+    struct Candidate
+    {
+        uint32_t codepoint;
+        Font::CachedGlyph* cached;
+        bool live;
+    };
+    std::vector<Candidate> candidates;
+    for (auto& pair : font.glyphs)
+    {
+        Font::CachedGlyph& cached = pair.second;
+        if (cached.extent.x == 0 || cached.extent.y == 0) continue;
+        candidates.push_back({ pair.first, &cached, cached.lastUsed >= liveSince });
+    }
+
+    // Glyphs in use first, then the most recently used
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b)
+        {
+            if (a.live != b.live) return a.live;
+            return a.cached->lastUsed > b.cached->lastUsed;
+        });
+
+    // Unused glyphs only fill part of the atlas, the rest is room for new ones
+    const size_t budget = static_cast<size_t>(static_cast<float>(atlasSize) * atlasSize * REPACK_FILL);
+    size_t used = 0;
+    std::vector<Candidate> kept;
+    std::vector<uint32_t> evicted;
+    for (const Candidate& candidate : candidates)
+    {
+        const size_t area = static_cast<size_t>(candidate.cached->extent.x + 1) * (candidate.cached->extent.y + 1);
+        if (!candidate.live && used + area > budget)
+        {
+            evicted.push_back(candidate.codepoint);
+            continue;
+        }
+        used += area;
+        kept.push_back(candidate);
+    }
+
+    // Take the kept pixels out of the old atlas before it is cleared
+    for (const Candidate& candidate : kept)
+    {
+        Font::CachedGlyph& cached = *candidate.cached;
+        if (!cached.resident) continue;
+
+        Font::Bitmap& bitmap = cached.pending;
+        bitmap.width = cached.extent.x;
+        bitmap.rows = cached.extent.y;
+        bitmap.coverage.resize(static_cast<size_t>(bitmap.width) * bitmap.rows);
+        for (int y = 0; y < bitmap.rows; ++y)
+        {
+            const unsigned char* texel = &font.image.pixels[(static_cast<size_t>(cached.origin.y + y) * font.image.width + cached.origin.x) * 4];
+            for (int x = 0; x < bitmap.width; ++x, texel += 4)
+            {
+                bitmap.coverage[static_cast<size_t>(y) * bitmap.width + x] = texel[3];
+            }
+        }
+        cached.resident = false;
+    }
+
+    resetAtlas(font, atlasSize);
+    font.needsSpace = false;
+
+    std::stable_sort(kept.begin(), kept.end(), [](const Candidate& a, const Candidate& b) { return a.cached->extent.y > b.cached->extent.y; });
+    for (const Candidate& candidate : kept)
+    {
+        Font::Bitmap bitmap = std::move(candidate.cached->pending);
+        if (place(font, *candidate.cached, std::move(bitmap)) || candidate.live) continue;
+        evicted.push_back(candidate.codepoint);
+    }
+
+    for (uint32_t codepoint : evicted)
+    {
+        font.glyphs.erase(codepoint);
+    }
+    stats.evictions += evicted.size();
+
+    // Only glyphs in use can still be waiting
+    font.needsSpace = false;
+    for (const auto& pair : font.glyphs)
+    {
+        if (!pair.second.resident) font.needsSpace = true;
+    }
+
+    font.dirtyRects.clear();
+    uploadAtlas(font);
+    font.generation++;
+}
+
+void FontCache::resetAtlas(Font& font, int atlasSize)
+{
+    // White everywhere, so filtering at glyph edges does not pull in dark texels
+    font.image.width = atlasSize;
+    font.image.height = atlasSize;
+    font.image.channels = 4;
+    font.image.pixels.assign(static_cast<size_t>(atlasSize) * atlasSize * 4, 255);
+    for (size_t i = 3; i < font.image.pixels.size(); i += 4)
+    {
+        font.image.pixels[i] = 0;
+    }
+    font.skyline.assign(1, Font::SkylineNode{ 0, 0, atlasSize });
+}
+
+void FontCache::uploadAtlas(Font& font)
+{
+    frameUploadBytes += static_cast<unsigned int>(font.image.pixels.size());
+    if (font.atlas)
+    {
+        // Same texture object, text keeps drawing with it
+        font.atlas->reload(font.image);
+        return;
+    }
+
+    TextureConfig cfg{};
+    cfg.wrapModeX = TextureWrapMode::CLAMP;
+    cfg.wrapModeY = TextureWrapMode::CLAMP;
+    cfg.filterMode = TextureFilterMode::LINEAR;
+    cfg.generateMipmaps = false;
+
+    TextureData data{};
+    data.isBaked = false;
+    data.image = font.image;
+
+    std::string atlasName = font.path + "@" + std::to_string(font.pixelSize) + (font.distanceField ? "sdf" : "");
+    font.atlas.reset(Texture2D::createTexture(atlasName, cfg, data));
+}
+
+void FontCache::generateDistanceFields(std::vector<Glyph>& glyphs, std::vector<Font::Bitmap>& bitmaps)
+{
+    SGE_PROFILE_SCOPE("FontCache::generateDistanceFields");
+    auto start = std::chrono::steady_clock::now();
+
+    // Glyphs are independent, workers take the next one until none are left
+    std::atomic<size_t> next(0);
+    auto work = [&]()
+        {
+            for (size_t i = next++; i < bitmaps.size(); i = next++)
+            {
+                bitmaps[i] = buildDistanceField(bitmaps[i]);
+            }
+        };
+
+    unsigned int workerCount = std::min<unsigned int>(MAX_WORKERS, std::max(1u, std::thread::hardware_concurrency()));
+    workerCount = std::min<unsigned int>(workerCount, static_cast<unsigned int>(std::max<size_t>(1, bitmaps.size())));
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < workerCount; ++i)
+    {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    // The fields are padded by the spread, move the quads out to match
+    const float spread = static_cast<float>(Font::DISTANCE_FIELD_SPREAD);
+    for (size_t i = 0; i < glyphs.size(); ++i)
+    {
+        glyphs[i].size = glm::vec2(bitmaps[i].width, bitmaps[i].rows);
+        if (bitmaps[i].width > 0) glyphs[i].offset += glm::vec2(-spread, spread);
+    }
+
+    if (bitmaps.size() > 1)
+    {
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        SGE_LOG_DEBUG(TEXT, "Built {} distance fields on {} threads in {} ms", bitmaps.size(), workerCount, elapsedMs);
+    }
+}
+
+Font::Bitmap FontCache::buildDistanceField(const Font::Bitmap& outline)
+{
+    Font::Bitmap field;
+    if (outline.width == 0 || outline.rows == 0) return field;
+
+    const int oversample = Font::DISTANCE_FIELD_OVERSAMPLE;
+    const int spread = Font::DISTANCE_FIELD_SPREAD;
+    field.width = (outline.width + oversample - 1) / oversample + 2 * spread;
+    field.rows = (outline.rows + oversample - 1) / oversample + 2 * spread;
+
+    // The outline sits in a grid covering the padded field, one cell per oversampled pixel
+    const int gridWidth = field.width * oversample;
+    const int gridHeight = field.rows * oversample;
+    const int margin = spread * oversample;
+    const float infinity = std::numeric_limits<float>::infinity();
+    std::vector<float> toInside(static_cast<size_t>(gridWidth) * gridHeight, infinity);
+    std::vector<float> toOutside(toInside.size(), 0.0f);
+    for (int y = 0; y < outline.rows; ++y)
+    {
+        for (int x = 0; x < outline.width; ++x)
+        {
+            if (outline.coverage[y * outline.width + x] < 128) continue;
+            size_t cell = static_cast<size_t>(y + margin) * gridWidth + x + margin;
+            toInside[cell] = 0.0f;
+            toOutside[cell] = infinity;
+        }
+    }
+    distanceTransform(toInside, gridWidth, gridHeight);
+    distanceTransform(toOutside, gridWidth, gridHeight);
+
+    // Sample the middle of each field pixel, 0.5 alpha on the outline
+    field.coverage.resize(static_cast<size_t>(field.width) * field.rows);
+    for (int y = 0; y < field.rows; ++y)
+    {
+        for (int x = 0; x < field.width; ++x)
+        {
+            size_t cell = static_cast<size_t>(y * oversample + oversample / 2) * gridWidth + x * oversample + oversample / 2;
+            float distance = toInside[cell] > 0.0f ? -(std::sqrt(toInside[cell]) - 0.5f) : std::sqrt(toOutside[cell]) - 0.5f;
+            float value = 0.5f + distance / (oversample * 2.0f * spread);
+            field.coverage[y * field.width + x] = static_cast<unsigned char>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+    }
+    return field;
+}
@@ -0,0 +1,352 @@
+#pragma once
+#include "Texture2D.h"
+#include "TextureProcessing.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+#include <ft2build.h>
+
+#include FT_FREETYPE_H
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct Glyph
+     * @brief Represents a character glyph in the texture atlas.
+     *
+     * This structure holds information about a character glyph, including its
+     * size, texture coordinates, advance, and offset.
+     */
+    struct Glyph
+    {
+        glm::vec2 textureCoords; ///< Texture coordinates of the glyph's top-left corner in the atlas
+        glm::vec2 textureSize;   ///< Extent of the glyph in texture coordinates
+        glm::vec2 size;          ///< Size of the glyph in pixels (width, height), zero while it waits for atlas space
+        glm::vec2 advance;       ///< The distance to move to the next glyph, in pixels
+        glm::vec2 offset;        ///< Offset from the pen position to the glyph's top-left corner, in pixels
+    };
+
+    /**
+     * @struct GlyphCacheStats
+     * @brief Glyph lookups and atlas traffic gathered by the FontCache.
+     */
+    struct GlyphCacheStats
+    {
+        unsigned long long lookups = 0;         /**< Glyphs requested by text layouts. */
+        unsigned long long misses = 0;          /**< Lookups that had to rasterize the glyph. */
+        unsigned long long evictions = 0;       /**< Glyphs dropped from full atlases. */
+        unsigned long long uploadedBytes = 0;   /**< Atlas bytes sent to the GPU since the last reset. */
+        unsigned int frameUploadedBytes = 0;    /**< Atlas bytes sent to the GPU by the last flush. */
+    };
+
+    /**
+     * @class Font
+     * @brief A font face rasterized at one pixel size into a glyph atlas.
+     *
+     * Fonts are created and owned by the `FontCache`; components hold a reference from
+     * FontCache::getFont() and draw with the atlas and glyph metrics.
+     *
+     * Printable ASCII is rasterized up front. Any other code point is rasterized the first
+     * time it is looked up and packed into the free space of the atlas; the new texels
+     * reach the GPU at the next FontCache::flush().
+     *
+     * A distance field font stores, instead of coverage, the distance to the glyph outline
+     * mapped so that 0.5 alpha is the edge. One such atlas stays sharp at any scale when
+     * drawn with `RenderParams::distanceField`.
+     */
+    class Font
+    {
+    public:
+        static constexpr uint32_t FIRST_CHARACTER = 32;    ///< First character rasterized up front (space).
+        static constexpr uint32_t LAST_CHARACTER = 126;    ///< Last character rasterized up front (tilde).
+        static constexpr int DISTANCE_FIELD_SPREAD = 4;     ///< Distance in atlas pixels mapped from 0.5 to 0 and 1 alpha.
+        static constexpr int DISTANCE_FIELD_OVERSAMPLE = 4; ///< Outline resolution used to measure distances, per atlas pixel.
+        static constexpr int MIN_ATLAS_SIZE = 128;          ///< Smallest atlas side in pixels.
+        static constexpr int MAX_ATLAS_SIZE = 2048;         ///< Atlases grow up to this side, then evict glyphs.
+
+        /**
+         * @brief Closes the font face.
+         */
+        ~Font();
+
+        /**
+         * @brief Gets the glyph of a code point, rasterizing it on first use.
+         * @param codepoint The Unicode code point.
+         * @return The glyph, or null if the font could not load it. Its size is zero while it waits for atlas space.
+         */
+        const Glyph* getGlyph(uint32_t codepoint);
+
+        /**
+         * @brief Gets the glyph atlas. White, with the coverage in the alpha channel.
+         * @return The atlas texture.
+         */
+        Texture2D* getAtlas() const { return atlas.get(); }
+
+        /**
+         * @brief Gets the pixel size the glyphs were rasterized at.
+         * @return The pixel size.
+         */
+        int getPixelSize() const { return pixelSize; }
+
+        /**
+         * @brief Gets the distance between two baselines.
+         * @return The line height in pixels.
+         */
+        float getLineHeight() const { return lineHeight; }
+
+        /**
+         * @brief Gets the font file.
+         * @return The path the font was loaded from.
+         */
+        const std::string& getPath() const { return path; }
+
+        /**
+         * @brief Gets how many times glyphs moved in the atlas, so layouts can tell they are stale.
+         * @return The number of rebuilds, incremented by hot reloads, growth and evictions.
+         */
+        uint32_t getGeneration() const { return generation; }
+
+        /**
+         * @brief Checks whether the atlas holds distances rather than coverage.
+         * @return True for a distance field font.
+         */
+        bool isDistanceField() const { return distanceField; }
+
+        /**
+         * @brief Gets the number of cached glyphs.
+         * @return The glyphs in the atlas or waiting for space.
+         */
+        size_t getGlyphCount() const { return glyphs.size(); }
+
+    private:
+        friend class FontCache;
+
+        /**
+         * @struct Bitmap
+         * @brief A copy of one glyph's pixels, the FreeType glyph slot is reused by every load.
+         */
+        struct Bitmap
+        {
+            int width = 0;                          ///< Width in pixels.
+            int rows = 0;                           ///< Height in pixels.
+            std::vector<unsigned char> coverage;    ///< Coverage or distance, one byte per pixel, rows top to bottom.
+        };
+
+        /**
+         * @struct CachedGlyph
+         * @brief A glyph and where its pixels are.
+         */
+        struct CachedGlyph
+        {
+            Glyph glyph{};                  ///< Metrics handed to text.
+            glm::ivec2 origin{ 0, 0 };      ///< Top left texel in the atlas.
+            glm::ivec2 extent{ 0, 0 };      ///< Size in texels, zero for blank glyphs.
+            bool resident = false;          ///< Whether the pixels are in the atlas.
+            Bitmap pending;                 ///< Pixels kept until the atlas has room.
+            uint64_t lastUsed = 0;          ///< FontCache frame of the last lookup.
+        };
+
+        /**
+         * @struct SkylineNode
+         * @brief One horizontal segment of the top of the packed area.
+         */
+        struct SkylineNode
+        {
+            int x;      ///< Left column.
+            int y;      ///< First free row below the packed glyphs.
+            int width;  ///< Width in pixels.
+        };
+
+        std::string path;                                   ///< Font file.
+        int pixelSize = 0;                                  ///< Rasterized pixel size.
+        bool distanceField = false;                         ///< Whether the atlas holds distances.
+        float lineHeight = 0.0f;                            ///< Baseline to baseline distance in pixels.
+        uint32_t generation = 0;                            ///< Rebuilds so far.
+        FT_Face face = nullptr;                             ///< Open face, used to rasterize glyphs on demand.
+        std::unordered_map<uint32_t, CachedGlyph> glyphs;   ///< Glyphs by code point.
+        std::vector<SkylineNode> skyline;                   ///< Packed area of the atlas, left to right.
+        TextureImage image;                                 ///< CPU copy of the atlas.
+        std::vector<glm::ivec4> dirtyRects;                 ///< Rectangles (x, y, width, height) changed since the last flush.
+        bool needsSpace = false;                            ///< A glyph is waiting for atlas space.
+        uint64_t censusFrame = 0;                           ///< Frame in which every text relaid out before an eviction, or 0.
+        std::unique_ptr<Texture2D> atlas;                   ///< Glyph atlas.
+    };
+
+    /**
+     * @class FontCache
+     * @brief Loads each (font file, pixel size) once and shares it between all text.
+     *
+     * The first request rasterizes printable ASCII with a single FreeType library into an
+     * atlas with room to spare, later requests only add a reference. Other glyphs are added
+     * on demand with a skyline packer. A full atlas doubles in size up to `MAX_ATLAS_SIZE`;
+     * past that, the glyphs no text has used for longest are evicted. Fonts are rebuilt in
+     * place when their file changes on disk. Main thread only.
+     */
+    class FontCache
+    {
+    public:
+        FontCache() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Gets a font, loading it if needed, and adds a reference.
+         * @param path The font file.
+         * @param pixelSize The pixel size to rasterize at. For a distance field, the size the atlas is stored at.
+         * @param distanceField Whether to build a distance field atlas instead of a coverage atlas.
+         * @return The font, or null if it could not be loaded.
+         */
+        static Font* getFont(const std::string& path, int pixelSize, bool distanceField = false);
+
+        /**
+         * @brief Drops a reference to a font. Unused fonts are kept until releaseUnusedFonts().
+         * @param font The font obtained from getFont().
+         */
+        static void returnFont(Font* font);
+
+        /**
+         * @brief Deletes every font that is no longer referenced.
+         */
+        static void releaseUnusedFonts();
+
+        /**
+         * @brief Deletes every font and closes FreeType, reporting the ones still referenced.
+         */
+        static void shutdown();
+
+        /**
+         * @brief Starts a frame: grows or evicts from atlases that ran out of space. Call before any text renders.
+         */
+        static void beginFrame();
+
+        /**
+         * @brief Uploads the atlas rectangles changed this frame. Call after text renders, before the draws execute.
+         */
+        static void flush();
+
+        /**
+         * @brief Gets the number of loaded fonts.
+         * @return The number of (file, pixel size, kind) entries in the cache.
+         */
+        static size_t getFontCount() { return fonts.size(); }
+
+        /**
+         * @brief Gets the glyph statistics.
+         * @return The statistics gathered since the last reset.
+         */
+        static const GlyphCacheStats& getStats() { return stats; }
+
+        /**
+         * @brief Resets the glyph statistics.
+         */
+        static void resetStats() { stats = GlyphCacheStats(); }
+
+    private:
+        friend class Font;
+
+        static constexpr unsigned int MAX_WORKERS = 4;  ///< Upper bound on distance field threads.
+        static constexpr int MAX_DIRTY_RECTS = 16;      ///< Beyond this, a flush uploads the rectangle around them all.
+        static constexpr float REPACK_FILL = 0.75f;     ///< Share of an evicting atlas that unused glyphs may keep.
+
+        /**
+         * @struct Entry
+         * @brief A cached font and its users.
+         */
+        struct Entry
+        {
+            std::unique_ptr<Font> font;     ///< The font.
+            int references = 0;             ///< Outstanding getFont() calls.
+            uint64_t listener = 0;          ///< Hot reload listener of the font file.
+        };
+
+        /**
+         * @brief Opens the face and rasterizes printable ASCII into a new atlas.
+         * @param font The font to fill. Its path, pixel size and kind must be set.
+         * @return False if FreeType could not load the face.
+         */
+        static bool rasterize(Font& font);
+
+        /**
+         * @brief Rasterizes one glyph.
+         * @param font The font, with its face open.
+         * @param codepoint The code point.
+         * @param glyph Receives the metrics, in atlas pixels.
+         * @param bitmap Receives the pixels, oversampled for a distance field.
+         * @return False if FreeType could not load the glyph.
+         */
+        static bool loadGlyph(Font& font, uint32_t codepoint, Glyph& glyph, Font::Bitmap& bitmap);
+
+        /**
+         * @brief Looks a glyph up, rasterizing and packing it on a miss.
+         * @param font The font.
+         * @param codepoint The code point.
+         * @return The glyph, or null if it could not be loaded.
+         */
+        static const Glyph* findGlyph(Font& font, uint32_t codepoint);
+
+        /**
+         * @brief Packs a glyph into the atlas, or keeps its pixels until there is room.
+         * @param font The font.
+         * @param cached The glyph, its extent set.
+         * @param bitmap Its pixels.
+         * @return False if the atlas is full.
+         */
+        static bool place(Font& font, Font::CachedGlyph& cached, Font::Bitmap&& bitmap);
+
+        /**
+         * @brief Finds room for a rectangle with the skyline bottom-left rule.
+         * @param font The font.
+         * @param width Width in pixels, padding included.
+         * @param height Height in pixels, padding included.
+         * @param origin Receives the top left corner.
+         * @return False if the rectangle does not fit.
+         */
+        static bool allocate(Font& font, int width, int height, glm::ivec2& origin);
+
+        /**
+         * @brief Rebuilds the atlas, packing the glyphs used since a frame first.
+         * @param font The font.
+         * @param atlasSize Side of the new atlas.
+         * @param liveSince Glyphs used in or after this frame are kept. Others fill up to `REPACK_FILL` and are evicted past it.
+         */
+        static void repack(Font& font, int atlasSize, uint64_t liveSince);
+
+        /**
+         * @brief Clears a new atlas image and skyline.
+         * @param font The font.
+         * @param atlasSize Side of the atlas.
+         */
+        static void resetAtlas(Font& font, int atlasSize);
+
+        /**
+         * @brief Sends the whole atlas image to the GPU, creating the texture if needed.
+         * @param font The font.
+         */
+        static void uploadAtlas(Font& font);
+
+        /**
+         * @brief Replaces oversampled outlines with distance fields, spreading the glyphs over threads.
+         * @param glyphs The metrics of the outlines, converted to the padded fields.
+         * @param bitmaps The outlines at `DISTANCE_FIELD_OVERSAMPLE` times the pixel size.
+         */
+        static void generateDistanceFields(std::vector<Glyph>& glyphs, std::vector<Font::Bitmap>& bitmaps);
+
+        /**
+         * @brief Computes the distance field of one glyph.
+         * @param outline The oversampled outline.
+         * @return The distance field at the font's pixel size, padded by `DISTANCE_FIELD_SPREAD` on every side.
+         */
+        static Font::Bitmap buildDistanceField(const Font::Bitmap& outline);
+
+        static FT_Library library;                                          ///< Shared FreeType library, null until first use.
+        static std::map<std::tuple<std::string, int, bool>, Entry> fonts;   ///< Fonts by file, pixel size and distance field.
+        static uint64_t frame;                                              ///< Frames started, stamps glyph lookups.
+        static GlyphCacheStats stats;                                       ///< Glyph statistics.
+        static unsigned int frameUploadBytes;                               ///< Atlas bytes uploaded since the last flush.
+    };
+}
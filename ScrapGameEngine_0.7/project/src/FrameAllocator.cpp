@@ -0,0 +1,111 @@
+#include "FrameAllocator.h"
+#include "MemoryTracker.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+using namespace ScrapGameEngine;
+
+FrameAllocator::Arena FrameAllocator::arenas[FrameAllocator::MAX_BUFFERS];
+unsigned int FrameAllocator::bufferCount = 1;
+unsigned int FrameAllocator::current = 0;
+size_t FrameAllocator::capacity = 0;
+size_t FrameAllocator::peakBytes = 0;
+size_t FrameAllocator::overflowCount = 0;
+
+namespace
+{
+    const unsigned char POISON = 0xCD;
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+void FrameAllocator::init(size_t arenaCapacity, unsigned int buffers)
+{
+    shutdown();
+
+    bufferCount = std::max(1u, std::min(buffers, MAX_BUFFERS));
+    capacity = arenaCapacity;
+    for (unsigned int i = 0; i < bufferCount; ++i)
+    {
+        arenas[i].memory = std::make_unique<unsigned char[]>(capacity);
+        MemoryTracker::recordAllocation(MemoryTag::FRAME, capacity);
+    }
+
+    current = 0;
+    peakBytes = 0;
+    overflowCount = 0;
+}
+
+void FrameAllocator::shutdown()
+{
+    for (Arena& arena : arenas)
+    {
+        reset(arena);
+        if (arena.memory)
+        {
+            arena.memory.reset();
+            MemoryTracker::recordFree(MemoryTag::FRAME, capacity);
+        }
+    }
+
+    capacity = 0;
+}
+
+void FrameAllocator::beginFrame()
+{
+    current = (current + 1) % bufferCount;
+    reset(arenas[current]);
+}
+
+void* FrameAllocator::allocate(size_t size, size_t alignment)
+{
+    Arena& arena = arenas[current];
+
+    size_t offset = alignUp(arena.offset, alignment);
+    if (arena.memory && offset + size <= capacity)
+    {
+        arena.offset = offset + size;
+        peakBytes = std::max(peakBytes, arena.offset + arena.overflowBytes);
+        return arena.memory.get() + offset;
+    }
+
+    // Out of space: take the block from the heap and free it together with the arena
+    void* block = std::malloc(size + alignment);
+    if (!block) throw std::bad_alloc();
+
+    arena.overflowBlocks.push_back(block);
+    arena.overflowBytes += size;
+    peakBytes = std::max(peakBytes, arena.offset + arena.overflowBytes);
+    overflowCount++;
+    SGE_LOG_WARN(ALLOCATER, "Frame allocator arena full, {} bytes taken from the heap", size);
+
+    uintptr_t aligned = alignUp(reinterpret_cast<uintptr_t>(block), alignment);
+    return reinterpret_cast<void*>(aligned);
+}
+
+size_t FrameAllocator::getUsedBytes()
+{
+    return arenas[current].offset + arenas[current].overflowBytes;
+}
+
+void FrameAllocator::reset(Arena& arena)
+{
+#ifndef NDEBUG
+    // Anything still pointing into the arena now reads garbage instead of stale data
+    if (arena.memory) std::memset(arena.memory.get(), POISON, arena.offset);
+#endif
+
+    for (void* block : arena.overflowBlocks)
+    {
+        std::free(block);
+    }
+    arena.overflowBlocks.clear();
+    arena.overflowBytes = 0;
+    arena.offset = 0;
+}
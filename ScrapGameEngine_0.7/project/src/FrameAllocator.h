@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class FrameAllocator
+     * @brief Bump allocator for transient data that only lives until the end of the next frame.
+     *
+     * Allocation is a pointer increment and there is no per-allocation free: every block handed
+     * out during a frame is released at once when its arena is reused. The arenas are
+     * multi-buffered, so data allocated during frame N stays valid through frame N + 1 (long
+     * enough for a render thread consuming the previous frame). When an arena runs out, blocks
+     * fall back to the heap and are freed with the arena; the overflow is counted so the capacity
+     * can be raised. Debug builds fill released memory with 0xCD to expose use after reset.
+     *
+     * Only the main thread may allocate. Destructors are never run, so only store types that are
+     * trivially destructible or whose destruction does not matter (e.g. `FrameVector` elements).
+     */
+    class FrameAllocator
+    {
+    public:
+        FrameAllocator() = delete; ///< Prevent instantiation of this class.
+
+        static constexpr unsigned int MAX_BUFFERS = 3; ///< Maximum number of arenas.
+
+        /**
+         * @brief Creates the arenas.
+         * @param capacity Size of each arena in bytes.
+         * @param bufferCount Number of arenas, 2 keeps data alive for one extra frame.
+         */
+        static void init(size_t capacity = 1024 * 1024, unsigned int bufferCount = 2);
+
+        /**
+         * @brief Frees all arenas.
+         */
+        static void shutdown();
+
+        /**
+         * @brief Switches to the next arena and releases everything previously allocated from it.
+         *
+         * Called by the application at the start of each frame.
+         */
+        static void beginFrame();
+
+        /**
+         * @brief Allocates a block valid until the arena is reused.
+         * @param size The size of the block in bytes.
+         * @param alignment The required alignment of the block in bytes (power of two).
+         * @return The block, never null.
+         */
+        static void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Allocates an uninitialized array.
+         * @tparam T The element type.
+         * @param count The number of elements.
+         * @return Pointer to the first element.
+         */
+        template <typename T>
+        static T* allocateArray(size_t count)
+        {
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        /**
+         * @brief Constructs an object in the current arena. Its destructor is never called.
+         * @tparam T The object type.
+         * @param args The constructor arguments.
+         * @return Pointer to the new object.
+         */
+        template <typename T, typename... Args>
+        static T* create(Args&&... args)
+        {
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Gets the bytes allocated from the current arena this frame.
+         * @return The used size in bytes.
+         */
+        static size_t getUsedBytes();
+
+        /**
+         * @brief Gets the size of each arena.
+         * @return The capacity in bytes.
+         */
+        static size_t getCapacity() { return capacity; }
+
+        /**
+         * @brief Gets the highest usage of a single frame since init().
+         * @return The peak in bytes, including overflow.
+         */
+        static size_t getPeakBytes() { return peakBytes; }
+
+        /**
+         * @brief Gets the number of allocations that did not fit into their arena.
+         * @return The overflow count since init().
+         */
+        static size_t getOverflowCount() { return overflowCount; }
+
+    private:
+        /**
+         * @struct Arena
+         * @brief One frame's worth of memory.
+         */
+        struct Arena
+        {
+            std::unique_ptr<unsigned char[]> memory;   ///< Arena storage.
+            size_t offset = 0;                          ///< Bytes used.
+            size_t overflowBytes = 0;                   ///< Bytes taken from the heap this frame.
+            std::vector<void*> overflowBlocks;          ///< Heap blocks to free when the arena is reset.
+        };
+
+        /**
+         * @brief Releases everything allocated from an arena.
+         * @param arena The arena to reset.
+         */
+        static void reset(Arena& arena);
+
+        static Arena arenas[MAX_BUFFERS];   /**< The arenas. */
+        static unsigned int bufferCount;    /**< Number of arenas in use. */
+        static unsigned int current;        /**< Index of the arena of the current frame. */
+        static size_t capacity;             /**< Size of each arena in bytes. */
+        static size_t peakBytes;            /**< Highest per-frame usage. */
+        static size_t overflowCount;        /**< Allocations served by the heap. */
+    };
+
+    /**
+     * @class FrameAllocatorAdapter
+     * @brief STL allocator drawing from `FrameAllocator`. Deallocation is a no-op.
+     * @tparam T The element type.
+     */
+    template <typename T>
+    class FrameAllocatorAdapter
+    {
+    public:
+        using value_type = T;
+
+        FrameAllocatorAdapter() = default;
+
+        template <typename U>
+        FrameAllocatorAdapter(const FrameAllocatorAdapter<U>&) {}
+
+        T* allocate(size_t count) { return FrameAllocator::allocateArray<T>(count); }
+        void deallocate(T*, size_t) {}
+
+        template <typename U>
+        bool operator==(const FrameAllocatorAdapter<U>&) const { return true; }
+
+        template <typename U>
+        bool operator!=(const FrameAllocatorAdapter<U>&) const { return false; }
+    };
+
+    /**
+     * @typedef FrameVector
+     * @brief A `std::vector` whose storage comes from the frame allocator. Must not outlive the frame.
+     */
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
+}
@@ -0,0 +1,92 @@
+#include "FrameLimiter.h"
+#include "Clock.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace ScrapGameEngine;
+
+// Bounds for the adaptive spin margin
+static const double MIN_SPIN_MARGIN = 0.0005; // 0.5 ms
+static const double MAX_SPIN_MARGIN = 0.004;  // 4 ms
+
+void FrameLimiter::setTargetFrameTime(double seconds)
+{
+    targetFrameTime = seconds > 0.0 ? seconds : 0.0;
+}
+
+double FrameLimiter::waitForNextFrame(IClock& clock)
+{
+    double now = clock.now();
+
+    // First frame, nothing to wait for
+    if (lastFrameStart < 0.0)
+    {
+        lastFrameStart = now;
+        return now;
+    }
+
+    if (targetFrameTime > 0.0)
+    {
+        double deadline = lastFrameStart + targetFrameTime;
+
+        // The frame's work alone took longer than the budget
+        if (now > deadline) stats.missedFrames++;
+
+        // Sleep for the bulk of the remaining time
+        double sleepTime = deadline - now - spinMargin;
+        if (sleepTime > 0.0)
+        {
+            double expectedWake = now + sleepTime;
+            clock.sleepFor(sleepTime);
+            now = clock.now();
+
+            // Adapt the margin to how much the OS overslept, decaying slowly back down
+            double oversleep = now - expectedWake;
+            spinMargin = std::max(oversleep * 1.25, spinMargin * 0.95);
+            spinMargin = std::clamp(spinMargin, MIN_SPIN_MARGIN, MAX_SPIN_MARGIN);
+        }
+
+        // Spin for the remainder
+        while (now < deadline)
+        {
+            clock.spinPause();
+            now = clock.now();
+        }
+    }
+
+    recordInterval(now - lastFrameStart);
+    lastFrameStart = now;
+    return now;
+}
+
+void FrameLimiter::reset()
+{
+    lastFrameStart = -1.0;
+    jitterSum = 0.0;
+    intervalSum = 0.0;
+    stats = FramePacingStats();
+}
+
+void FrameLimiter::recordInterval(double interval)
+{
+    double jitter = targetFrameTime > 0.0 ? std::fabs(interval - targetFrameTime) : 0.0;
+
+    if (stats.frameCount == 0)
+    {
+        stats.minInterval = interval;
+        stats.maxInterval = interval;
+    }
+    else
+    {
+        stats.minInterval = std::min(stats.minInterval, interval);
+        stats.maxInterval = std::max(stats.maxInterval, interval);
+    }
+
+    stats.frameCount++;
+    intervalSum += interval;
+    jitterSum += jitter;
+
+    stats.meanInterval = intervalSum / stats.frameCount;
+    stats.meanAbsJitter = jitterSum / stats.frameCount;
+    stats.maxAbsJitter = std::max(stats.maxAbsJitter, jitter);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+namespace ScrapGameEngine
+{
+    class IClock; // Forward declaration to avoid pulling <chrono> into every includer
+
+    /**
+     * @struct FramePacingStats
+     * @brief Frame interval statistics gathered by the `FrameLimiter`.
+     *
+     * Jitter is the difference between the measured frame interval and the target frame time.
+     */
+    struct FramePacingStats
+    {
+        unsigned int frameCount = 0;  ///< Number of measured frame intervals.
+        double minInterval = 0.0;     ///< Shortest frame interval in seconds.
+        double maxInterval = 0.0;     ///< Longest frame interval in seconds.
+        double meanInterval = 0.0;    ///< Average frame interval in seconds.
+        double meanAbsJitter = 0.0;   ///< Average absolute deviation from the target in seconds.
+        double maxAbsJitter = 0.0;    ///< Largest absolute deviation from the target in seconds.
+        unsigned int missedFrames = 0; ///< Frames whose work exceeded the target frame time.
+    };
+
+    /**
+     * @class FrameLimiter
+     * @brief Hybrid sleep-then-spin frame rate limiter.
+     *
+     * The limiter sleeps until shortly before the deadline and spins for the remainder, giving
+     * sub-millisecond accuracy without burning a core for the whole frame. The spin margin adapts
+     * to the oversleep observed on the current system.
+     */
+    class FrameLimiter
+    {
+    public:
+        /**
+         * @brief Sets the target frame time.
+         * @param seconds Duration of a frame in seconds, or 0 to disable limiting.
+         */
+        void setTargetFrameTime(double seconds);
+
+        /**
+         * @brief Gets the target frame time.
+         * @return Duration of a frame in seconds, 0 if limiting is disabled.
+         */
+        double getTargetFrameTime() const { return targetFrameTime; }
+
+        /**
+         * @brief Waits until the next frame is due and records its interval.
+         * @param clock The clock to measure and wait with.
+         * @return The time at which the new frame starts, in seconds.
+         */
+        double waitForNextFrame(IClock& clock);
+
+        /**
+         * @brief Gets the collected pacing statistics.
+         * @return The frame pacing statistics.
+         */
+        const FramePacingStats& getStats() const { return stats; }
+
+        /**
+         * @brief Clears the pacing statistics and forgets the previous frame.
+         */
+        void reset();
+
+    private:
+        /**
+         * @brief Adds a frame interval to the statistics.
+         * @param interval The measured interval in seconds.
+         */
+        void recordInterval(double interval);
+
+        double targetFrameTime = 0.0;  ///< Target frame duration in seconds.
+        double lastFrameStart = -1.0;  ///< Start time of the previous frame, negative before the first frame.
+        double spinMargin = 0.002;     ///< Time before the deadline at which sleeping stops and spinning begins.
+        double jitterSum = 0.0;        ///< Sum of absolute jitter used for the mean.
+        double intervalSum = 0.0;      ///< Sum of intervals used for the mean.
+        FramePacingStats stats;        ///< Collected statistics.
+    };
+}
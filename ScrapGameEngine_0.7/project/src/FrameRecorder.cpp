@@ -0,0 +1,176 @@
+#include "FrameRecorder.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "Log.h"
+
+using namespace ScrapGameEngine;
+
+static const char RECORDING_MAGIC[4] = { 'S', 'G', 'E', 'R' };
+static const uint32_t RECORDING_VERSION = 2;
+static const uint32_t OLDEST_RECORDING_VERSION = 1; // Without prepared steps
+static const std::streamoff FRAME_COUNT_OFFSET = 8; // After magic and version
+
+// Raw little-endian helpers, the engine only targets little-endian platforms
+template <typename T>
+static void writeValue(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::ifstream& file, T& value)
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(file);
+}
+
+// FrameRecorder =====================================================
+
+FrameRecorder::~FrameRecorder()
+{
+    close();
+}
+
+bool FrameRecorder::open(const std::string& path)
+{
+    close();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        SGE_LOG_ERROR(REPLAY, "Failed to create recording: {}", path);
+        return false;
+    }
+
+    frameCount = 0;
+    file.write(RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+    writeValue(file, RECORDING_VERSION);
+    writeValue(file, static_cast<uint32_t>(0)); // Patched in close()
+
+    SGE_LOG_INFO(REPLAY, "Recording frames to: {}", path);
+    return true;
+}
+
+void FrameRecorder::writeFrame(float deltaTime, const InputFrame& frame, uint8_t preparedStep)
+{
+    if (!file.is_open()) return;
+
+    writeValue(file, deltaTime);
+
+    uint8_t keyCount = static_cast<uint8_t>(std::min<size_t>(frame.keys.size(), 255));
+    writeValue(file, keyCount);
+    for (uint8_t i = 0; i < keyCount; ++i)
+    {
+        writeValue(file, static_cast<uint16_t>(frame.keys[i]));
+    }
+
+    uint8_t mouseMask = 0;
+    for (MouseButtonCode button : frame.mouseButtons)
+    {
+        mouseMask |= static_cast<uint8_t>(1u << static_cast<int>(button));
+    }
+    writeValue(file, mouseMask);
+    writeValue(file, frame.mousePosition.x);
+    writeValue(file, frame.mousePosition.y);
+    writeValue(file, preparedStep);
+
+    frameCount++;
+}
+
+void FrameRecorder::close()
+{
+    if (!file.is_open()) return;
+
+    // Store the final frame count in the header
+    file.seekp(FRAME_COUNT_OFFSET);
+    writeValue(file, static_cast<uint32_t>(frameCount));
+    file.close();
+
+    SGE_LOG_INFO(REPLAY, "Recorded {} frames.", frameCount);
+}
+
+// FramePlayer =======================================================
+
+bool FramePlayer::open(const std::string& path)
+{
+    file.open(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        SGE_LOG_ERROR(REPLAY, "Failed to open recording: {}", path);
+        return false;
+    }
+
+    char magic[4];
+    uint32_t count = 0;
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, RECORDING_MAGIC, sizeof(magic)) != 0 || !readValue(file, version) || !readValue(file, count))
+    {
+        SGE_LOG_ERROR(REPLAY, "Not a frame recording: {}", path);
+        file.close();
+        return false;
+    }
+
+    if (version < OLDEST_RECORDING_VERSION || version > RECORDING_VERSION)
+    {
+        SGE_LOG_ERROR(REPLAY, "Unsupported recording version {}: {}", version, path);
+        file.close();
+        return false;
+    }
+
+    frameCount = count;
+    frameIndex = 0;
+
+    SGE_LOG_INFO(REPLAY, "Replaying {} frames from: {}", frameCount, path);
+    if (!hasPreparedSteps())
+    {
+        SGE_LOG_WARN(REPLAY, "Version {} recording, scenes prepared in the background may switch on other frames: {}", version, path);
+    }
+    return true;
+}
+
+bool FramePlayer::readFrame(float& deltaTime, InputFrame& frame, uint8_t& preparedStep)
+{
+    if (!file.is_open() || frameIndex >= frameCount) return false;
+
+    uint8_t keyCount = 0;
+    if (!readValue(file, deltaTime) || !readValue(file, keyCount))
+    {
+        SGE_LOG_ERROR(REPLAY, "Recording truncated at frame {}", frameIndex);
+        return false;
+    }
+
+    frame.keys.clear();
+    for (uint8_t i = 0; i < keyCount; ++i)
+    {
+        uint16_t key = 0;
+        if (!readValue(file, key)) return false;
+        frame.keys.push_back(static_cast<KeyCode>(key));
+    }
+
+    uint8_t mouseMask = 0;
+    if (!readValue(file, mouseMask) || !readValue(file, frame.mousePosition.x) || !readValue(file, frame.mousePosition.y))
+    {
+        SGE_LOG_ERROR(REPLAY, "Recording truncated at frame {}", frameIndex);
+        return false;
+    }
+
+    preparedStep = 0;
+    if (hasPreparedSteps() && !readValue(file, preparedStep))
+    {
+        SGE_LOG_ERROR(REPLAY, "Recording truncated at frame {}", frameIndex);
+        return false;
+    }
+
+    frame.mouseButtons.clear();
+    for (int button = 0; button < 8; ++button)
+    {
+        if (mouseMask & (1u << button))
+        {
+            frame.mouseButtons.push_back(static_cast<MouseButtonCode>(button));
+        }
+    }
+
+    frameIndex++;
+    return true;
+}
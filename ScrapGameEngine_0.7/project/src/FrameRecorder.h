@@ -0,0 +1,117 @@
+#pragma once
+#include "Input.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class FrameRecorder
+     * @brief Captures per-frame delta times and input state to a compact binary file.
+     *
+     * File layout (little-endian):
+     * - Header: magic "SGER", uint32 version, uint32 frame count.
+     * - Per frame: float delta time, uint8 key count, uint16 key codes[key count],
+     *   uint8 mouse button mask, float mouse x, float mouse y, uint8 prepared step.
+     *
+     * The prepared step is 0, or n if the frame's nth scene update finished preparing a scene.
+     * Version 1 files have no prepared step.
+     *
+     * Together with `FramePlayer` this makes runs reproducible: replaying a file feeds
+     * the exact same deltas and input into Time and Input, and finishes scene preparations
+     * on the same updates however fast this machine loads.
+     */
+    class FrameRecorder
+    {
+    public:
+        /**
+         * @brief Closes the file if still open.
+         */
+        ~FrameRecorder();
+
+        /**
+         * @brief Creates the recording file and writes its header.
+         * @param path The path of the file to write.
+         * @return True if the file could be created.
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief Appends a frame to the recording.
+         * @param deltaTime The delta time of the frame in seconds.
+         * @param frame The input state of the frame.
+         * @param preparedStep 1 + the index of the frame's scene update that finished preparing a scene, 0 if none did.
+         */
+        void writeFrame(float deltaTime, const InputFrame& frame, uint8_t preparedStep);
+
+        /**
+         * @brief Finalizes the header and closes the file.
+         */
+        void close();
+
+        /**
+         * @brief Checks whether a recording is in progress.
+         * @return True if the file is open.
+         */
+        bool isOpen() const { return file.is_open(); }
+
+        /**
+         * @brief Gets the number of frames written so far.
+         * @return The frame count.
+         */
+        unsigned int getFrameCount() const { return frameCount; }
+
+    private:
+        std::ofstream file;           ///< Output file.
+        unsigned int frameCount = 0;  ///< Frames written so far.
+    };
+
+    /**
+     * @class FramePlayer
+     * @brief Reads a recording written by `FrameRecorder` frame by frame.
+     */
+    class FramePlayer
+    {
+    public:
+        /**
+         * @brief Opens a recording and validates its header.
+         * @param path The path of the file to read.
+         * @return True if the file is a valid recording.
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief Reads the next frame.
+         * @param deltaTime Receives the delta time of the frame in seconds.
+         * @param frame Receives the input state of the frame.
+         * @param preparedStep Receives the frame's prepared step, 0 in version 1 files.
+         * @return True if a frame was read, false at the end of the recording or on error.
+         */
+        bool readFrame(float& deltaTime, InputFrame& frame, uint8_t& preparedStep);
+
+        /**
+         * @brief Gets the number of frames stored in the recording.
+         * @return The frame count from the header.
+         */
+        unsigned int getFrameCount() const { return frameCount; }
+
+        /**
+         * @brief Gets the number of frames read so far.
+         * @return The index of the next frame.
+         */
+        unsigned int getFrameIndex() const { return frameIndex; }
+
+        /**
+         * @brief Checks whether the recording says when scene preparations finished.
+         * @return False for version 1 files.
+         */
+        bool hasPreparedSteps() const { return version >= 2; }
+
+    private:
+        std::ifstream file;           ///< Input file.
+        unsigned int frameCount = 0;  ///< Frames stored in the file.
+        unsigned int frameIndex = 0;  ///< Frames read so far.
+        uint32_t version = 0;         ///< Format version of the file.
+    };
+}
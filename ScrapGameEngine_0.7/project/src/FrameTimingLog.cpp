@@ -0,0 +1,33 @@
+#include "FrameTimingLog.h"
+#include "Log.h"
+
+using namespace ScrapGameEngine;
+
+bool FrameTimingLog::open(const std::string& path)
+{
+    file.open(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        SGE_LOG_ERROR(REPLAY, "Failed to create timing file: {}", path);
+        return false;
+    }
+
+    file << "frame,delta_ms,update_ms,render_ms,frame_ms\n";
+    return true;
+}
+
+void FrameTimingLog::writeFrame(unsigned int frame, float deltaTime, double updateTime, double renderTime, double frameTime)
+{
+    if (!file.is_open()) return;
+
+    file << frame << ','
+        << deltaTime * 1000.0 << ','
+        << updateTime * 1000.0 << ','
+        << renderTime * 1000.0 << ','
+        << frameTime * 1000.0 << '\n';
+}
+
+void FrameTimingLog::close()
+{
+    if (file.is_open()) file.close();
+}
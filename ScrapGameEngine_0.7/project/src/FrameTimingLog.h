@@ -0,0 +1,47 @@
+#pragma once
+#include <fstream>
+#include <string>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class FrameTimingLog
+     * @brief Writes per-frame CPU timings to a CSV file for performance regression runs.
+     *
+     * Columns: frame, delta time, update, render and total frame time, all in milliseconds.
+     */
+    class FrameTimingLog
+    {
+    public:
+        /**
+         * @brief Creates the CSV file and writes the column header.
+         * @param path The path of the file to write.
+         * @return True if the file could be created.
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief Appends a row for one frame.
+         * @param frame The frame index.
+         * @param deltaTime The simulation delta time of the frame in seconds.
+         * @param updateTime CPU time spent updating in seconds.
+         * @param renderTime CPU time spent rendering in seconds.
+         * @param frameTime Total CPU time of the frame in seconds.
+         */
+        void writeFrame(unsigned int frame, float deltaTime, double updateTime, double renderTime, double frameTime);
+
+        /**
+         * @brief Closes the file.
+         */
+        void close();
+
+        /**
+         * @brief Checks whether timings are being written.
+         * @return True if the file is open.
+         */
+        bool isOpen() const { return file.is_open(); }
+
+    private:
+        std::ofstream file; ///< Output file.
+    };
+}
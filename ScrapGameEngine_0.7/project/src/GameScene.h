@@ -1,36 +1,46 @@
-#pragma once
-#include "BaseScene.h"
-#include "GameObject.h"
-#include "AudioSource.h"
-#include "Texture2D.h"
-#include <string>
-#include <unordered_map>
-#include <memory>
-
-using namespace ScrapGameEngine;
-
-class GameScene : public BaseScene
-{
-public:
-    std::string getName() const override { return "GameScene"; }
-
-protected:
-    void onInitialize() override;
-    void onUpdate(float deltaTime) override;
-    void onRender() override;
-    void onDeactivate() override;
-
-    float time;
-
-private:
-    static std::unique_ptr<GameObject> tutorialObject;
-
-    void initializeAudioSets();
-    void applyAudioSet(int setIndex);
-
-    std::vector<GameObject*> musicPadButtons;
-    std::unordered_map<int, AudioSource*> buttonAudioMap; // Map button index to AudioSource pointers
-
-    GameObject* clickAudioSource;
-    Texture2D* tutorialtexture;
-};
+#pragma once
+#include "BaseScene.h"
+#include "GameObject.h"
+#include "AudioSource.h"
+#include "Texture2D.h"
+#include "Prefab.h"
+#include <string>
+#include <unordered_map>
+#include <memory>
+
+using namespace ScrapGameEngine;
+
+class GameScene : public BaseScene
+{
+public:
+    std::string getName() const override { return "GameScene"; }
+    void declareAssets(SceneManifest& manifest) const override;
+
+protected:
+    void onInitialize() override;
+    void onUpdate(float deltaTime) override;
+    void onRender() override;
+    void onDeactivate() override;
+    void onSuspend() override;
+
+    float time;
+
+private:
+    static std::unique_ptr<GameObject> tutorialObject;
+
+    // Shared with declareAssets so the preloaded textures match the scene's loads
+    static TextureConfig getPadTextureConfig();
+    static TextureConfig getTutorialTextureConfig();
+
+    void initializeAudioSets();
+    void applyAudioSet(int setIndex);
+    void burstAtPad(int index);
+
+    std::vector<GameObject*> musicPadButtons;
+    std::unique_ptr<Prefab> padPrefab; // Template of the music pads, holds their textures
+    std::unordered_map<int, AudioSource*> buttonAudioMap; // Map button index to AudioSource pointers
+
+    GameObject* clickAudioSource;
+    GameObject* padBurst; // Particle burst shown on the pad being played
+    Texture2D* tutorialtexture;
+};
@@ -1,22 +1,78 @@
-#include "Graphics.h"
-#include "Renderer.h"
-#include <iostream>
-
-void ScrapGameEngine::Graphics::drawMesh(Mesh* _mesh, RenderParams params)
-{
-    DrawCommand dc{};
-    dc.meshId = _mesh->getID();
-    dc.vertexStride = sizeof(Vertex);
-    dc.vertexCount = _mesh->getVertexCount();
-    dc.tint = params.tint;
-	dc.translation = params.translation;
-	dc.rotationZ = params.rotationZ;
-	dc.scale = params.scale;
-
-    // Get the texture ID from the RenderParams
-    dc.textureID = params.texture ? params.texture->getID() : 0; // Use texture ID or 0 if no texture
-
-    Renderer::submitCommand(dc); // Submit the draw command
-}
-
-
+#include "Graphics.h"
+#include "Renderer.h"
+#include "DynamicGeometryAllocator.h"
+#include <cstring>
+#include <iostream>
+
+void ScrapGameEngine::Graphics::drawMesh(Mesh* _mesh, RenderParams params)
+{
+    DrawCommand dc{};
+    dc.meshId = _mesh->getID();
+    dc.vertexStride = sizeof(Vertex);
+    dc.vertexCount = _mesh->getVertexCount();
+    dc.tint = params.tint;
+	dc.translation = params.translation;
+	dc.rotationZ = params.rotationZ;
+	dc.scale = params.scale;
+    dc.distanceField = params.distanceField;
+    dc.uvRect = params.uvRect;
+
+    // Get the texture ID from the RenderParams
+    dc.textureID = params.texture ? params.texture->getID() : 0; // Use texture ID or 0 if no texture
+
+    Renderer::submitCommand(dc); // Submit the draw command
+}
+
+void ScrapGameEngine::Graphics::drawDynamic(const Vertex* vertices, unsigned int vertexCount, RenderParams params)
+{
+    if (!vertices || vertexCount == 0) return;
+
+    // Copy the vertices into this frame's region of the ring buffer
+    unsigned int size = vertexCount * sizeof(Vertex);
+    DynamicAllocation allocation = DynamicGeometryAllocator::allocate(size);
+    if (!allocation.isValid()) return;
+
+    std::memcpy(allocation.data, vertices, size);
+
+    DrawCommand dc{};
+    dc.meshId = allocation.bufferId;
+    dc.vertexStride = sizeof(Vertex);
+    dc.vertexCount = vertexCount;
+    dc.vertexOffset = allocation.offset;
+    dc.tint = params.tint;
+    dc.translation = params.translation;
+    dc.rotationZ = params.rotationZ;
+    dc.scale = params.scale;
+    dc.textureID = params.texture ? params.texture->getID() : 0;
+    dc.distanceField = params.distanceField;
+    dc.uvRect = params.uvRect;
+
+    Renderer::submitCommand(dc);
+}
+
+void ScrapGameEngine::Graphics::drawDynamic(const ColorVertex* vertices, unsigned int vertexCount, RenderParams params)
+{
+    if (!vertices || vertexCount == 0) return;
+
+    unsigned int size = vertexCount * sizeof(ColorVertex);
+    DynamicAllocation allocation = DynamicGeometryAllocator::allocate(size);
+    if (!allocation.isValid()) return;
+
+    std::memcpy(allocation.data, vertices, size);
+
+    DrawCommand dc{};
+    dc.meshId = allocation.bufferId;
+    dc.vertexStride = sizeof(ColorVertex);
+    dc.vertexCount = vertexCount;
+    dc.vertexOffset = allocation.offset;
+    dc.tint = params.tint;
+    dc.translation = params.translation;
+    dc.rotationZ = params.rotationZ;
+    dc.scale = params.scale;
+    dc.textureID = params.texture ? params.texture->getID() : 0;
+    dc.distanceField = params.distanceField;
+    dc.uvRect = params.uvRect;
+    dc.vertexColors = true;
+
+    Renderer::submitCommand(dc);
+}
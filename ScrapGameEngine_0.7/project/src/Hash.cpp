@@ -0,0 +1,198 @@
+#include "Hash.h"
+#include <algorithm>
+#include <cstring>
+#include "Log.h"
+
+using namespace ScrapGameEngine;
+
+std::unordered_map<AssetId, std::string> AssetPaths::paths;
+size_t AssetPaths::collisions = 0;
+std::mutex AssetPaths::mutex;
+
+namespace
+{
+    const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ull;
+    const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+    const uint64_t PRIME64_3 = 0x165667B19E3779F9ull;
+    const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+    const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ull;
+
+    inline uint64_t rotl(uint64_t value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    // Unaligned little-endian reads
+    inline uint64_t read64(const unsigned char* p)
+    {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t read32(const unsigned char* p)
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t round(uint64_t acc, uint64_t input)
+    {
+        acc += input * PRIME64_2;
+        acc = rotl(acc, 31);
+        return acc * PRIME64_1;
+    }
+
+    inline uint64_t mergeRound(uint64_t acc, uint64_t value)
+    {
+        acc ^= round(0, value);
+        return acc * PRIME64_1 + PRIME64_4;
+    }
+}
+
+uint64_t Hash::xxh64(const void* data, size_t length, uint64_t seed)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + length;
+    uint64_t h;
+
+    if (length >= 32)
+    {
+        // Four independent lanes over 32-byte stripes
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+
+        const unsigned char* limit = end - 32;
+        do
+        {
+            v1 = round(v1, read64(p)); p += 8;
+            v2 = round(v2, read64(p)); p += 8;
+            v3 = round(v3, read64(p)); p += 8;
+            v4 = round(v4, read64(p)); p += 8;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    }
+    else
+    {
+        h = seed + PRIME64_5;
+    }
+
+    h += static_cast<uint64_t>(length);
+
+    // Remaining tail
+    while (p + 8 <= end)
+    {
+        h ^= round(0, read64(p));
+        h = rotl(h, 27) * PRIME64_1 + PRIME64_4;
+        p += 8;
+    }
+    if (p + 4 <= end)
+    {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME64_1;
+        h = rotl(h, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+    while (p < end)
+    {
+        h ^= (*p) * PRIME64_5;
+        h = rotl(h, 11) * PRIME64_1;
+        p++;
+    }
+
+    // Final avalanche
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+std::string AssetPaths::normalize(const std::string& path)
+{
+    std::string normalized = path;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    return normalized;
+}
+
+AssetId AssetPaths::intern(const std::string& path)
+{
+    std::string normalized = normalize(path);
+    AssetId id = Hash::xxh64(normalized);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    bool collided = false;
+    while (true)
+    {
+        auto it = paths.find(id);
+        if (it == paths.end())
+        {
+            if (collided)
+            {
+                collisions++;
+                SGE_LOG_WARN(ALLOCATER, "Asset ID collision, {} moved to another ID", normalized);
+            }
+            paths.emplace(id, normalized);
+            return id;
+        }
+        if (it->second == normalized)
+        {
+            return id;
+        }
+
+        // A different path already owns this ID, probe the next one
+        collided = true;
+        id = Hash::rehash(id);
+    }
+}
+
+bool AssetPaths::find(const std::string& path, AssetId& id)
+{
+    std::string normalized = normalize(path);
+    AssetId probe = Hash::xxh64(normalized);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = paths.find(probe); it != paths.end(); it = paths.find(probe))
+    {
+        if (it->second == normalized)
+        {
+            id = probe;
+            return true;
+        }
+        probe = Hash::rehash(probe);
+    }
+    return false;
+}
+
+std::string AssetPaths::getPath(AssetId id)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = paths.find(id);
+    return it != paths.end() ? it->second : std::string();
+}
+
+size_t AssetPaths::getCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return paths.size();
+}
+
+std::vector<std::pair<AssetId, std::string>> AssetPaths::getAll()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::vector<std::pair<AssetId, std::string>>(paths.begin(), paths.end());
+}
+
+size_t AssetPaths::getCollisionCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return collisions;
+}
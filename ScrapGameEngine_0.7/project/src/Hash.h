@@ -0,0 +1,124 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @typedef AssetId
+     * @brief 64-bit identifier of an asset, either an interned path or a content hash.
+     */
+    using AssetId = uint64_t;
+
+    /**
+     * @class Hash
+     * @brief Non-cryptographic 64-bit hashing (XXH64).
+     */
+    class Hash
+    {
+    public:
+        Hash() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Hashes a block of memory with the XXH64 algorithm.
+         * @param data The bytes to hash.
+         * @param length The number of bytes.
+         * @param seed The seed, different seeds give independent hashes.
+         * @return The 64-bit hash.
+         */
+        static uint64_t xxh64(const void* data, size_t length, uint64_t seed = 0);
+
+        /**
+         * @brief Hashes the characters of a string.
+         * @param text The string.
+         * @param seed The seed.
+         * @return The 64-bit hash.
+         */
+        static uint64_t xxh64(const std::string& text, uint64_t seed = 0)
+        {
+            return xxh64(text.data(), text.size(), seed);
+        }
+
+        /**
+         * @brief Derives the next key to probe after a collision.
+         * @param key The key that collided.
+         * @return A different, well-mixed key.
+         */
+        static uint64_t rehash(uint64_t key)
+        {
+            return xxh64(&key, sizeof(key), 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    /**
+     * @class AssetPaths
+     * @brief Interns asset paths into stable 64-bit IDs.
+     *
+     * Paths are normalized (backslashes become forward slashes) and hashed, so the same file
+     * always maps to the same ID and caches can key on an integer instead of a string. Two
+     * different paths hashing to the same value are detected and the second one is moved to
+     * another ID. Thread-safe.
+     */
+    class AssetPaths
+    {
+    public:
+        AssetPaths() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Gets the ID of a path, registering it on first use.
+         * @param path The asset path.
+         * @return The ID.
+         */
+        static AssetId intern(const std::string& path);
+
+        /**
+         * @brief Gets the ID of a path without registering it.
+         * @param path The asset path.
+         * @param id Receives the ID if the path was interned.
+         * @return False if the path was never interned.
+         */
+        static bool find(const std::string& path, AssetId& id);
+
+        /**
+         * @brief Gets the normalized path of an interned ID.
+         * @param id The ID.
+         * @return The path, empty if the ID was never interned.
+         */
+        static std::string getPath(AssetId id);
+
+        /**
+         * @brief Gets the number of interned paths.
+         * @return The path count.
+         */
+        static size_t getCount();
+
+        /**
+         * @brief Copies every interned path.
+         * @return The IDs with their normalized paths.
+         */
+        static std::vector<std::pair<AssetId, std::string>> getAll();
+
+        /**
+         * @brief Gets the number of hash collisions resolved while interning.
+         * @return The collision count.
+         */
+        static size_t getCollisionCount();
+
+        /**
+         * @brief Normalizes a path the way intern() does.
+         * @param path The path.
+         * @return The path with forward slashes.
+         */
+        static std::string normalize(const std::string& path);
+
+    private:
+        static std::unordered_map<AssetId, std::string> paths; /**< Interned paths by ID. */
+        static size_t collisions;                              /**< Collisions resolved. */
+        static std::mutex mutex;                               /**< Guards the table. */
+    };
+}
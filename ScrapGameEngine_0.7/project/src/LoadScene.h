@@ -1,32 +1,36 @@
-#pragma once
-#include "BaseScene.h"
-#include "GameObject.h"
-#include <memory>
-
-using namespace ScrapGameEngine;
-
-class LoadScene : public BaseScene
-{
-public:
-    std::string getName() const override { return "LoadScene"; }
-
-    // Load a new scene by name
-    void load(const std::string& sceneName);
-    void setLoadTime(float time);
-
-protected:
-    void onInitialize() override;
-    void onUpdate(float deltaTime) override;
-    void onRender() override;
-    void onDeactivate() override;
-
-    float time;
-    void updateLoadingBar() const;
-private:
-    static std::unique_ptr<GameObject> gameObject;
-	std::string _sceneName;
-
-    float _loadTime; // Loading time
-    float _progress; // Loading progress
-};
-
+#pragma once
+#include "BaseScene.h"
+#include "GameObject.h"
+#include <memory>
+
+using namespace ScrapGameEngine;
+
+class LoadScene : public BaseScene
+{
+public:
+    std::string getName() const override { return "LoadScene"; }
+
+    // Load a new scene by name, preloading its assets while the bar spins
+    void load(const std::string& sceneName);
+
+    // Scene loaded the next time the LoadScene is shown, then back to MainMenuScene
+    static void setNextScene(const std::string& sceneName);
+
+protected:
+    void onInitialize() override;
+    void onActivate() override;
+    void onUpdate(float deltaTime) override;
+    void onRender() override;
+    void onDeactivate() override;
+
+    float time;
+    void updateLoadingBar() const;
+private:
+    static std::unique_ptr<GameObject> gameObject;
+    static std::string nextScene;
+	std::string _sceneName;
+
+    float _progress; // Loading progress, fraction of bytes preloaded
+    uint64_t _spin = 0; // Timeline unwinding the bar, seeked to the progress
+};
+
@@ -0,0 +1,390 @@
+#include "Log.h"
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    // Bounded multi-producer queue after Dmitry Vyukov; only the writer thread consumes
+    const size_t QUEUE_CAPACITY = 4096; // Must be a power of two
+    const size_t QUEUE_MASK = QUEUE_CAPACITY - 1;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    enum WriterState { WRITER_STOPPED, WRITER_RUNNING, WRITER_SHUT_DOWN };
+
+    std::unique_ptr<Cell[]> cells;
+    std::atomic<size_t> enqueuePos{ 0 };
+    size_t dequeuePos = 0;
+
+    std::atomic<int> writerState{ WRITER_STOPPED };
+    std::atomic<uint64_t> submittedCount{ 0 };
+    std::atomic<uint64_t> writtenCount{ 0 };
+    std::atomic<uint64_t> droppedCount{ 0 };
+    std::atomic<int> activeProducers{ 0 }; // Producers between reading the writer state and finishing their push
+    std::once_flag startFlag;
+    std::thread writerThread;
+    std::mutex syncMutex; // Only used once the writer thread is gone
+
+    // The writer sleeps on `wake` when the queue is empty, flush() sleeps on `written`.
+    // Producers only take `waitMutex` to wake an idle writer, so a busy writer costs them nothing.
+    std::mutex waitMutex;
+    std::condition_variable wake;
+    std::condition_variable written;
+    std::atomic<bool> writerIdle{ false };
+    std::atomic<int> flushWaiters{ 0 };
+
+    uint64_t steadyNanoseconds()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    bool tryPush(const LogRecord& record)
+    {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        while (true)
+        {
+            cell = &cells[pos & QUEUE_MASK];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                // The cell is free, try to claim it
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0)
+            {
+                return false; // Queue full
+            }
+            else
+            {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->record = record;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(LogRecord& record)
+    {
+        Cell& cell = cells[dequeuePos & QUEUE_MASK];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeuePos + 1) < 0) return false;
+
+        record = cell.record;
+        cell.sequence.store(dequeuePos + QUEUE_CAPACITY, std::memory_order_release);
+        dequeuePos++;
+        return true;
+    }
+
+    void writeRecord(const LogRecord& record)
+    {
+        std::ostream& out = record.level >= LogLevel::WARN ? std::cerr : std::cout;
+        out << '[' << Log::getCategoryName(record.category) << "] " << Log::format(record);
+        if (record.suppressed > 0)
+        {
+            out << " (" << record.suppressed << " similar messages suppressed)";
+        }
+        out << '\n';
+    }
+
+    // Sleeps until a producer queues a record or shutdown() is called
+    void waitForRecords()
+    {
+        std::unique_lock<std::mutex> lock(waitMutex);
+
+        // Announce the sleep before the last look at the queue, a producer pushing meanwhile then sees it
+        writerIdle.store(true);
+        if (submittedCount.load() != writtenCount.load() || writerState.load() != WRITER_RUNNING)
+        {
+            writerIdle.store(false);
+            return;
+        }
+        wake.wait(lock, []() { return !writerIdle.load(); });
+    }
+
+    void writerLoop()
+    {
+        uint64_t reportedDrops = 0;
+        LogRecord record;
+
+        while (true)
+        {
+            bool stopping = writerState.load(std::memory_order_acquire) != WRITER_RUNNING;
+
+            // Write everything queued, then flush once for the whole batch
+            size_t count = 0;
+            while (tryPop(record))
+            {
+                writeRecord(record);
+                count++;
+            }
+
+            uint64_t drops = droppedCount.load(std::memory_order_relaxed);
+            if (drops != reportedDrops)
+            {
+                std::cerr << "[FRAMEWORK] Log queue full, " << (drops - reportedDrops) << " messages dropped\n";
+                reportedDrops = drops;
+            }
+
+            if (count > 0)
+            {
+                std::cout.flush();
+                std::cerr.flush();
+                writtenCount.fetch_add(count);
+                if (flushWaiters.load() > 0)
+                {
+                    std::lock_guard<std::mutex> lock(waitMutex);
+                    written.notify_all();
+                }
+            }
+            else if (stopping)
+            {
+                break;
+            }
+            else
+            {
+                waitForRecords();
+            }
+        }
+    }
+
+    // Wakes the writer if it sleeps on an empty queue
+    void wakeWriter()
+    {
+        if (writerIdle.load() && writerIdle.exchange(false))
+        {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            wake.notify_one();
+        }
+    }
+
+    void startWriter()
+    {
+        cells = std::make_unique<Cell[]>(QUEUE_CAPACITY);
+        for (size_t i = 0; i < QUEUE_CAPACITY; ++i)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        writerState.store(WRITER_RUNNING, std::memory_order_release);
+        writerThread = std::thread(writerLoop);
+    }
+
+    // Joins the writer when the program exits without calling Log::shutdown()
+    struct LogShutdownGuard
+    {
+        ~LogShutdownGuard() { Log::shutdown(); }
+    } shutdownGuard;
+}
+
+std::atomic<int> Log::runtimeLevel{ 0 };
+
+// LogRateLimiter ====================================================
+
+bool LogRateLimiter::allow(uint32_t& suppressed)
+{
+    const uint64_t window = 1000000000ull; // One second
+
+    uint64_t now = steadyNanoseconds();
+    uint64_t start = windowStart.load(std::memory_order_relaxed);
+    if (now - start >= window && windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+    {
+        windowCount.store(0, std::memory_order_relaxed);
+    }
+
+    if (windowCount.fetch_add(1, std::memory_order_relaxed) < SGE_LOG_RATE_LIMIT)
+    {
+        suppressed = suppressedCount.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    suppressedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+// LogRecord =========================================================
+
+void LogRecord::pushValue(LogArgType type, const void* data, size_t size)
+{
+    if (argCount >= MAX_ARGS || payloadSize + size > PAYLOAD_SIZE) return;
+
+    argTypes[argCount++] = type;
+    std::memcpy(payload + payloadSize, data, size);
+    payloadSize += static_cast<uint16_t>(size);
+}
+
+void LogRecord::pushString(const char* text, size_t length)
+{
+    if (argCount >= MAX_ARGS || payloadSize + sizeof(uint16_t) > PAYLOAD_SIZE) return;
+
+    uint16_t stored = static_cast<uint16_t>(std::min(length, PAYLOAD_SIZE - payloadSize - sizeof(uint16_t)));
+
+    argTypes[argCount++] = LogArgType::STRING;
+    std::memcpy(payload + payloadSize, &stored, sizeof(stored));
+    std::memcpy(payload + payloadSize + sizeof(stored), text, stored);
+    payloadSize += static_cast<uint16_t>(sizeof(stored) + stored);
+}
+
+// Log ===============================================================
+
+void Log::setLevel(LogLevel level)
+{
+    runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void Log::submit(const LogRecord& record)
+{
+    if (writerState.load(std::memory_order_acquire) == WRITER_STOPPED)
+    {
+        std::call_once(startFlag, startWriter);
+    }
+
+    // Counted before reading the state, so shutdown() can wait for pushes that saw the writer running
+    activeProducers.fetch_add(1);
+    if (writerState.load() == WRITER_SHUT_DOWN)
+    {
+        activeProducers.fetch_sub(1);
+        std::lock_guard<std::mutex> lock(syncMutex);
+        writeRecord(record);
+        return;
+    }
+
+    if (tryPush(record))
+    {
+        submittedCount.fetch_add(1);
+        wakeWriter();
+    }
+    else
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    activeProducers.fetch_sub(1, std::memory_order_release);
+}
+
+void Log::flush()
+{
+    if (writerState.load(std::memory_order_acquire) != WRITER_RUNNING) return;
+
+    // Only what was queued before the call, producers that keep logging do not hold it up
+    uint64_t target = submittedCount.load();
+    flushWaiters.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(waitMutex);
+        written.wait(lock, [target]()
+            {
+                return writtenCount.load() >= target || writerState.load() != WRITER_RUNNING;
+            });
+    }
+    flushWaiters.fetch_sub(1);
+}
+
+void Log::shutdown()
+{
+    int expected = WRITER_RUNNING;
+    if (!writerState.compare_exchange_strong(expected, WRITER_SHUT_DOWN)) return;
+
+    // Wake the writer and any flush() so they see the new state
+    {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        writerIdle.store(false);
+        wake.notify_one();
+        written.notify_all();
+    }
+    if (writerThread.joinable()) writerThread.join();
+
+    // A producer that read WRITER_RUNNING may push after the writer found the queue empty and exited
+    while (activeProducers.load(std::memory_order_acquire) != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    std::lock_guard<std::mutex> lock(syncMutex);
+    LogRecord record;
+    while (tryPop(record))
+    {
+        writeRecord(record);
+        writtenCount.fetch_add(1);
+    }
+    std::cout.flush();
+    std::cerr.flush();
+}
+
+uint64_t Log::getDroppedCount()
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+const char* Log::getCategoryName(LogCategory category)
+{
+    switch (category)
+    {
+    case LogCategory::FRAMEWORK: return "FRAMEWORK";
+    case LogCategory::RENDERER: return "RENDERER";
+    case LogCategory::ALLOCATER: return "ALLOCATER";
+    case LogCategory::SCHEDULER: return "SCHEDULER";
+    case LogCategory::SCENE_MANAGER: return "SCENE_MANAGER";
+    case LogCategory::GAMEOBJECT: return "GameObject";
+    case LogCategory::TEXT: return "Text_Component";
+    case LogCategory::AUDIOSOURCE: return "AUDIOSOURCE";
+    case LogCategory::INPUT: return "INPUT";
+    case LogCategory::REPLAY: return "REPLAY";
+    case LogCategory::PROFILER: return "PROFILER";
+    case LogCategory::GAME: return "GAME";
+    default: return "LOG";
+    }
+}
+
+std::string Log::format(const LogRecord& record)
+{
+    std::ostringstream out;
+    const char* payload = record.payload;
+    uint8_t arg = 0;
+
+    for (const char* c = record.format ? record.format : ""; *c; ++c)
+    {
+        if (c[0] != '{' || c[1] != '}' || arg >= record.argCount)
+        {
+            out << *c;
+            continue;
+        }
+
+        // Substitute the next captured argument
+        switch (record.argTypes[arg++])
+        {
+        case LogArgType::INT: { int64_t v; std::memcpy(&v, payload, sizeof(v)); payload += sizeof(v); out << v; break; }
+        case LogArgType::UINT: { uint64_t v; std::memcpy(&v, payload, sizeof(v)); payload += sizeof(v); out << v; break; }
+        case LogArgType::DOUBLE: { double v; std::memcpy(&v, payload, sizeof(v)); payload += sizeof(v); out << v; break; }
+        case LogArgType::BOOL: { out << (*payload ? "true" : "false"); payload += 1; break; }
+        case LogArgType::CHAR: { out << *payload; payload += 1; break; }
+        case LogArgType::POINTER: { uintptr_t v; std::memcpy(&v, payload, sizeof(v)); payload += sizeof(v); out << reinterpret_cast<const void*>(v); break; }
+        case LogArgType::STRING:
+        {
+            uint16_t length;
+            std::memcpy(&length, payload, sizeof(length));
+            out.write(payload + sizeof(length), length);
+            payload += sizeof(length) + length;
+            break;
+        }
+        }
+        ++c; // Skip the closing brace
+    }
+
+    return out.str();
+}
@@ -0,0 +1,325 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * @file Log.h
+ * @brief Asynchronous engine logging.
+ *
+ * Log sites use the `SGE_LOG_<LEVEL>(CATEGORY, "format {}", args...)` macros. Messages below
+ * `SGE_LOG_MIN_LEVEL` or outside `SGE_LOG_CATEGORY_MASK` are removed at compile time. Everything
+ * else is captured into a fixed-size record (arguments copied by value, no formatting) and pushed
+ * to a lock-free queue; a background thread formats and writes the messages. Each log site is
+ * rate limited so a message repeated every frame cannot flood the output.
+ */
+
+/** @brief Minimum compiled-in level: 0 TRACE, 1 DEBUG, 2 INFO, 3 WARN, 4 ERROR, 5 nothing. */
+#ifndef SGE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define SGE_LOG_MIN_LEVEL 2
+#else
+#define SGE_LOG_MIN_LEVEL 1
+#endif
+#endif
+
+/** @brief Bit mask of compiled-in categories, bit N enables `LogCategory` value N. */
+#ifndef SGE_LOG_CATEGORY_MASK
+#define SGE_LOG_CATEGORY_MASK 0xFFFFFFFFu
+#endif
+
+/** @brief Maximum messages a single log site may emit per second before it is throttled. Errors are exempt. */
+#ifndef SGE_LOG_RATE_LIMIT
+#define SGE_LOG_RATE_LIMIT 20
+#endif
+
+#define SGE_LOG(level, category, ...) \
+    do \
+    { \
+        if constexpr (::ScrapGameEngine::Log::isCompiledIn(level, ::ScrapGameEngine::LogCategory::category)) \
+        { \
+            static ::ScrapGameEngine::LogRateLimiter sgeLogRateLimiter; \
+            ::ScrapGameEngine::Log::write(sgeLogRateLimiter, level, ::ScrapGameEngine::LogCategory::category, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define SGE_LOG_TRACE(category, ...) SGE_LOG(::ScrapGameEngine::LogLevel::TRACE, category, __VA_ARGS__)
+#define SGE_LOG_DEBUG(category, ...) SGE_LOG(::ScrapGameEngine::LogLevel::DEBUG, category, __VA_ARGS__)
+#define SGE_LOG_INFO(category, ...) SGE_LOG(::ScrapGameEngine::LogLevel::INFO, category, __VA_ARGS__)
+#define SGE_LOG_WARN(category, ...) SGE_LOG(::ScrapGameEngine::LogLevel::WARN, category, __VA_ARGS__)
+#define SGE_LOG_ERROR(category, ...) SGE_LOG(::ScrapGameEngine::LogLevel::ERR, category, __VA_ARGS__)
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum LogLevel
+     * @brief Severity of a log message.
+     */
+    enum class LogLevel : uint8_t
+    {
+        TRACE = 0,  /**< Very verbose diagnostics. */
+        DEBUG = 1,  /**< Diagnostics useful during development. */
+        INFO = 2,   /**< Normal operation. */
+        WARN = 3,   /**< Something unexpected that the engine recovered from. */
+        ERR = 4     /**< An operation failed. */
+    };
+
+    /**
+     * @enum LogCategory
+     * @brief Subsystem a log message belongs to, printed as its tag.
+     */
+    enum class LogCategory : uint8_t
+    {
+        FRAMEWORK,      /**< Application, window and time. */
+        RENDERER,       /**< Renderer and GPU resources. */
+        ALLOCATER,      /**< Mesh and texture allocators. */
+        SCHEDULER,      /**< Task scheduler. */
+        SCENE_MANAGER,  /**< Scene state machine. */
+        GAMEOBJECT,     /**< Game objects and components. */
+        TEXT,           /**< Text rendering. */
+        AUDIOSOURCE,    /**< Audio playback. */
+        INPUT,          /**< Input handling. */
+        REPLAY,         /**< Frame capture and replay. */
+        PROFILER,       /**< Profiler. */
+        GAME,           /**< Game code. */
+        COUNT           /**< Number of categories. */
+    };
+
+    /**
+     * @class LogRateLimiter
+     * @brief Per-site throttle allowing `SGE_LOG_RATE_LIMIT` messages per second.
+     *
+     * Messages over the limit are counted, and the count is appended to the next message that gets through.
+     * Errors are never throttled, a burst of them is what someone reading the log needs most.
+     */
+    class LogRateLimiter
+    {
+    public:
+        /**
+         * @brief Decides whether a message may be logged now.
+         * @param suppressed Receives the number of messages dropped since the last one that got through.
+         * @return True if the message should be logged.
+         */
+        bool allow(uint32_t& suppressed);
+
+    private:
+        std::atomic<uint64_t> windowStart{ 0 };   ///< Start of the current one second window in nanoseconds.
+        std::atomic<uint32_t> windowCount{ 0 };   ///< Messages seen in the current window.
+        std::atomic<uint32_t> suppressedCount{ 0 }; ///< Messages dropped since the last one logged.
+    };
+
+    /**
+     * @enum LogArgType
+     * @brief Type tag of an argument captured into a `LogRecord`.
+     */
+    enum class LogArgType : uint8_t
+    {
+        INT,        /**< Signed integer stored as int64_t. */
+        UINT,       /**< Unsigned integer stored as uint64_t. */
+        DOUBLE,     /**< Floating point stored as double. */
+        BOOL,       /**< Boolean stored as one byte. */
+        CHAR,       /**< Single character. */
+        STRING,     /**< Copied string: uint16_t length followed by the characters. */
+        POINTER     /**< Pointer value stored as uintptr_t. */
+    };
+
+    /**
+     * @struct LogRecord
+     * @brief A log message with its arguments captured by value, formatted later by the writer thread.
+     */
+    struct LogRecord
+    {
+        static const size_t MAX_ARGS = 8;       ///< Maximum number of captured arguments.
+        static const size_t PAYLOAD_SIZE = 224; ///< Bytes available for argument values.
+
+        const char* format = nullptr;           ///< Format string with `{}` placeholders, must be a literal.
+        uint32_t suppressed = 0;                ///< Messages of this site dropped by rate limiting.
+        LogLevel level = LogLevel::INFO;        ///< Severity.
+        LogCategory category = LogCategory::FRAMEWORK; ///< Category.
+        uint8_t argCount = 0;                   ///< Number of captured arguments.
+        uint16_t payloadSize = 0;               ///< Bytes used in `payload`.
+        LogArgType argTypes[MAX_ARGS];          ///< Type of each captured argument.
+        char payload[PAYLOAD_SIZE];             ///< Packed argument values.
+
+        /**
+         * @brief Appends raw bytes of an argument.
+         * @param type The argument type.
+         * @param data Pointer to the value.
+         * @param size Size of the value in bytes.
+         */
+        void pushValue(LogArgType type, const void* data, size_t size);
+
+        /**
+         * @brief Appends a string argument, truncating it to the remaining space.
+         * @param text The characters to copy.
+         * @param length The number of characters.
+         */
+        void pushString(const char* text, size_t length);
+    };
+
+    /**
+     * @class Log
+     * @brief Lock-free, asynchronous log sink. Use through the `SGE_LOG_*` macros.
+     *
+     * Producers on any thread push records into a bounded multi-producer queue; when the queue is
+     * full the record is dropped and counted instead of blocking the caller. The writer thread is
+     * started on first use and stopped by shutdown(), after which messages are written synchronously.
+     */
+    class Log
+    {
+    public:
+        Log() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Checks at compile time whether a level and category are compiled in.
+         * @param level The message level.
+         * @param category The message category.
+         * @return True if messages of this kind are kept.
+         */
+        static constexpr bool isCompiledIn(LogLevel level, LogCategory category)
+        {
+            return static_cast<int>(level) >= SGE_LOG_MIN_LEVEL &&
+                ((SGE_LOG_CATEGORY_MASK >> static_cast<unsigned int>(category)) & 1u) != 0;
+        }
+
+        /**
+         * @brief Sets the runtime minimum level on top of the compile-time filter.
+         * @param level Messages below this level are discarded.
+         */
+        static void setLevel(LogLevel level);
+
+        /**
+         * @brief Captures and queues a message. Use the macros instead of calling this directly.
+         * @param limiter The rate limiter of the log site.
+         * @param level The message level.
+         * @param category The message category.
+         * @param format The format string literal with `{}` placeholders.
+         * @param args The arguments, copied by value.
+         */
+        template <typename... Args>
+        static void write(LogRateLimiter& limiter, LogLevel level, LogCategory category, const char* format, const Args&... args)
+        {
+            if (static_cast<int>(level) < runtimeLevel.load(std::memory_order_relaxed)) return;
+
+            uint32_t suppressed = 0;
+            if (level < LogLevel::ERR && !limiter.allow(suppressed)) return;
+
+            LogRecord record;
+            record.format = format;
+            record.level = level;
+            record.category = category;
+            record.suppressed = suppressed;
+            (capture(record, args), ...);
+
+            submit(record);
+        }
+
+        /**
+         * @brief Blocks until every message queued before the call has been written.
+         */
+        static void flush();
+
+        /**
+         * @brief Drains the queue and stops the writer thread.
+         *
+         * Later messages are written synchronously on the calling thread.
+         */
+        static void shutdown();
+
+        /**
+         * @brief Gets the number of messages dropped because the queue was full.
+         * @return The dropped message count.
+         */
+        static uint64_t getDroppedCount();
+
+        /**
+         * @brief Gets the tag printed for a category.
+         * @param category The category.
+         * @return The tag without brackets.
+         */
+        static const char* getCategoryName(LogCategory category);
+
+        /**
+         * @brief Formats a record into its final text, without the tag.
+         * @param record The record to format.
+         * @return The formatted message.
+         */
+        static std::string format(const LogRecord& record);
+
+    private:
+        /**
+         * @brief Queues a record, starting the writer thread if needed.
+         * @param record The record to queue.
+         */
+        static void submit(const LogRecord& record);
+
+        static std::atomic<int> runtimeLevel; ///< Runtime minimum level.
+
+        /**
+         * @brief Captures one argument into a record.
+         * @param record The record to append to.
+         * @param value The argument value.
+         */
+        template <typename T>
+        static void capture(LogRecord& record, const T& value)
+        {
+            using Type = std::decay_t<T>;
+
+            if constexpr (std::is_same_v<Type, bool>)
+            {
+                uint8_t v = value ? 1 : 0;
+                record.pushValue(LogArgType::BOOL, &v, sizeof(v));
+            }
+            else if constexpr (std::is_same_v<Type, char>)
+            {
+                record.pushValue(LogArgType::CHAR, &value, sizeof(char));
+            }
+            else if constexpr (std::is_enum_v<Type>)
+            {
+                int64_t v = static_cast<int64_t>(value);
+                record.pushValue(LogArgType::INT, &v, sizeof(v));
+            }
+            else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+            {
+                int64_t v = static_cast<int64_t>(value);
+                record.pushValue(LogArgType::INT, &v, sizeof(v));
+            }
+            else if constexpr (std::is_integral_v<Type>)
+            {
+                uint64_t v = static_cast<uint64_t>(value);
+                record.pushValue(LogArgType::UINT, &v, sizeof(v));
+            }
+            else if constexpr (std::is_floating_point_v<Type>)
+            {
+                double v = static_cast<double>(value);
+                record.pushValue(LogArgType::DOUBLE, &v, sizeof(v));
+            }
+            else if constexpr (std::is_same_v<Type, std::string>)
+            {
+                record.pushString(value.data(), value.size());
+            }
+            else if constexpr (std::is_array_v<T>)
+            {
+                // Character arrays and literals may not outlive the call, so copy them
+                static_assert(std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>, "Unsupported log argument type");
+                record.pushString(value, std::strlen(value));
+            }
+            else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>)
+            {
+                // Strings may not outlive the call, so copy them
+                record.pushString(value ? value : "(null)", value ? std::strlen(value) : 6);
+            }
+            else if constexpr (std::is_pointer_v<Type>)
+            {
+                uintptr_t v = reinterpret_cast<uintptr_t>(value);
+                record.pushValue(LogArgType::POINTER, &v, sizeof(v));
+            }
+            else
+            {
+                static_assert(std::is_pointer_v<Type>, "Unsupported log argument type");
+            }
+        }
+    };
+}
@@ -1,26 +1,36 @@
-#pragma once
-#include "BaseScene.h"
-#include <glm/vec2.hpp>
-#include "GameObject.h"
-#include "Texture2D.h"
-#include <memory>
-
-using namespace ScrapGameEngine;
-
-class MainMenuScene : public BaseScene
-{
-public:
-    std::string getName() const override { return "MainMenuScene"; }
-protected:
-
-    void onInitialize() override;
-    void onUpdate(float deltaTime) override;
-    void onRender() override;
-    void onDeactivate() override;
-
-    float time;
-
-private:
-    static std::unique_ptr<GameObject> gameObject;
-    Texture2D* texture;
-};
+#pragma once
+#include "BaseScene.h"
+#include <glm/vec2.hpp>
+#include "GameObject.h"
+#include "Texture2D.h"
+#include <memory>
+
+using namespace ScrapGameEngine;
+
+class MainMenuScene : public BaseScene
+{
+public:
+    std::string getName() const override { return "MainMenuScene"; }
+    void declareAssets(SceneManifest& manifest) const override;
+protected:
+
+    void onInitialize() override;
+    void onUpdate(float deltaTime) override;
+    void onRender() override;
+    void onDeactivate() override;
+    void onSuspend() override;
+
+    float time;
+
+private:
+    static std::unique_ptr<GameObject> gameObject;
+
+    // Shared with declareAssets so the preloaded texture matches the scene's load
+    static TextureConfig getButtonTextureConfig();
+
+    // Stops the pending switch to the game, if the button was clicked
+    void cancelLoadTask();
+
+    Texture2D* texture;
+    uint64_t loadTask = 0; // Scheduler task waiting for the click sound, 0 if none
+};
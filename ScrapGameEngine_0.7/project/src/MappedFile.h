@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class MappedFile
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * The contents are paged in by the OS on first access instead of being copied into a
+     * buffer, so data formats laid out for direct use can be read in place. The mapping
+     * starts on a page boundary, which keeps records aligned if the format aligns them.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Maps a file, unmapping any file mapped before.
+         * @param path The file path.
+         * @return False if the file is missing, empty or cannot be mapped.
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief Unmaps the file. Safe to call when nothing is mapped.
+         */
+        void close();
+
+        /**
+         * @brief Gets the mapped contents.
+         * @return The first byte of the file, or null if nothing is mapped.
+         */
+        const unsigned char* getData() const { return data; }
+
+        /**
+         * @brief Gets the size of the mapped file.
+         * @return The size in bytes.
+         */
+        size_t getSize() const { return size; }
+
+    private:
+        const unsigned char* data = nullptr;    ///< Start of the mapping.
+        size_t size = 0;                        ///< Size of the mapping.
+#ifdef _WIN32
+        void* fileHandle = nullptr;             ///< Handle of the open file.
+        void* mappingHandle = nullptr;          ///< Handle of the file mapping.
+#endif
+    };
+}
@@ -0,0 +1,212 @@
+#include "MemoryTracker.h"
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include "Log.h"
+
+using namespace ScrapGameEngine;
+
+MemoryTracker::Counters MemoryTracker::counters[static_cast<size_t>(MemoryTag::COUNT)];
+uint64_t MemoryTracker::frameStartHeapAllocations = 0;
+uint64_t MemoryTracker::lastFrameHeapAllocations = 0;
+
+namespace
+{
+    std::atomic<uint64_t> heapAllocations{ 0 };
+
+    void raisePeak(std::atomic<uint64_t>& peak, uint64_t value)
+    {
+        uint64_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    double toKilobytes(uint64_t bytes)
+    {
+        return bytes / 1024.0;
+    }
+}
+
+#ifdef SGE_COUNT_HEAP_ALLOCATIONS
+// Count every heap allocation in the program; array and nothrow forms forward to these
+void* operator new(size_t size)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+void* MemoryTracker::allocate(size_t size, MemoryTag tag)
+{
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+
+    recordAllocation(tag, size);
+    return ptr;
+}
+
+void MemoryTracker::deallocate(void* ptr, size_t size, MemoryTag tag)
+{
+    if (!ptr) return;
+
+    recordFree(tag, size);
+    std::free(ptr);
+}
+
+void MemoryTracker::recordAllocation(MemoryTag tag, size_t size)
+{
+    Counters& c = counters[static_cast<size_t>(tag)];
+
+    uint64_t current = c.currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    raisePeak(c.peakBytes, current);
+    c.currentCount.fetch_add(1, std::memory_order_relaxed);
+    c.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::recordFree(MemoryTag tag, size_t size)
+{
+    Counters& c = counters[static_cast<size_t>(tag)];
+
+    c.currentBytes.fetch_sub(size, std::memory_order_relaxed);
+    c.currentCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::beginFrame()
+{
+    for (Counters& c : counters)
+    {
+        uint64_t total = c.totalAllocations.load(std::memory_order_relaxed);
+        uint64_t start = c.frameStartAllocations.exchange(total, std::memory_order_relaxed);
+        c.lastFrameAllocations.store(total - start, std::memory_order_relaxed);
+    }
+
+    uint64_t heapTotal = heapAllocations.load(std::memory_order_relaxed);
+    lastFrameHeapAllocations = heapTotal - frameStartHeapAllocations;
+    frameStartHeapAllocations = heapTotal;
+}
+
+MemoryStats MemoryTracker::getStats(MemoryTag tag)
+{
+    const Counters& c = counters[static_cast<size_t>(tag)];
+
+    MemoryStats stats;
+    stats.currentBytes = c.currentBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+    stats.currentCount = c.currentCount.load(std::memory_order_relaxed);
+    stats.totalAllocations = c.totalAllocations.load(std::memory_order_relaxed);
+    stats.frameAllocations = c.lastFrameAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t MemoryTracker::getTotalBytes(bool gpu)
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::COUNT); ++i)
+    {
+        if (isGpuTag(static_cast<MemoryTag>(i)) == gpu)
+        {
+            total += counters[i].currentBytes.load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+uint64_t MemoryTracker::getFrameAllocationCount()
+{
+    uint64_t total = 0;
+    for (const Counters& c : counters)
+    {
+        total += c.lastFrameAllocations.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t MemoryTracker::getFrameHeapAllocationCount()
+{
+    return lastFrameHeapAllocations;
+}
+
+void MemoryTracker::resetPeaks()
+{
+    for (Counters& c : counters)
+    {
+        c.peakBytes.store(c.currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+const char* MemoryTracker::getTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::GENERAL: return "General";
+    case MemoryTag::GAMEOBJECT: return "GameObject";
+    case MemoryTag::COMPONENT: return "Component";
+    case MemoryTag::SCENE: return "Scene";
+    case MemoryTag::FRAME: return "Frame Arena";
+    case MemoryTag::GPU_TEXTURE: return "GPU Texture";
+    case MemoryTag::GPU_BUFFER: return "GPU Buffer";
+    default: return "Unknown";
+    }
+}
+
+bool MemoryTracker::isGpuTag(MemoryTag tag)
+{
+    return tag == MemoryTag::GPU_TEXTURE || tag == MemoryTag::GPU_BUFFER;
+}
+
+void MemoryTracker::writeReport(std::ostream& out)
+{
+    out << std::left << std::setw(14) << "Tag"
+        << std::right << std::setw(14) << "Current KB"
+        << std::setw(14) << "Peak KB"
+        << std::setw(10) << "Live"
+        << std::setw(12) << "Total"
+        << std::setw(12) << "Last Frame" << '\n';
+
+    out << std::fixed << std::setprecision(1);
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::COUNT); ++i)
+    {
+        MemoryStats stats = getStats(static_cast<MemoryTag>(i));
+        out << std::left << std::setw(14) << getTagName(static_cast<MemoryTag>(i))
+            << std::right << std::setw(14) << toKilobytes(stats.currentBytes)
+            << std::setw(14) << toKilobytes(stats.peakBytes)
+            << std::setw(10) << stats.currentCount
+            << std::setw(12) << stats.totalAllocations
+            << std::setw(12) << stats.frameAllocations << '\n';
+    }
+
+    out << "CPU total: " << toKilobytes(getTotalBytes(false)) << " KB, GPU total: " << toKilobytes(getTotalBytes(true)) << " KB\n";
+    if (isHeapCountingCompiledIn())
+    {
+        out << "Heap allocations last frame: " << getFrameHeapAllocationCount() << '\n';
+    }
+}
+
+bool MemoryTracker::dumpReport(const std::string& path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        SGE_LOG_ERROR(FRAMEWORK, "Failed to create memory report: {}", path);
+        return false;
+    }
+
+    writeReport(file);
+    SGE_LOG_INFO(FRAMEWORK, "Memory report written to: {}", path);
+    return true;
+}
@@ -0,0 +1,200 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum MemoryTag
+     * @brief Subsystem an allocation is charged to.
+     *
+     * CPU tags count heap memory; GPU tags count the estimated size of GPU resources.
+     */
+    enum class MemoryTag : uint8_t
+    {
+        GENERAL,        /**< Untagged engine allocations. */
+        GAMEOBJECT,     /**< GameObject instances. */
+        COMPONENT,      /**< Components attached to GameObjects. */
+        SCENE,          /**< Scene instances. */
+        FRAME,          /**< Frame allocator arenas. */
+        GPU_TEXTURE,    /**< Texture storage on the GPU. */
+        GPU_BUFFER,     /**< Vertex buffers on the GPU. */
+        COUNT           /**< Number of tags. */
+    };
+
+    /**
+     * @struct MemoryStats
+     * @brief Snapshot of the counters of one tag.
+     */
+    struct MemoryStats
+    {
+        uint64_t currentBytes = 0;      ///< Bytes currently allocated.
+        uint64_t peakBytes = 0;         ///< High-water mark of currentBytes.
+        uint64_t currentCount = 0;      ///< Allocations currently alive.
+        uint64_t totalAllocations = 0;  ///< Allocations made since startup.
+        uint64_t frameAllocations = 0;  ///< Allocations made during the last completed frame.
+    };
+
+    /**
+     * @class MemoryTracker
+     * @brief Engine-wide, per-tag memory accounting.
+     *
+     * Classes opt in by deriving from `TrackedAllocation<Tag>`, which routes their `new` and
+     * `delete` through allocate() and deallocate(). GPU resources are not heap memory, so their
+     * owners report them with recordAllocation() and recordFree() instead. All counters are atomic
+     * and may be updated from any thread.
+     */
+    class MemoryTracker
+    {
+    public:
+        MemoryTracker() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Allocates heap memory and charges it to a tag.
+         * @param size The number of bytes.
+         * @param tag The tag to charge.
+         * @return The allocated memory. Throws `std::bad_alloc` on failure, like `operator new`.
+         */
+        static void* allocate(size_t size, MemoryTag tag);
+
+        /**
+         * @brief Frees memory returned by allocate().
+         * @param ptr The memory to free, may be null.
+         * @param size The size passed to allocate().
+         * @param tag The tag passed to allocate().
+         */
+        static void deallocate(void* ptr, size_t size, MemoryTag tag);
+
+        /**
+         * @brief Records an allocation made outside the tracker, such as a GPU resource.
+         * @param tag The tag to charge.
+         * @param size The number of bytes.
+         */
+        static void recordAllocation(MemoryTag tag, size_t size);
+
+        /**
+         * @brief Records the release of an allocation reported with recordAllocation().
+         * @param tag The tag that was charged.
+         * @param size The number of bytes.
+         */
+        static void recordFree(MemoryTag tag, size_t size);
+
+        /**
+         * @brief Closes the current frame, latching its allocation counts.
+         *
+         * Called by the application at the start of each frame.
+         */
+        static void beginFrame();
+
+        /**
+         * @brief Gets the counters of a tag.
+         * @param tag The tag.
+         * @return A snapshot of the counters.
+         */
+        static MemoryStats getStats(MemoryTag tag);
+
+        /**
+         * @brief Gets the bytes currently allocated across all CPU or all GPU tags.
+         * @param gpu True for GPU tags, false for CPU tags.
+         * @return The total in bytes.
+         */
+        static uint64_t getTotalBytes(bool gpu);
+
+        /**
+         * @brief Gets the number of allocations made during the last completed frame, all tags.
+         * @return The allocation count.
+         */
+        static uint64_t getFrameAllocationCount();
+
+        /**
+         * @brief Gets the number of global heap allocations made during the last completed frame.
+         *
+         * Only counted when `SGE_COUNT_HEAP_ALLOCATIONS` is defined, which replaces the global
+         * `operator new`; always 0 otherwise.
+         *
+         * @return The heap allocation count.
+         */
+        static uint64_t getFrameHeapAllocationCount();
+
+        /**
+         * @brief Checks whether global heap allocations are counted.
+         * @return True if `SGE_COUNT_HEAP_ALLOCATIONS` is defined.
+         */
+        static constexpr bool isHeapCountingCompiledIn()
+        {
+#ifdef SGE_COUNT_HEAP_ALLOCATIONS
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Resets the high-water marks to the current usage.
+         */
+        static void resetPeaks();
+
+        /**
+         * @brief Gets the printable name of a tag.
+         * @param tag The tag.
+         * @return The name.
+         */
+        static const char* getTagName(MemoryTag tag);
+
+        /**
+         * @brief Checks whether a tag counts GPU memory.
+         * @param tag The tag.
+         * @return True for GPU tags.
+         */
+        static bool isGpuTag(MemoryTag tag);
+
+        /**
+         * @brief Writes a table of all tags.
+         * @param out The stream to write to.
+         */
+        static void writeReport(std::ostream& out);
+
+        /**
+         * @brief Writes the report to a file.
+         * @param path The path of the file to write.
+         * @return True if the file was written.
+         */
+        static bool dumpReport(const std::string& path);
+
+    private:
+        /**
+         * @struct Counters
+         * @brief Live counters of one tag.
+         */
+        struct Counters
+        {
+            std::atomic<uint64_t> currentBytes{ 0 };
+            std::atomic<uint64_t> peakBytes{ 0 };
+            std::atomic<uint64_t> currentCount{ 0 };
+            std::atomic<uint64_t> totalAllocations{ 0 };
+            std::atomic<uint64_t> frameStartAllocations{ 0 }; ///< totalAllocations when the current frame began.
+            std::atomic<uint64_t> lastFrameAllocations{ 0 };  ///< Allocations of the last completed frame.
+        };
+
+        static Counters counters[static_cast<size_t>(MemoryTag::COUNT)]; ///< Counters per tag.
+        static uint64_t frameStartHeapAllocations; ///< Heap allocation count when the current frame began.
+        static uint64_t lastFrameHeapAllocations;  ///< Heap allocations of the last completed frame.
+    };
+
+    /**
+     * @class TrackedAllocation
+     * @brief Base class routing the heap allocations of derived classes to a memory tag.
+     *
+     * Deleting through a base pointer reports the correct size as long as the base has a virtual destructor.
+     */
+    template <MemoryTag Tag>
+    class TrackedAllocation
+    {
+    public:
+        static void* operator new(size_t size) { return MemoryTracker::allocate(size, Tag); }
+        static void operator delete(void* ptr, size_t size) { MemoryTracker::deallocate(ptr, size, Tag); }
+    };
+}
@@ -0,0 +1,95 @@
+#include "ParticleEmitter.h"
+#include "GameObject.h"
+#include "Graphics.h"
+#include "Profiler.h"
+#include <cmath>
+#include <glm/trigonometric.hpp>
+
+using namespace ScrapGameEngine;
+
+ParticleEmitter::ParticleEmitter(GameObject* owner)
+    : BaseComponent(owner), seed(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(owner) >> 4) | 1u)
+{
+}
+
+void ParticleEmitter::awake()
+{
+    if (pool.getCapacity() != settings.maxParticles)
+    {
+        pool.setCapacity(settings.maxParticles);
+    }
+}
+
+void ParticleEmitter::setSettings(const ParticleEmitterSettings& newSettings)
+{
+    bool resize = newSettings.maxParticles != settings.maxParticles;
+    settings = newSettings;
+    if (resize)
+    {
+        pool.setCapacity(settings.maxParticles);
+    }
+}
+
+void ParticleEmitter::update(float deltaTime)
+{
+    SGE_PROFILE_SCOPE("ParticleEmitter::update");
+
+    if (emitting && settings.rate > 0.0f)
+    {
+        emitDebt += settings.rate * deltaTime;
+        uint32_t due = static_cast<uint32_t>(emitDebt);
+        emitDebt -= static_cast<float>(due);
+        emit(due);
+    }
+
+    pool.simulate(deltaTime, settings.gravity, settings.drag);
+}
+
+void ParticleEmitter::emit(uint32_t count)
+{
+    if (pool.getCapacity() == 0)
+    {
+        awake();
+    }
+
+    glm::vec2 origin = gameObject->transform->getPosition();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        float angle = glm::radians(settings.direction + random(-0.5f, 0.5f) * settings.spread);
+        float speed = random(settings.speedMin, settings.speedMax);
+        glm::vec2 velocity(std::cos(angle) * speed, std::sin(angle) * speed);
+
+        if (!pool.spawn(origin, velocity, random(settings.lifetimeMin, settings.lifetimeMax),
+            settings.startColor, settings.endColor, settings.startSize, settings.endSize))
+        {
+            break; // Full, the rest would be dropped as well
+        }
+    }
+}
+
+void ParticleEmitter::render()
+{
+    if (pool.getCount() == 0) return;
+
+    SGE_PROFILE_SCOPE("ParticleEmitter::render");
+
+    vertices.resize(pool.getCount() * 6);
+    size_t vertexCount = pool.writeQuads(vertices.data());
+
+    // Positions are already in world space
+    RenderParams params{};
+    params.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+    params.scale = { 1.0f, 1.0f, 1.0f };
+    params.texture = texture;
+
+    Graphics::drawDynamic(vertices.data(), static_cast<unsigned int>(vertexCount), params);
+}
+
+float ParticleEmitter::random(float min, float max)
+{
+    // xorshift32, plenty for scattering particles
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return min + (max - min) * (static_cast<float>(seed >> 8) * (1.0f / 16777216.0f));
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "BaseComponent.h"
+#include "ParticlePool.h"
+#include "Texture2D.h"
+#include <cstdint>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct ParticleEmitterSettings
+     * @brief How an emitter spawns its particles and how they move.
+     */
+    struct ParticleEmitterSettings
+    {
+        uint32_t maxParticles = 256;                ///< Pool capacity. Vertices go through the dynamic geometry ring, 144 bytes per particle.
+        float rate = 0.0f;                          ///< Particles per second while emitting, 0 for bursts only.
+        float lifetimeMin = 0.5f;                   ///< Shortest lifetime in seconds.
+        float lifetimeMax = 1.0f;                   ///< Longest lifetime in seconds.
+        float speedMin = 0.5f;                      ///< Slowest launch speed.
+        float speedMax = 1.0f;                      ///< Fastest launch speed.
+        float direction = 90.0f;                    ///< Launch direction in degrees, 90 is up.
+        float spread = 360.0f;                      ///< Launch cone width in degrees.
+        glm::vec2 gravity{ 0.0f, -1.0f };           ///< Acceleration of every particle.
+        float drag = 0.0f;                          ///< Fraction of velocity lost per second.
+        float startSize = 0.05f;                    ///< Quad size at birth.
+        float endSize = 0.0f;                       ///< Quad size at death.
+        glm::vec4 startColor{ 1.0f };               ///< Color at birth.
+        glm::vec4 endColor{ 1.0f, 1.0f, 1.0f, 0.0f }; ///< Color at death.
+    };
+
+    /**
+     * @class ParticleEmitter
+     * @brief Component that spawns particles at its owner's position and draws them in one call.
+     *
+     * Particles live in world space, so moving the owner does not drag the particles already
+     * emitted. They are simulated in `update` and drawn as one batch of colored quads.
+     */
+    class ParticleEmitter : public BaseComponent
+    {
+    public:
+        /**
+         * @brief Constructor for ParticleEmitter.
+         * @param owner Pointer to the GameObject that owns this component.
+         */
+        ParticleEmitter(GameObject* owner);
+
+        /**
+         * @brief Sizes the particle pool.
+         */
+        void awake() override;
+
+        /**
+         * @brief Spawns the particles due and simulates the live ones.
+         * @param deltaTime The time elapsed since the last frame.
+         */
+        void update(float deltaTime) override;
+
+        /**
+         * @brief Draws the live particles.
+         */
+        void render() override;
+
+        /**
+         * @brief Replaces the settings. Changing `maxParticles` discards the live particles.
+         * @param newSettings The settings.
+         */
+        void setSettings(const ParticleEmitterSettings& newSettings);
+
+        /**
+         * @brief Gets the settings.
+         * @return The settings.
+         */
+        const ParticleEmitterSettings& getSettings() const { return settings; }
+
+        /**
+         * @brief Spawns particles at once, as many as the pool has room for.
+         * @param count The number of particles.
+         */
+        void emit(uint32_t count);
+
+        /**
+         * @brief Starts or stops the continuous emission at `rate`. Live particles carry on.
+         * @param enabled True to emit.
+         */
+        void setEmitting(bool enabled) { emitting = enabled; }
+
+        /**
+         * @brief Sets the texture drawn on every particle.
+         * @param newTexture The texture, or null for plain quads.
+         */
+        void setTexture(Texture2D* newTexture) { texture = newTexture; }
+
+        /**
+         * @brief Gets the number of live particles.
+         * @return The particle count.
+         */
+        size_t getParticleCount() const { return pool.getCount(); }
+
+        /**
+         * @brief Removes every particle.
+         */
+        void clear() { pool.clear(); }
+
+    private:
+        /**
+         * @brief Draws a random number.
+         * @param min The lower bound.
+         * @param max The upper bound.
+         * @return A number between the bounds.
+         */
+        float random(float min, float max);
+
+        ParticleEmitterSettings settings;   ///< Emission and motion settings.
+        ParticlePool pool;                  ///< Live particles.
+        std::vector<ColorVertex> vertices;  ///< Quads of the last render, reused.
+        Texture2D* texture = nullptr;       ///< Texture of every particle.
+        float emitDebt = 0.0f;              ///< Fraction of a particle owed to `rate`.
+        bool emitting = true;               ///< Whether `rate` applies.
+        uint32_t seed;                      ///< Random state.
+    };
+}
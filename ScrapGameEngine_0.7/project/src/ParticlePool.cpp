@@ -0,0 +1,213 @@
+#include "ParticlePool.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGE_PARTICLE_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    uint8_t toByte(float value)
+    {
+        return static_cast<uint8_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+    }
+}
+
+ParticlePool::ParticlePool(size_t capacity)
+{
+    setCapacity(capacity);
+}
+
+void ParticlePool::setCapacity(size_t newCapacity)
+{
+    capacity = newCapacity;
+    count = 0;
+    for (auto& stream : streams)
+    {
+        stream.assign(capacity, 0.0f);
+    }
+}
+
+bool ParticlePool::spawn(const glm::vec2& position, const glm::vec2& velocity, float lifetime,
+    const glm::vec4& color, const glm::vec4& endColor, float size, float endSize)
+{
+    if (count >= capacity)
+    {
+        return false;
+    }
+
+    // Color and size change at a constant rate, so integrating them is one multiply-add
+    lifetime = std::max(lifetime, 1e-4f);
+    float inverseLifetime = 1.0f / lifetime;
+    size_t i = count++;
+
+    streams[POSITION_X][i] = position.x;
+    streams[POSITION_Y][i] = position.y;
+    streams[VELOCITY_X][i] = velocity.x;
+    streams[VELOCITY_Y][i] = velocity.y;
+    streams[AGE][i] = 0.0f;
+    streams[LIFETIME][i] = lifetime;
+    streams[RED][i] = color.r;
+    streams[GREEN][i] = color.g;
+    streams[BLUE][i] = color.b;
+    streams[ALPHA][i] = color.a;
+    streams[RED_RATE][i] = (endColor.r - color.r) * inverseLifetime;
+    streams[GREEN_RATE][i] = (endColor.g - color.g) * inverseLifetime;
+    streams[BLUE_RATE][i] = (endColor.b - color.b) * inverseLifetime;
+    streams[ALPHA_RATE][i] = (endColor.a - color.a) * inverseLifetime;
+    streams[SIZE][i] = size;
+    streams[SIZE_RATE][i] = (endSize - size) * inverseLifetime;
+    return true;
+}
+
+void ParticlePool::simulate(float deltaTime, const glm::vec2& gravity, float drag)
+{
+    integrate(deltaTime, gravity, drag);
+    compact();
+}
+
+void ParticlePool::integrate(float deltaTime, const glm::vec2& gravity, float drag)
+{
+    float* positionX = streams[POSITION_X].data();
+    float* positionY = streams[POSITION_Y].data();
+    float* velocityX = streams[VELOCITY_X].data();
+    float* velocityY = streams[VELOCITY_Y].data();
+    float* age = streams[AGE].data();
+
+    const float damping = std::max(1.0f - drag * deltaTime, 0.0f);
+    const float gravityX = gravity.x * deltaTime;
+    const float gravityY = gravity.y * deltaTime;
+    size_t i = 0;
+
+#ifdef SGE_PARTICLE_SSE2
+    const __m128 step = _mm_set1_ps(deltaTime);
+    const __m128 damping4 = _mm_set1_ps(damping);
+    const __m128 gravityX4 = _mm_set1_ps(gravityX);
+    const __m128 gravityY4 = _mm_set1_ps(gravityY);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityX + i), gravityX4), damping4);
+        __m128 vy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityY + i), gravityY4), damping4);
+        _mm_storeu_ps(velocityX + i, vx);
+        _mm_storeu_ps(velocityY + i, vy);
+        _mm_storeu_ps(positionX + i, _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(vx, step)));
+        _mm_storeu_ps(positionY + i, _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(vy, step)));
+        _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), step));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        velocityX[i] = (velocityX[i] + gravityX) * damping;
+        velocityY[i] = (velocityY[i] + gravityY) * damping;
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        age[i] += deltaTime;
+    }
+
+    // Color and size move at the rate set when spawned
+    const Stream rated[][2] = { { RED, RED_RATE }, { GREEN, GREEN_RATE }, { BLUE, BLUE_RATE }, { ALPHA, ALPHA_RATE }, { SIZE, SIZE_RATE } };
+    for (const auto& pair : rated)
+    {
+        float* value = streams[pair[0]].data();
+        const float* rate = streams[pair[1]].data();
+        size_t j = 0;
+
+#ifdef SGE_PARTICLE_SSE2
+        for (; j + 4 <= count; j += 4)
+        {
+            _mm_storeu_ps(value + j, _mm_add_ps(_mm_loadu_ps(value + j), _mm_mul_ps(_mm_loadu_ps(rate + j), step)));
+        }
+#endif
+
+        for (; j < count; ++j)
+        {
+            value[j] += rate[j] * deltaTime;
+        }
+    }
+}
+
+size_t ParticlePool::compact()
+{
+    const float* age = streams[AGE].data();
+    const float* lifetime = streams[LIFETIME].data();
+    size_t removed = 0;
+    size_t i = 0;
+
+    while (i < count)
+    {
+#ifdef SGE_PARTICLE_SSE2
+        // Skip four live particles with one comparison
+        if (i + 4 <= count && _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(age + i), _mm_loadu_ps(lifetime + i))) == 0)
+        {
+            i += 4;
+            continue;
+        }
+#endif
+
+        if (age[i] >= lifetime[i])
+        {
+            // The moved particle is checked in turn, it may be dead too
+            --count;
+            ++removed;
+            if (i != count)
+            {
+                for (auto& stream : streams)
+                {
+                    stream[i] = stream[count];
+                }
+            }
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return removed;
+}
+
+size_t ParticlePool::writeQuads(ColorVertex* vertices) const
+{
+    const float* positionX = streams[POSITION_X].data();
+    const float* positionY = streams[POSITION_Y].data();
+    const float* red = streams[RED].data();
+    const float* green = streams[GREEN].data();
+    const float* blue = streams[BLUE].data();
+    const float* alpha = streams[ALPHA].data();
+    const float* size = streams[SIZE].data();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float half = std::max(size[i], 0.0f) * 0.5f;
+        float left = positionX[i] - half;
+        float right = positionX[i] + half;
+        float bottom = positionY[i] - half;
+        float top = positionY[i] + half;
+        uint8_t r = toByte(red[i]);
+        uint8_t g = toByte(green[i]);
+        uint8_t b = toByte(blue[i]);
+        uint8_t a = toByte(alpha[i]);
+
+        ColorVertex* quad = vertices + i * 6;
+        quad[0] = { left, top, 0.0f, 0.0f, 1.0f, r, g, b, a };
+        quad[1] = { left, bottom, 0.0f, 0.0f, 0.0f, r, g, b, a };
+        quad[2] = { right, bottom, 0.0f, 1.0f, 0.0f, r, g, b, a };
+        quad[3] = { right, bottom, 0.0f, 1.0f, 0.0f, r, g, b, a };
+        quad[4] = { right, top, 0.0f, 1.0f, 1.0f, r, g, b, a };
+        quad[5] = { left, top, 0.0f, 0.0f, 1.0f, r, g, b, a };
+    }
+    return count * 6;
+}
+
+bool ParticlePool::isSimdCompiledIn()
+{
+#ifdef SGE_PARTICLE_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include "Mesh.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class ParticlePool
+     * @brief Fixed capacity particle storage with one array per attribute.
+     *
+     * Live particles are packed at the front of every array. `integrate` moves them four at a time
+     * with SSE2 where available, and `compact` moves the last live particle into each dead one's
+     * slot, so particles do not keep their spawn order.
+     */
+    class ParticlePool
+    {
+    public:
+        /**
+         * @brief Creates a pool.
+         * @param capacity The maximum number of live particles.
+         */
+        explicit ParticlePool(size_t capacity = 0);
+
+        /**
+         * @brief Resizes the pool, discarding every particle.
+         * @param capacity The maximum number of live particles.
+         */
+        void setCapacity(size_t capacity);
+
+        /**
+         * @brief Adds a particle.
+         * @param position The world position.
+         * @param velocity The velocity in units per second.
+         * @param lifetime The time it lives in seconds.
+         * @param color The color at birth.
+         * @param endColor The color at death, reached linearly.
+         * @param size The quad size at birth.
+         * @param endSize The quad size at death.
+         * @return False if the pool is full.
+         */
+        bool spawn(const glm::vec2& position, const glm::vec2& velocity, float lifetime,
+            const glm::vec4& color, const glm::vec4& endColor, float size, float endSize);
+
+        /**
+         * @brief Ages and moves every particle, then removes the dead ones.
+         * @param deltaTime The time step.
+         * @param gravity The acceleration applied to every particle.
+         * @param drag The fraction of velocity lost per second.
+         */
+        void simulate(float deltaTime, const glm::vec2& gravity, float drag);
+
+        /**
+         * @brief Ages and moves every particle, the dead included.
+         * @param deltaTime The time step.
+         * @param gravity The acceleration applied to every particle.
+         * @param drag The fraction of velocity lost per second.
+         */
+        void integrate(float deltaTime, const glm::vec2& gravity, float drag);
+
+        /**
+         * @brief Removes the particles that outlived their lifetime.
+         * @return The number removed.
+         */
+        size_t compact();
+
+        /**
+         * @brief Writes two triangles per live particle.
+         * @param vertices Receives `getCount() * 6` vertices.
+         * @return The number of vertices written.
+         */
+        size_t writeQuads(ColorVertex* vertices) const;
+
+        /**
+         * @brief Removes every particle.
+         */
+        void clear() { count = 0; }
+
+        /**
+         * @brief Gets the number of live particles.
+         * @return The particle count.
+         */
+        size_t getCount() const { return count; }
+
+        /**
+         * @brief Gets the maximum number of live particles.
+         * @return The capacity.
+         */
+        size_t getCapacity() const { return capacity; }
+
+        /**
+         * @brief Checks whether `integrate` and `compact` use SSE2.
+         * @return True if the SIMD kernels were compiled in.
+         */
+        static bool isSimdCompiledIn();
+
+    private:
+        /** @brief The attributes, one array each. */
+        enum Stream
+        {
+            POSITION_X, POSITION_Y,
+            VELOCITY_X, VELOCITY_Y,
+            AGE, LIFETIME,
+            RED, GREEN, BLUE, ALPHA,
+            RED_RATE, GREEN_RATE, BLUE_RATE, ALPHA_RATE,
+            SIZE, SIZE_RATE,
+            STREAM_COUNT
+        };
+
+        std::array<std::vector<float>, STREAM_COUNT> streams;   ///< Attribute arrays, `capacity` long.
+        size_t capacity = 0;                                    ///< Length of every array.
+        size_t count = 0;                                       ///< Live particles, packed at the front.
+    };
+}
@@ -0,0 +1,284 @@
+#include "Prefab.h"
+#include "SceneRecords.h"
+#include "TextureAllocator.h"
+#include "MeshAllocater.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "AudioSource.h"
+#include "TweenComponent.h"
+#include "Profiler.h"
+
+using namespace ScrapGameEngine;
+
+PrefabOverrides::PrefabOverrides(const Prefab& prefab) : prefab(&prefab)
+{
+}
+
+PrefabOverrides& PrefabOverrides::setName(const std::string& value)
+{
+    name = value;
+    return *this;
+}
+
+PrefabOverrides& PrefabOverrides::setPosition(const glm::vec2& value)
+{
+    position = value;
+    transformMask |= POSITION;
+    return *this;
+}
+
+PrefabOverrides& PrefabOverrides::setRotation(float value)
+{
+    rotation = value;
+    transformMask |= ROTATION;
+    return *this;
+}
+
+PrefabOverrides& PrefabOverrides::setScale(const glm::vec2& value)
+{
+    scale = value;
+    transformMask |= SCALE;
+    return *this;
+}
+
+template <typename Record>
+Record& PrefabOverrides::edit(std::vector<std::pair<uint32_t, Record>>& records, uint32_t index, const Record& source)
+{
+    for (auto& entry : records)
+    {
+        if (entry.first == index) return entry.second;
+    }
+    records.emplace_back(index, source);
+    return records.back().second;
+}
+
+template <typename Record>
+const Record* PrefabOverrides::find(const std::vector<std::pair<uint32_t, Record>>& records, uint32_t index)
+{
+    // Instances override one or two components, a linear scan beats any lookup structure
+    for (const auto& entry : records)
+    {
+        if (entry.first == index) return &entry.second;
+    }
+    return nullptr;
+}
+
+SceneSpriteRecord& PrefabOverrides::editSprite(uint32_t index)
+{
+    return edit(sprites, index, prefab->sprites.at(index));
+}
+
+SceneButtonRecord& PrefabOverrides::editButton(uint32_t index)
+{
+    return edit(buttons, index, prefab->buttons.at(index));
+}
+
+SceneAudioRecord& PrefabOverrides::editAudio(uint32_t index)
+{
+    return edit(audio, index, prefab->audio.at(index));
+}
+
+SceneTweenRecord& PrefabOverrides::editTween(uint32_t index)
+{
+    return edit(tweens, index, prefab->tweens.at(index));
+}
+
+Prefab::Prefab(const std::string& name) : name(name)
+{
+}
+
+Prefab::~Prefab()
+{
+    release();
+}
+
+void Prefab::setTransform(const glm::vec2& newPosition, float newRotation, const glm::vec2& newScale)
+{
+    position = newPosition;
+    rotation = newRotation;
+    scale = newScale;
+}
+
+int32_t Prefab::addTexture(const std::string& path, const TextureConfig& cfg)
+{
+    return addAsset(AssetType::TEXTURE, path, cfg);
+}
+
+int32_t Prefab::addAudioClip(const std::string& path)
+{
+    return addAsset(AssetType::AUDIO, path, TextureConfig{});
+}
+
+int32_t Prefab::addAsset(AssetType type, const std::string& path, const TextureConfig& cfg)
+{
+    for (size_t i = 0; i < assets.size(); ++i)
+    {
+        if (assets[i].type == type && assets[i].path == path) return static_cast<int32_t>(i);
+    }
+    assets.push_back({ type, path, cfg, nullptr });
+    return static_cast<int32_t>(assets.size() - 1);
+}
+
+SceneSpriteRecord& Prefab::addSprite(int32_t texture)
+{
+    components.push_back({ ComponentType::SPRITE, static_cast<uint32_t>(sprites.size()) });
+    sprites.push_back(SceneRecords::makeSprite(0, texture));
+    return sprites.back();
+}
+
+SceneButtonRecord& Prefab::addButton()
+{
+    components.push_back({ ComponentType::BUTTON, static_cast<uint32_t>(buttons.size()) });
+    buttons.push_back(SceneRecords::makeButton(0));
+    return buttons.back();
+}
+
+SceneAudioRecord& Prefab::addAudio(int32_t clip)
+{
+    components.push_back({ ComponentType::AUDIO, static_cast<uint32_t>(audio.size()) });
+    audio.push_back(SceneRecords::makeAudio(0, clip));
+    return audio.back();
+}
+
+SceneTweenRecord& Prefab::addTween()
+{
+    components.push_back({ ComponentType::TWEEN, static_cast<uint32_t>(tweens.size()) });
+    tweens.push_back(SceneRecords::makeTween(0));
+    return tweens.back();
+}
+
+void Prefab::declareAssets(SceneManifest& manifest) const
+{
+    for (const Asset& asset : assets)
+    {
+        if (asset.type == AssetType::TEXTURE)
+        {
+            manifest.addTexture(asset.path, asset.cfg);
+        }
+        else
+        {
+            manifest.addAudio(asset.path);
+        }
+    }
+}
+
+void Prefab::acquire()
+{
+    if (!quad && !sprites.empty())
+    {
+        quad = MeshAllocator::getMesh(SpriteRenderer::getQuadVertices());
+    }
+
+    for (Asset& asset : assets)
+    {
+        if (asset.type == AssetType::TEXTURE && !asset.texture)
+        {
+            asset.texture = TextureAllocator::getTexture(asset.path, asset.cfg);
+        }
+    }
+}
+
+void Prefab::release()
+{
+    for (Asset& asset : assets)
+    {
+        if (asset.texture)
+        {
+            TextureAllocator::returnTexture(asset.texture);
+            asset.texture = nullptr;
+        }
+    }
+
+    if (quad)
+    {
+        MeshAllocator::returnMesh(quad);
+        quad = nullptr;
+    }
+}
+
+GameObject* Prefab::instantiate(const PrefabOverrides* overrides)
+{
+    acquire();
+    return create(overrides);
+}
+
+void Prefab::instantiate(size_t count, std::vector<GameObject*>& out)
+{
+    SGE_PROFILE_SCOPE("Prefab::instantiate");
+    acquire();
+
+    out.reserve(out.size() + count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        out.push_back(create(nullptr));
+    }
+}
+
+void Prefab::instantiate(const std::vector<PrefabOverrides>& overrides, std::vector<GameObject*>& out)
+{
+    SGE_PROFILE_SCOPE("Prefab::instantiate");
+    acquire();
+
+    out.reserve(out.size() + overrides.size());
+    for (const PrefabOverrides& instance : overrides)
+    {
+        out.push_back(create(&instance));
+    }
+}
+
+GameObject* Prefab::create(const PrefabOverrides* overrides)
+{
+    const bool hasName = overrides && !overrides->name.empty();
+    GameObject* object = GameObject::Create(hasName ? overrides->name : name);
+    object->reserveComponents(components.size());
+
+    const uint32_t mask = overrides ? overrides->transformMask : 0;
+    object->transform->setPosition(mask & PrefabOverrides::POSITION ? overrides->position : position);
+    object->transform->setRotation(mask & PrefabOverrides::ROTATION ? overrides->rotation : rotation);
+    object->transform->setScale(mask & PrefabOverrides::SCALE ? overrides->scale : scale);
+
+    auto isAsset = [this](int32_t index) { return index >= 0 && static_cast<size_t>(index) < assets.size(); };
+
+    for (const Component& component : components)
+    {
+        switch (component.type)
+        {
+        case ComponentType::SPRITE:
+        {
+            const SceneSpriteRecord* record = overrides ? PrefabOverrides::find(overrides->sprites, component.record) : nullptr;
+            if (!record) record = &sprites[component.record];
+
+            auto* sprite = object->addComponent<SpriteRenderer>();
+            sprite->setSharedMesh(quad);
+            SceneRecords::apply(*record, *sprite, isAsset(record->texture) ? assets[record->texture].texture : nullptr);
+            break;
+        }
+        case ComponentType::BUTTON:
+        {
+            const SceneButtonRecord* record = overrides ? PrefabOverrides::find(overrides->buttons, component.record) : nullptr;
+            if (!record) record = &buttons[component.record];
+
+            SceneRecords::apply(*record, *object->addComponent<Button>());
+            break;
+        }
+        case ComponentType::AUDIO:
+        {
+            const SceneAudioRecord* record = overrides ? PrefabOverrides::find(overrides->audio, component.record) : nullptr;
+            if (!record) record = &audio[component.record];
+
+            const char* clipPath = isAsset(record->clip) ? assets[record->clip].path.c_str() : nullptr;
+            SceneRecords::apply(*record, *object->addComponent<AudioSource>(), clipPath);
+            break;
+        }
+        case ComponentType::TWEEN:
+        {
+            const SceneTweenRecord* record = overrides ? PrefabOverrides::find(overrides->tweens, component.record) : nullptr;
+            if (!record) record = &tweens[component.record];
+
+            SceneRecords::apply(*record, *object->addComponent<TweenComponent>());
+            break;
+        }
+        }
+    }
+    return object;
+}
@@ -0,0 +1,309 @@
+#pragma once
+#include "SceneFormat.h"
+#include "SceneManifest.h"
+#include "GameObject.h"
+#include <glm/vec2.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    class Prefab;
+    class Mesh;
+
+    /**
+     * @class PrefabOverrides
+     * @brief The values one prefab instance changes, stored as sparse deltas.
+     *
+     * Nothing is copied until a value is edited: the first edit of a component copies that
+     * one record from the prefab, every other component keeps reading the prefab's record.
+     */
+    class PrefabOverrides
+    {
+    public:
+        /**
+         * @brief Starts an empty set of overrides.
+         * @param prefab The prefab to override. It must outlive the overrides.
+         */
+        explicit PrefabOverrides(const Prefab& prefab);
+
+        /**
+         * @brief Overrides the name.
+         * @param name The name of the instance.
+         * @return This object, to chain edits.
+         */
+        PrefabOverrides& setName(const std::string& name);
+
+        /**
+         * @brief Overrides the local position.
+         * @param position The position.
+         * @return This object, to chain edits.
+         */
+        PrefabOverrides& setPosition(const glm::vec2& position);
+
+        /**
+         * @brief Overrides the local rotation.
+         * @param rotation The rotation in degrees.
+         * @return This object, to chain edits.
+         */
+        PrefabOverrides& setRotation(float rotation);
+
+        /**
+         * @brief Overrides the local scale.
+         * @param scale The scale.
+         * @return This object, to chain edits.
+         */
+        PrefabOverrides& setScale(const glm::vec2& scale);
+
+        /**
+         * @brief Gets a sprite record to edit, copying it from the prefab on first use.
+         * @param index Which of the prefab's sprites, in the order they were added.
+         * @return The instance's copy of the record.
+         */
+        SceneSpriteRecord& editSprite(uint32_t index = 0);
+
+        /**
+         * @brief Gets a button record to edit, copying it from the prefab on first use.
+         * @param index Which of the prefab's buttons, in the order they were added.
+         * @return The instance's copy of the record.
+         */
+        SceneButtonRecord& editButton(uint32_t index = 0);
+
+        /**
+         * @brief Gets an audio record to edit, copying it from the prefab on first use.
+         * @param index Which of the prefab's audio sources, in the order they were added.
+         * @return The instance's copy of the record.
+         */
+        SceneAudioRecord& editAudio(uint32_t index = 0);
+
+        /**
+         * @brief Gets a tween record to edit, copying it from the prefab on first use.
+         * @param index Which of the prefab's tweens, in the order they were added.
+         * @return The instance's copy of the record.
+         */
+        SceneTweenRecord& editTween(uint32_t index = 0);
+
+    private:
+        friend class Prefab;
+
+        /** @brief Bits of `transformMask` for the transform values that are overridden. */
+        enum TransformField : uint32_t
+        {
+            POSITION = 1 << 0,
+            ROTATION = 1 << 1,
+            SCALE = 1 << 2,
+        };
+
+        /**
+         * @brief Finds the record overriding a component, copying the prefab's record on first use.
+         * @param records The overridden records of one type.
+         * @param index The record index.
+         * @param source The prefab's record.
+         * @return The overriding record.
+         */
+        template <typename Record>
+        static Record& edit(std::vector<std::pair<uint32_t, Record>>& records, uint32_t index, const Record& source);
+
+        /**
+         * @brief Finds the record overriding a component.
+         * @param records The overridden records of one type.
+         * @param index The record index.
+         * @return The overriding record, or null if the prefab's record applies.
+         */
+        template <typename Record>
+        static const Record* find(const std::vector<std::pair<uint32_t, Record>>& records, uint32_t index);
+
+        const Prefab* prefab;                                           /**< The prefab being overridden. */
+        std::string name;                                               /**< Name, used when not empty. */
+        uint32_t transformMask = 0;                                     /**< TransformField bits that are set. */
+        glm::vec2 position = glm::vec2(0.0f);                           /**< Position override. */
+        float rotation = 0.0f;                                          /**< Rotation override. */
+        glm::vec2 scale = glm::vec2(1.0f);                              /**< Scale override. */
+        std::vector<std::pair<uint32_t, SceneSpriteRecord>> sprites;    /**< Edited sprite records by index. */
+        std::vector<std::pair<uint32_t, SceneButtonRecord>> buttons;    /**< Edited button records by index. */
+        std::vector<std::pair<uint32_t, SceneAudioRecord>> audio;       /**< Edited audio records by index. */
+        std::vector<std::pair<uint32_t, SceneTweenRecord>> tweens;      /**< Edited tween records by index. */
+    };
+
+    /**
+     * @class Prefab
+     * @brief A configured GameObject stored once as plain records and stamped out as instances.
+     *
+     * The template's components are kept as the records `SceneFile` loads, in the order they
+     * were added. Instances copy them into new components in one tight loop, share a single
+     * sprite quad, and share one texture reference per texture asset held by the prefab, so
+     * the prefab must outlive its instances. Per-instance differences are `PrefabOverrides`.
+     */
+    class Prefab
+    {
+    public:
+        /**
+         * @brief Creates an empty prefab.
+         * @param name The name given to instances without a name override.
+         */
+        explicit Prefab(const std::string& name);
+
+        /**
+         * @brief Releases the shared texture references and quad.
+         */
+        ~Prefab();
+
+        Prefab(const Prefab&) = delete;             ///< The prefab owns asset references.
+        Prefab& operator=(const Prefab&) = delete;  ///< The prefab owns asset references.
+
+        /**
+         * @brief Sets the local transform of instances.
+         * @param position The position.
+         * @param rotation The rotation in degrees.
+         * @param scale The scale.
+         */
+        void setTransform(const glm::vec2& position, float rotation, const glm::vec2& scale);
+
+        /**
+         * @brief Adds a texture instances can use, once per path.
+         * @param path The texture path.
+         * @param cfg The texture configuration. The first one given for a path is kept.
+         * @return The asset index to put in a sprite record.
+         */
+        int32_t addTexture(const std::string& path, const TextureConfig& cfg);
+
+        /**
+         * @brief Adds an audio clip instances can use, once per path.
+         * @param path The audio file.
+         * @return The asset index to put in an audio record.
+         */
+        int32_t addAudioClip(const std::string& path);
+
+        /**
+         * @brief Adds a SpriteRenderer. The returned reference is valid until the next addSprite().
+         * @param texture An index from addTexture(), or -1.
+         * @return The record, with white color, full opacity, unit size and a centered pivot.
+         */
+        SceneSpriteRecord& addSprite(int32_t texture = -1);
+
+        /**
+         * @brief Adds a Button. The returned reference is valid until the next addButton().
+         * @return The record, with unit size, white color, grey hover color and full opacity.
+         */
+        SceneButtonRecord& addButton();
+
+        /**
+         * @brief Adds an AudioSource. The returned reference is valid until the next addAudio().
+         * @param clip An index from addAudioClip(), or -1.
+         * @return The record, at full volume without looping.
+         */
+        SceneAudioRecord& addAudio(int32_t clip = -1);
+
+        /**
+         * @brief Adds a TweenComponent. The returned reference is valid until the next addTween().
+         * @return The record, with no tween started.
+         */
+        SceneTweenRecord& addTween();
+
+        /**
+         * @brief Declares the prefab's assets for `SceneLoader`.
+         * @param manifest Receives the textures and audio clips.
+         */
+        void declareAssets(SceneManifest& manifest) const;
+
+        /**
+         * @brief Creates one instance.
+         * @param overrides The instance's deltas, or null for an exact copy.
+         * @return The new GameObject, owned by the caller.
+         */
+        GameObject* instantiate(const PrefabOverrides* overrides = nullptr);
+
+        /**
+         * @brief Creates identical instances.
+         * @param count The number of instances.
+         * @param out Receives the new GameObjects, owned by the caller.
+         */
+        void instantiate(size_t count, std::vector<GameObject*>& out);
+
+        /**
+         * @brief Creates one instance per set of overrides.
+         * @param overrides The deltas of each instance.
+         * @param out Receives the new GameObjects in the same order, owned by the caller.
+         */
+        void instantiate(const std::vector<PrefabOverrides>& overrides, std::vector<GameObject*>& out);
+
+        /**
+         * @brief Returns the texture references and quad. The next instantiate() acquires them again.
+         */
+        void release();
+
+        /**
+         * @brief Gets the name of the prefab.
+         * @return The name.
+         */
+        const std::string& getName() const { return name; }
+
+    private:
+        friend class PrefabOverrides;
+
+        /** @brief Component types, in the order `components` lists them. */
+        enum class ComponentType : uint8_t
+        {
+            SPRITE,
+            BUTTON,
+            AUDIO,
+            TWEEN,
+        };
+
+        /**
+         * @struct Component
+         * @brief One component of the template.
+         */
+        struct Component
+        {
+            ComponentType type; /**< Which record vector `record` indexes. */
+            uint32_t record;    /**< Index of the record. */
+        };
+
+        /**
+         * @struct Asset
+         * @brief A texture or audio clip used by the records.
+         */
+        struct Asset
+        {
+            AssetType type;             /**< TEXTURE or AUDIO. */
+            std::string path;           /**< File path. */
+            TextureConfig cfg;          /**< Texture configuration. */
+            Texture2D* texture;         /**< Shared texture reference, null until acquired. */
+        };
+
+        /**
+         * @brief Adds an asset once.
+         * @param type The asset type.
+         * @param path The file path.
+         * @param cfg The texture configuration, ignored for audio.
+         * @return Its index.
+         */
+        int32_t addAsset(AssetType type, const std::string& path, const TextureConfig& cfg);
+
+        /**
+         * @brief Acquires the quad and any texture not held yet, before instances are created.
+         */
+        void acquire();
+
+        /**
+         * @brief Creates an instance once the assets are acquired.
+         * @param overrides The instance's deltas, or null.
+         * @return The new GameObject.
+         */
+        GameObject* create(const PrefabOverrides* overrides);
+
+        std::string name;                           /**< Default instance name. */
+        glm::vec2 position = glm::vec2(0.0f);       /**< Local position of instances. */
+        float rotation = 0.0f;                      /**< Local rotation of instances. */
+        glm::vec2 scale = glm::vec2(1.0f);          /**< Local scale of instances. */
+        std::vector<Component> components;          /**< Components in the order they are added. */
+        std::vector<SceneSpriteRecord> sprites;     /**< Sprite records. */
+        std::vector<SceneButtonRecord> buttons;     /**< Button records. */
+        std::vector<SceneAudioRecord> audio;        /**< Audio records. */
+        std::vector<SceneTweenRecord> tweens;       /**< Tween records. */
+        std::vector<Asset> assets;                  /**< Assets used by the records. */
+        Mesh* quad = nullptr;                       /**< Sprite quad shared by instances, null until acquired. */
+    };
+}
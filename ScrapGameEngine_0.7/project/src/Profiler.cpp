@@ -0,0 +1,150 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include "Log.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    // Zones of one thread. Only the owning thread writes, the exporter reads.
+    struct ThreadBuffer
+    {
+        std::vector<ProfileEvent> events;       // Ring storage
+        std::atomic<uint64_t> written{ 0 };     // Total zones ever written
+        uint32_t threadId = 0;
+        const char* threadName = nullptr;
+    };
+
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> registry; // Kept after a thread exits so its zones can still be exported
+    thread_local ThreadBuffer* localBuffer = nullptr;
+
+    std::chrono::steady_clock::time_point getEpoch()
+    {
+        static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        return epoch;
+    }
+
+    ThreadBuffer& getLocalBuffer(size_t capacity)
+    {
+        if (!localBuffer)
+        {
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->events.resize(std::max<size_t>(capacity, 1));
+
+            std::lock_guard<std::mutex> lock(registryMutex);
+            buffer->threadId = static_cast<uint32_t>(registry.size() + 1);
+            localBuffer = buffer.get();
+            registry.push_back(std::move(buffer));
+        }
+        return *localBuffer;
+    }
+
+    // Zone names are identifiers or literals, but escape them anyway to always produce valid JSON
+    void writeJsonString(std::ofstream& file, const char* text)
+    {
+        file << '"';
+        for (const char* c = text ? text : ""; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\') file << '\\';
+            file << *c;
+        }
+        file << '"';
+    }
+}
+
+size_t Profiler::bufferCapacity = 65536;
+
+uint64_t Profiler::now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - getEpoch()).count());
+}
+
+void Profiler::record(const char* name, uint64_t start, uint64_t end)
+{
+    ThreadBuffer& buffer = getLocalBuffer(bufferCapacity);
+
+    uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[index % buffer.events.size()] = { name, start, end };
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const char* name)
+{
+    getLocalBuffer(bufferCapacity).threadName = name;
+}
+
+void Profiler::setBufferCapacity(size_t events)
+{
+    bufferCapacity = std::max<size_t>(events, 1);
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto& buffer : registry)
+    {
+        buffer->written.store(0, std::memory_order_release);
+    }
+}
+
+bool Profiler::exportChromeTrace(const std::string& path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        SGE_LOG_ERROR(PROFILER, "Failed to create trace file: {}", path);
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    size_t exported = 0;
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto& buffer : registry)
+    {
+        // Thread name metadata
+        if (buffer->threadName)
+        {
+            file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+            writeJsonString(file, buffer->threadName);
+            file << "}}";
+            first = false;
+        }
+
+        // Export the last `capacity` zones, oldest first
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t capacity = buffer->events.size();
+        uint64_t begin = written > capacity ? written - capacity : 0;
+
+        for (uint64_t i = begin; i < written; ++i)
+        {
+            const ProfileEvent& ev = buffer->events[i % capacity];
+
+            file << (first ? "" : ",") << "\n{\"name\":";
+            writeJsonString(file, ev.name);
+            file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                << ",\"ts\":" << ev.start / 1000.0
+                << ",\"dur\":" << (ev.end - ev.start) / 1000.0 << "}";
+            first = false;
+            exported++;
+        }
+    }
+
+    file << "\n]}\n";
+    file.close();
+
+    SGE_LOG_INFO(PROFILER, "Exported {} zones to: {}", exported, path);
+    return true;
+}
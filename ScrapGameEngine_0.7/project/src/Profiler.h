@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * @file Profiler.h
+ * @brief Scoped-zone CPU profiler with Chrome trace export.
+ *
+ * Zones are recorded with `SGE_PROFILE_SCOPE("Name")`. The macros only expand to code when
+ * `SGE_ENABLE_PROFILER` is defined (Debug configurations); otherwise they compile to nothing,
+ * so instrumented code costs exactly the same as uninstrumented code.
+ */
+
+#define SGE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SGE_PROFILE_CONCAT(a, b) SGE_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef SGE_ENABLE_PROFILER
+/** @brief Records a zone from this point to the end of the enclosing scope. The name must be a string literal. */
+#define SGE_PROFILE_SCOPE(name) ::ScrapGameEngine::ProfileZone SGE_PROFILE_CONCAT(sgeProfileZone_, __LINE__)(name)
+/** @brief Records a zone named after the enclosing function. */
+#define SGE_PROFILE_FUNCTION() SGE_PROFILE_SCOPE(__FUNCTION__)
+/** @brief Names the calling thread in exported traces. The name must be a string literal. */
+#define SGE_PROFILE_THREAD(name) ::ScrapGameEngine::Profiler::setThreadName(name)
+#else
+#define SGE_PROFILE_SCOPE(name) ((void)0)
+#define SGE_PROFILE_FUNCTION() ((void)0)
+#define SGE_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct ProfileEvent
+     * @brief A completed zone.
+     */
+    struct ProfileEvent
+    {
+        const char* name;   ///< Zone name, must have static storage duration.
+        uint64_t start;     ///< Start time in nanoseconds since the profiler epoch.
+        uint64_t end;       ///< End time in nanoseconds since the profiler epoch.
+    };
+
+    /**
+     * @class Profiler
+     * @brief Collects zones in per-thread ring buffers and exports them as Chrome trace JSON.
+     *
+     * Each thread writes to its own fixed-size ring buffer without locking; when a buffer is full the
+     * oldest zones are overwritten, so the export always holds the most recent history. Timestamps
+     * come from `std::chrono::steady_clock`. Open the exported file in chrome://tracing or Perfetto.
+     */
+    class Profiler
+    {
+    public:
+        Profiler() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Checks whether the profiling macros were compiled in.
+         * @return True if `SGE_ENABLE_PROFILER` is defined.
+         */
+        static constexpr bool isCompiledIn()
+        {
+#ifdef SGE_ENABLE_PROFILER
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Gets the current profiler time.
+         * @return Nanoseconds since the profiler epoch.
+         */
+        static uint64_t now();
+
+        /**
+         * @brief Records a completed zone on the calling thread.
+         * @param name The zone name (string literal).
+         * @param start The start time from now().
+         * @param end The end time from now().
+         */
+        static void record(const char* name, uint64_t start, uint64_t end);
+
+        /**
+         * @brief Names the calling thread in exported traces.
+         * @param name The thread name (string literal).
+         */
+        static void setThreadName(const char* name);
+
+        /**
+         * @brief Sets the number of zones each thread keeps.
+         *
+         * Only affects threads that have not recorded anything yet.
+         *
+         * @param events The ring buffer capacity per thread.
+         */
+        static void setBufferCapacity(size_t events);
+
+        /**
+         * @brief Discards all recorded zones.
+         *
+         * Other threads must not be recording while the buffers are cleared.
+         */
+        static void clear();
+
+        /**
+         * @brief Writes all recorded zones to a Chrome trace JSON file.
+         *
+         * Other threads should be idle, zones recorded during the export may be torn.
+         *
+         * @param path The path of the file to write.
+         * @return True if the file was written.
+         */
+        static bool exportChromeTrace(const std::string& path);
+
+    private:
+        static size_t bufferCapacity; ///< Ring buffer capacity for new threads.
+    };
+
+    /**
+     * @class ProfileZone
+     * @brief RAII helper recording the lifetime of a scope. Use through `SGE_PROFILE_SCOPE`.
+     */
+    class ProfileZone
+    {
+    public:
+        /**
+         * @brief Starts the zone.
+         * @param name The zone name (string literal).
+         */
+        explicit ProfileZone(const char* name) : name(name), start(Profiler::now()) {}
+
+        /**
+         * @brief Ends the zone and records it.
+         */
+        ~ProfileZone() { Profiler::record(name, start, Profiler::now()); }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        const char* name; ///< Zone name.
+        uint64_t start;   ///< Start time in nanoseconds.
+    };
+}
@@ -1,136 +1,329 @@
-#include "Renderer.h"
-#include <glad/glad.h> 
-#include <GLFW/glfw3.h> // GLFW header for window management and context creation
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp> // For glm::translate, glm::rotate, glm::scale
-#include "Texture2D.h" 
-#include "Camera.h"
-#include <iostream>
-using namespace ScrapGameEngine;
-
-std::vector<DrawCommand> Renderer::draws;
-bool Renderer::isRendering = false;
-glm::mat4 Renderer::vpMatrix;
-
-void Renderer::init()
-{
-    glEnable(GL_TEXTURE_2D); // Enable texturing
-    glEnable(GL_BLEND); // Enable blending
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Standard alpha blending
-}
-
-void Renderer::submitCommand(DrawCommand dc)
-{
-    // Ensure that draw commands are only submitted during the rendering phase
-    if (!isRendering)
-    {
-        std::cerr << "Error: Rendering commands can only be submitted during the render step!" << std::endl;
-        return;
-    }
-
-    // Apply transformations here
-    glm::mat4 modelMatrix = glm::translate(glm::mat4(1.0f), dc.translation);
-    modelMatrix = glm::rotate(modelMatrix, glm::radians(dc.rotationZ), glm::vec3(0.0f, 0.0f, 1.0f));
-    modelMatrix = glm::scale(modelMatrix, dc.scale);
-    dc.modelMatrix = modelMatrix;
-
-    // Add the draw command to the list of commands to be processed later
-    draws.push_back(dc);
-}
-
-void Renderer::beginFrame()
-{
-    isRendering = true;
-    clear(); // Clear the renderer
-
-    // Set the vp (view-projection) matrix to identity initially
-    Renderer::vpMatrix = Camera::getMatrix_viewProjection();
-}
-
-void Renderer::endFrame()
-{
-    // Set common settings
-    glPushMatrix(); // Push matrix to stack.
-    glLoadMatrixf(&vpMatrix[0][0]); // Load the view-projection matrix.
-
-    glEnableClientState(GL_VERTEX_ARRAY); // Enable vertex array state.
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY); // Enable texture coordinate array state.
-
-    // Draw all render requests
-    for (DrawCommand dc : draws)
-    {
-        glPushMatrix(); // Push matrix for each object
-
-        // Apply model transformations
-        glMultMatrixf(&dc.modelMatrix[0][0]);
-
-        // Apply materials
-        glColor4fv(&dc.tint[0]); // Set the tint color
-
-        // Bind the texture if it has a valid textureID
-        if (dc.textureID != 0)
-        {
-            glBindTexture(GL_TEXTURE_2D, dc.textureID);
-        }
-
-        // Draw object using the vertex and texture arrays
-        glBindBuffer(GL_ARRAY_BUFFER, dc.meshId);
-        glVertexPointer(3, GL_FLOAT, dc.vertexStride, 0); // Vertex positions
-        glTexCoordPointer(2, GL_FLOAT, dc.vertexStride, (void*)12); // Texture coordinates (offset by 12 bytes)
-
-        // Draw the triangles
-        glDrawArrays(GL_TRIANGLES, 0, dc.vertexCount);
-
-        // Unbind the texture after drawing
-        if (dc.textureID != 0)
-        {
-            glBindTexture(GL_TEXTURE_2D, 0);
-        }
-
-        glPopMatrix(); // Pop matrix for this object
-    }
-
-    // Unset common settings
-    glDisableClientState(GL_VERTEX_ARRAY); // Disable vertex array state
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY); // Disable texture coordinate array state
-    glPopMatrix(); // Pop the view-projection matrix
-
-    // Clear the draws and reset rendering state
-    draws.clear();
-    isRendering = false;
-}
-
-int Renderer::load()
-{
-    // Initialize GLAD
-    if (gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-    {
-        std::cout << "GLAD initialized successfully." << std::endl;
-        return 1; // Return 1 if successful
-    }
-    else
-    {
-        std::cout << "Failed to initialize GLAD." << std::endl;
-        return 0; // Return 0 if failed
-    }
-}
-
-void Renderer::setViewport(int x, int y, int width, int height)
-{
-    // Set the viewport parameters using the OpenGL function
-    glViewport(x, y, width, height);
-    Camera::recalculate(width, height);
-}
-
-void Renderer::setClearColor(float r, float g, float b, float a)
-{
-    // Set the clear color using the OpenGL function
-    glClearColor(r, g, b, a);
-}
-
-void Renderer::clear()
-{
-    // Clear the framebuffer using the OpenGL function
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear both color and depth buffers
-}
-
+#include "Renderer.h"
+#include <glad/glad.h> 
+#include <GLFW/glfw3.h> // GLFW header for window management and context creation
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp> // For glm::translate, glm::rotate, glm::scale
+#include "Texture2D.h" 
+#include "Camera.h"
+#include "DynamicGeometryAllocator.h"
+#include "Profiler.h"
+#include "Log.h"
+using namespace ScrapGameEngine;
+
+std::vector<DrawCommand> Renderer::draws;
+bool Renderer::isRendering = false;
+glm::mat4 Renderer::vpMatrix;
+RendererBackend Renderer::backend = RendererBackend::OPENGL;
+std::vector<DrawCommand> Renderer::recordedDraws;
+RenderStats Renderer::stats;
+unsigned int Renderer::distanceFieldProgram = 0;
+
+namespace
+{
+    // GLSL 1.20 against the fixed-function state, so the matrix stack and glColor still apply
+    const char* distanceFieldVertexSource = R"(
+        #version 120
+        void main()
+        {
+            gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+            gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;
+            gl_FrontColor = gl_Color;
+        }
+    )";
+
+    // Antialias over about one screen pixel, whatever the text scale
+    const char* distanceFieldFragmentSource = R"(
+        #version 120
+        uniform sampler2D atlas;
+        void main()
+        {
+            float distance = texture2D(atlas, gl_TexCoord[0].xy).a;
+            float width = max(fwidth(distance) * 0.7, 0.001);
+            float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+            gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+        }
+    )";
+
+    GLuint compileShader(GLenum type, const char* source)
+    {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+
+        GLint compiled = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        if (compiled != GL_TRUE)
+        {
+            char info[512] = {};
+            glGetShaderInfoLog(shader, sizeof(info), nullptr, info);
+            SGE_LOG_WARN(RENDERER, "Distance field shader did not compile: {}", info);
+            glDeleteShader(shader);
+            return 0;
+        }
+        return shader;
+    }
+}
+
+void Renderer::init()
+{
+    if (!isGpuBackend()) return;
+
+    glEnable(GL_TEXTURE_2D); // Enable texturing
+    glEnable(GL_BLEND); // Enable blending
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Standard alpha blending
+
+    distanceFieldProgram = createDistanceFieldProgram();
+    if (distanceFieldProgram == 0)
+    {
+        SGE_LOG_WARN(RENDERER, "Distance field text falls back to alpha testing.");
+    }
+}
+
+unsigned int Renderer::createDistanceFieldProgram()
+{
+    if (!glCreateShader) return 0; // No GLSL support
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, distanceFieldVertexSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, distanceFieldFragmentSource);
+    GLuint program = 0;
+    if (vertexShader && fragmentShader)
+    {
+        program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked != GL_TRUE)
+        {
+            SGE_LOG_WARN(RENDERER, "Distance field shader did not link.");
+            glDeleteProgram(program);
+            program = 0;
+        }
+        else
+        {
+            glUseProgram(program);
+            glUniform1i(glGetUniformLocation(program, "atlas"), 0);
+            glUseProgram(0);
+        }
+    }
+
+    // The program keeps what it needs once linked
+    if (vertexShader) glDeleteShader(vertexShader);
+    if (fragmentShader) glDeleteShader(fragmentShader);
+    return program;
+}
+
+void Renderer::submitCommand(DrawCommand dc)
+{
+    // Ensure that draw commands are only submitted during the rendering phase
+    if (!isRendering)
+    {
+        SGE_LOG_ERROR(RENDERER, "Error: Rendering commands can only be submitted during the render step!");
+        return;
+    }
+
+    // Apply transformations here
+    glm::mat4 modelMatrix = glm::translate(glm::mat4(1.0f), dc.translation);
+    modelMatrix = glm::rotate(modelMatrix, glm::radians(dc.rotationZ), glm::vec3(0.0f, 0.0f, 1.0f));
+    modelMatrix = glm::scale(modelMatrix, dc.scale);
+    dc.modelMatrix = modelMatrix;
+
+    // Add the draw command to the list of commands to be processed later
+    draws.push_back(dc);
+}
+
+void Renderer::beginFrame()
+{
+    isRendering = true;
+    clear(); // Clear the renderer
+
+    // Set the vp (view-projection) matrix to identity initially
+    Renderer::vpMatrix = Camera::getMatrix_viewProjection();
+}
+
+void Renderer::endFrame()
+{
+    SGE_PROFILE_SCOPE("Renderer::endFrame");
+
+    // Gather statistics for both backends
+    stats.frameDrawCalls = static_cast<unsigned int>(draws.size());
+    stats.frameVertices = 0;
+    for (const DrawCommand& dc : draws)
+    {
+        stats.frameVertices += dc.vertexCount;
+    }
+    stats.totalDrawCalls += draws.size();
+    stats.totalFrames++;
+
+    if (isGpuBackend())
+    {
+        executeDraws();
+    }
+    else
+    {
+        // Keep the frame's commands around for inspection instead of drawing them
+        recordedDraws.swap(draws);
+    }
+
+    // Fence the dynamic geometry used by this frame
+    DynamicGeometryAllocator::endFrame();
+
+    // Clear the draws and reset rendering state
+    draws.clear();
+    isRendering = false;
+}
+
+void Renderer::setDistanceFieldState(bool enabled)
+{
+    if (distanceFieldProgram != 0)
+    {
+        glUseProgram(enabled ? distanceFieldProgram : 0);
+    }
+    else if (enabled)
+    {
+        glEnable(GL_ALPHA_TEST);
+        glAlphaFunc(GL_GEQUAL, 0.5f);
+    }
+    else
+    {
+        glDisable(GL_ALPHA_TEST);
+    }
+}
+
+void Renderer::setTextureArea(const glm::vec4& uvRect)
+{
+    glMatrixMode(GL_TEXTURE);
+    glLoadIdentity();
+    if (uvRect != glm::vec4(0.0f))
+    {
+        glTranslatef(uvRect.x, uvRect.y, 0.0f);
+        glScalef(uvRect.z, uvRect.w, 1.0f);
+    }
+    glMatrixMode(GL_MODELVIEW);
+}
+
+void Renderer::executeDraws()
+{
+    SGE_PROFILE_SCOPE("Renderer::executeDraws");
+
+    // Upload the transient vertex data written this frame
+    DynamicGeometryAllocator::flush();
+
+    // Set common settings
+    glPushMatrix(); // Push matrix to stack.
+    glLoadMatrixf(&vpMatrix[0][0]); // Load the view-projection matrix.
+
+    glEnableClientState(GL_VERTEX_ARRAY); // Enable vertex array state.
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY); // Enable texture coordinate array state.
+
+    // Draw all render requests
+    bool distanceField = false;
+    glm::vec4 uvRect(0.0f);
+    for (DrawCommand dc : draws)
+    {
+        // Distance fields are smoothed by the shader, or cut at the edge without one
+        if (dc.distanceField != distanceField)
+        {
+            distanceField = dc.distanceField;
+            setDistanceFieldState(distanceField);
+        }
+
+        // Atlas frames map the mesh UVs onto their area through the texture matrix
+        if (dc.uvRect != uvRect)
+        {
+            uvRect = dc.uvRect;
+            setTextureArea(uvRect);
+        }
+
+        glPushMatrix(); // Push matrix for each object
+
+        // Apply model transformations
+        glMultMatrixf(&dc.modelMatrix[0][0]);
+
+        // Apply materials
+        glColor4fv(&dc.tint[0]); // Set the tint color
+
+        // Bind the texture if it has a valid textureID
+        if (dc.textureID != 0)
+        {
+            glBindTexture(GL_TEXTURE_2D, dc.textureID);
+        }
+
+        // Draw object using the vertex and texture arrays
+        glBindBuffer(GL_ARRAY_BUFFER, dc.meshId);
+        glVertexPointer(3, GL_FLOAT, dc.vertexStride, (void*)(size_t)dc.vertexOffset); // Vertex positions
+        glTexCoordPointer(2, GL_FLOAT, dc.vertexStride, (void*)(size_t)(dc.vertexOffset + 12)); // Texture coordinates (offset by 12 bytes)
+        if (dc.vertexColors)
+        {
+            glEnableClientState(GL_COLOR_ARRAY);
+            glColorPointer(4, GL_UNSIGNED_BYTE, dc.vertexStride, (void*)(size_t)(dc.vertexOffset + 20)); // Colors after the UVs
+        }
+
+        // Draw the triangles
+        glDrawArrays(GL_TRIANGLES, 0, dc.vertexCount);
+
+        if (dc.vertexColors)
+        {
+            glDisableClientState(GL_COLOR_ARRAY);
+        }
+
+        // Unbind the texture after drawing
+        if (dc.textureID != 0)
+        {
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        glPopMatrix(); // Pop matrix for this object
+    }
+
+    // Unset common settings
+    if (distanceField) setDistanceFieldState(false);
+    if (uvRect != glm::vec4(0.0f)) setTextureArea(glm::vec4(0.0f));
+    glDisableClientState(GL_VERTEX_ARRAY); // Disable vertex array state
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY); // Disable texture coordinate array state
+    glPopMatrix(); // Pop the view-projection matrix
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+int Renderer::load()
+{
+    // Initialize GLAD
+    if (gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    {
+        SGE_LOG_INFO(RENDERER, "GLAD initialized successfully.");
+        return 1; // Return 1 if successful
+    }
+    else
+    {
+        SGE_LOG_ERROR(RENDERER, "Failed to initialize GLAD.");
+        return 0; // Return 0 if failed
+    }
+}
+
+void Renderer::setViewport(int x, int y, int width, int height)
+{
+    // Set the viewport parameters using the OpenGL function
+    if (isGpuBackend()) glViewport(x, y, width, height);
+    Camera::recalculate(width, height);
+}
+
+void Renderer::setClearColor(float r, float g, float b, float a)
+{
+    // Set the clear color using the OpenGL function
+    if (isGpuBackend()) glClearColor(r, g, b, a);
+}
+
+void Renderer::setBackend(RendererBackend newBackend)
+{
+    backend = newBackend;
+    SGE_LOG_INFO(RENDERER, "Using {} backend.", (isGpuBackend() ? "OpenGL" : "recording"));
+}
+
+void Renderer::clear()
+{
+    // Clear the framebuffer using the OpenGL function
+    if (isGpuBackend()) glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear both color and depth buffers
+}
+
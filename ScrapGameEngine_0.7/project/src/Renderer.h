@@ -1,106 +1,204 @@
-#pragma once
-#include <glm/glm.hpp> // Include GLM for vector and matrix types
-#include <glm/mat4x4.hpp>
-#include <vector>
-
-namespace ScrapGameEngine
-{
-    /**
-     * @struct DrawCommand
-     * @brief Represents a single draw command for rendering a mesh.
-     *
-     * This structure contains all the information necessary to render a mesh,
-     * including its transformation, color, texture, and more.
-     */
-    struct DrawCommand
-    {
-        unsigned int meshId;         /**< ID of the mesh to draw. */
-        unsigned int vertexStride;   /**< Size of each vertex in bytes. */
-        unsigned int vertexCount;    /**< Number of vertices to draw. */
-        glm::vec4 tint;              /**< Tint color for the mesh (RGBA). */
-        glm::vec3 translation;       /**< Position to translate the mesh. */
-        float rotationZ;             /**< Rotation angle around Z-axis in degrees. */
-        glm::vec3 scale;             /**< Scale factors (x, y, z). */
-        unsigned int textureID;      /**< ID of the texture to use. */
-        glm::mat4 modelMatrix;       /**< Model transformation matrix. */
-    };
-
-    /**
-     * @class Renderer
-     * @brief A static class responsible for handling rendering operations.
-     *
-     * The Renderer class provides methods for initializing the rendering system,
-     * submitting draw commands, and managing frame rendering. It operates as a
-     * static utility to ensure consistent rendering throughout the application.
-     */
-    class Renderer
-    {
-    private:
-        Renderer() = delete; /**< Deleted constructor to enforce static usage. */
-
-        static std::vector<DrawCommand> draws; /**< Collection of draw commands to process. */
-        static bool isRendering;               /**< Flag indicating whether rendering is active. */
-        static glm::mat4 vpMatrix;             /**< View-projection matrix for rendering. */
-
-    public:
-        /**
-         * @brief Initializes the Renderer system.
-         *
-         * Sets up necessary resources for rendering operations.
-         */
-        static void init();
-
-        /**
-         * @brief Submits a draw command to the Renderer.
-         * @param dc The draw command to submit.
-         *
-         * The draw command will be processed during the current frame rendering.
-         */
-        static void submitCommand(DrawCommand dc);
-
-        /**
-         * @brief Begins a new frame for rendering.
-         *
-         * Prepares the Renderer for processing draw commands and rendering a frame.
-         */
-        static void beginFrame();
-
-        /**
-         * @brief Ends the current frame and executes all submitted draw commands.
-         *
-         * Finalizes the frame and sends all draw commands to the GPU for rendering.
-         */
-        static void endFrame();
-
-        /**
-         * @brief Loads necessary resources or configurations.
-         * @return An integer indicating the result of the load operation.
-         */
-        static int load();
-
-        /**
-         * @brief Sets the viewport dimensions for rendering.
-         * @param x The x-coordinate of the viewport origin.
-         * @param y The y-coordinate of the viewport origin.
-         * @param width The width of the viewport in pixels.
-         * @param height The height of the viewport in pixels.
-         */
-        static void setViewport(int x, int y, int width, int height);
-
-        /**
-         * @brief Sets the clear color for the Renderer.
-         * @param r The red component (0.0 to 1.0).
-         * @param g The green component (0.0 to 1.0).
-         * @param b The blue component (0.0 to 1.0).
-         * @param a The alpha component (0.0 to 1.0).
-         */
-        static void setClearColor(float r, float g, float b, float a);
-
-        /**
-         * @brief Clears the rendering buffers.
-         *
-         * Clears the screen using the set clear color, preparing it for the next frame.
-         */
-        static void clear();
-    };
-}
+#pragma once
+#include <glm/glm.hpp> // Include GLM for vector and matrix types
+#include <glm/mat4x4.hpp>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum RendererBackend
+     * @brief Selects how the Renderer executes draw commands.
+     */
+    enum class RendererBackend
+    {
+        OPENGL,     /**< Draw commands are executed with OpenGL. */
+        RECORDING   /**< Draw commands are only recorded, no graphics API is touched (headless mode). */
+    };
+
+    /**
+     * @struct RenderStats
+     * @brief Draw statistics gathered by the Renderer.
+     */
+    struct RenderStats
+    {
+        unsigned int frameDrawCalls = 0;       /**< Draw commands executed in the last frame. */
+        unsigned int frameVertices = 0;        /**< Vertices drawn in the last frame. */
+        unsigned long long totalDrawCalls = 0; /**< Draw commands executed since the last reset. */
+        unsigned long long totalFrames = 0;    /**< Frames rendered since the last reset. */
+    };
+
+    /**
+     * @struct DrawCommand
+     * @brief Represents a single draw command for rendering a mesh.
+     *
+     * This structure contains all the information necessary to render a mesh,
+     * including its transformation, color, texture, and more.
+     */
+    struct DrawCommand
+    {
+        unsigned int meshId;         /**< ID of the mesh to draw. */
+        unsigned int vertexStride;   /**< Size of each vertex in bytes. */
+        unsigned int vertexCount;    /**< Number of vertices to draw. */
+        unsigned int vertexOffset;   /**< Byte offset of the first vertex inside the buffer. */
+        glm::vec4 tint;              /**< Tint color for the mesh (RGBA). */
+        glm::vec3 translation;       /**< Position to translate the mesh. */
+        float rotationZ;             /**< Rotation angle around Z-axis in degrees. */
+        glm::vec3 scale;             /**< Scale factors (x, y, z). */
+        unsigned int textureID;      /**< ID of the texture to use. */
+        bool distanceField;          /**< Whether the texture alpha is a distance field. */
+        glm::vec4 uvRect;            /**< Texture area as offset and size, all zero for the whole texture. */
+        bool vertexColors;           /**< Whether the vertices are `ColorVertex`, their colors replacing the tint. */
+        glm::mat4 modelMatrix;       /**< Model transformation matrix. */
+    };
+
+    /**
+     * @class Renderer
+     * @brief A static class responsible for handling rendering operations.
+     *
+     * The Renderer class provides methods for initializing the rendering system,
+     * submitting draw commands, and managing frame rendering. It operates as a
+     * static utility to ensure consistent rendering throughout the application.
+     */
+    class Renderer
+    {
+    private:
+        Renderer() = delete; /**< Deleted constructor to enforce static usage. */
+
+        static std::vector<DrawCommand> draws; /**< Collection of draw commands to process. */
+        static bool isRendering;               /**< Flag indicating whether rendering is active. */
+        static glm::mat4 vpMatrix;             /**< View-projection matrix for rendering. */
+        static RendererBackend backend;        /**< Backend executing the draw commands. */
+        static std::vector<DrawCommand> recordedDraws; /**< Draw commands of the last frame (recording backend). */
+        static RenderStats stats;              /**< Draw statistics. */
+        static unsigned int distanceFieldProgram; /**< Shader for distance field draws, 0 when alpha testing is used instead. */
+
+        /**
+         * @brief Executes the collected draw commands with OpenGL.
+         */
+        static void executeDraws();
+
+        /**
+         * @brief Compiles the shader that smooths distance field edges.
+         * @return The program, or 0 if the driver could not build it.
+         */
+        static unsigned int createDistanceFieldProgram();
+
+        /**
+         * @brief Switches between the fixed-function state and the distance field state.
+         * @param enabled True before distance field draws, false after them.
+         */
+        static void setDistanceFieldState(bool enabled);
+
+        /**
+         * @brief Sets the texture matrix mapping the mesh UVs onto an area of the texture.
+         * @param uvRect Offset in xy and size in zw, all zero for the whole texture.
+         */
+        static void setTextureArea(const glm::vec4& uvRect);
+
+    public:
+        /**
+         * @brief Initializes the Renderer system.
+         *
+         * Sets up necessary resources for rendering operations.
+         */
+        static void init();
+
+        /**
+         * @brief Submits a draw command to the Renderer.
+         * @param dc The draw command to submit.
+         *
+         * The draw command will be processed during the current frame rendering.
+         */
+        static void submitCommand(DrawCommand dc);
+
+        /**
+         * @brief Begins a new frame for rendering.
+         *
+         * Prepares the Renderer for processing draw commands and rendering a frame.
+         */
+        static void beginFrame();
+
+        /**
+         * @brief Ends the current frame and executes all submitted draw commands.
+         *
+         * Finalizes the frame and sends all draw commands to the GPU for rendering.
+         */
+        static void endFrame();
+
+        /**
+         * @brief Loads necessary resources or configurations.
+         * @return An integer indicating the result of the load operation.
+         */
+        static int load();
+
+        /**
+         * @brief Sets the viewport dimensions for rendering.
+         * @param x The x-coordinate of the viewport origin.
+         * @param y The y-coordinate of the viewport origin.
+         * @param width The width of the viewport in pixels.
+         * @param height The height of the viewport in pixels.
+         */
+        static void setViewport(int x, int y, int width, int height);
+
+        /**
+         * @brief Sets the clear color for the Renderer.
+         * @param r The red component (0.0 to 1.0).
+         * @param g The green component (0.0 to 1.0).
+         * @param b The blue component (0.0 to 1.0).
+         * @param a The alpha component (0.0 to 1.0).
+         */
+        static void setClearColor(float r, float g, float b, float a);
+
+        /**
+         * @brief Clears the rendering buffers.
+         *
+         * Clears the screen using the set clear color, preparing it for the next frame.
+         */
+        static void clear();
+
+        /**
+         * @brief Selects the rendering backend.
+         *
+         * Must be called before any mesh or texture is created, since those consult the backend
+         * to decide whether to create GPU resources.
+         *
+         * @param newBackend The backend to use.
+         */
+        static void setBackend(RendererBackend newBackend);
+
+        /**
+         * @brief Gets the active rendering backend.
+         * @return The active backend.
+         */
+        static RendererBackend getBackend() { return backend; }
+
+        /**
+         * @brief Checks whether draw commands are executed with a graphics API.
+         * @return True for the OpenGL backend, false when only recording.
+         */
+        static bool isGpuBackend() { return backend == RendererBackend::OPENGL; }
+
+        /**
+         * @brief Gets the draw commands of the last frame captured by the recording backend.
+         * @return The recorded draw commands.
+         */
+        static const std::vector<DrawCommand>& getRecordedDraws() { return recordedDraws; }
+
+        /**
+         * @brief Gets the draw statistics.
+         * @return The draw statistics.
+         */
+        static const RenderStats& getStats() { return stats; }
+
+        /**
+         * @brief Resets the draw statistics.
+         */
+        static void resetStats() { stats = RenderStats(); }
+
+        /**
+         * @brief Checks whether distance field draws use the smoothing shader.
+         * @return True if the shader was built; otherwise they are alpha tested, with hard edges.
+         */
+        static bool hasDistanceFieldShader() { return distanceFieldProgram != 0; }
+    };
+}
@@ -0,0 +1,395 @@
+#pragma once
+#include "Hash.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct ResourceHandle
+     * @brief Typed reference to a slot of a `ResourceAllocator`.
+     *
+     * A handle is an index plus the generation of the slot when it was handed out. Once the
+     * resource is collected the slot's generation changes, so stale handles resolve to null
+     * instead of to whatever reuses the slot.
+     *
+     * @tparam T The resource type.
+     */
+    template <typename T>
+    struct ResourceHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu; ///< Index of a null handle.
+
+        uint32_t index = INVALID_INDEX; ///< Slot index.
+        uint32_t generation = 0;        ///< Slot generation when the handle was created.
+
+        /**
+         * @brief Checks whether the handle was ever assigned. It may still be stale.
+         * @return True if the handle refers to a slot.
+         */
+        bool isValid() const { return index != INVALID_INDEX; }
+
+        bool operator==(const ResourceHandle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const ResourceHandle& other) const { return !(*this == other); }
+    };
+
+    /**
+     * @struct ResourceCacheStats
+     * @brief Lookup counters of a `ResourceAllocator`.
+     */
+    struct ResourceCacheStats
+    {
+        uint64_t hits = 0;          ///< Acquires served from the cache.
+        uint64_t misses = 0;        ///< Acquires that loaded the resource.
+        uint64_t collisions = 0;    ///< Cached entries whose key matched but whose content did not.
+    };
+
+    /**
+     * @struct ResourceLoader
+     * @brief Creates a resource for a `ResourceAllocator`. Specialize it for types needing custom loading.
+     *
+     * The default constructs `T` from the acquire arguments and trusts the key to identify it.
+     *
+     * @tparam T The resource type.
+     */
+    template <typename T>
+    struct ResourceLoader
+    {
+        /**
+         * @brief Creates the resource.
+         * @param key The cache key of the resource, an interned path or a content hash.
+         * @param args The arguments passed to acquire().
+         * @return The new resource, or null if loading failed.
+         */
+        template <typename... Args>
+        static std::unique_ptr<T> load(AssetId /*key*/, Args&&... args)
+        {
+            return std::make_unique<T>(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Verifies that a cached resource is the one requested, guarding against key collisions.
+         * @param resource The cached resource found under the key.
+         * @param args The arguments passed to acquire().
+         * @return True if the resource matches.
+         */
+        template <typename... Args>
+        static bool matches(const T& /*resource*/, const Args&... /*args*/)
+        {
+            return true;
+        }
+    };
+
+    /**
+     * @class ResourceAllocator
+     * @brief Reference-counted cache of one resource type, addressed by key or by handle.
+     *
+     * Resources live in a slot array: acquire() looks the key up once, after that every handle
+     * operation is a direct index. Releasing the last reference does not delete the resource;
+     * it is deleted by collect() once it has been unused for `retainFrames` frames, so GPU objects
+     * are never destroyed while a frame that still references them may be in flight, and a
+     * resource released and re-acquired in quick succession is not reloaded.
+     *
+     * Not thread-safe; `ResourceManagementSystem` serializes access.
+     *
+     * @tparam T The resource type.
+     */
+    template <typename T>
+    class ResourceAllocator
+    {
+    public:
+        /**
+         * @brief Gets a resource, loading it if it is not cached, and adds a reference.
+         *
+         * A cached entry is only reused if `ResourceLoader<T>::matches` confirms it; otherwise the
+         * key collided and the next key from `Hash::rehash` is probed. A new resource takes the
+         * first freed key of the chain, or the key past its end.
+         *
+         * @param key The cache key, an interned path or a content hash.
+         * @param args Arguments forwarded to `ResourceLoader<T>::load` when the resource is loaded.
+         * @return The handle, invalid if loading failed.
+         */
+        template <typename... Args>
+        ResourceHandle<T> acquire(AssetId key, Args&&... args)
+        {
+            AssetId freeKey = 0;
+            bool foundFreeKey = false;
+            while (true)
+            {
+                auto it = keyToSlot.find(key);
+                if (it == keyToSlot.end()) break;
+
+                if (it->second == FREED_KEY)
+                {
+                    // The entry was collected, but later entries of the chain may still follow it
+                    if (!foundFreeKey)
+                    {
+                        freeKey = key;
+                        foundFreeKey = true;
+                    }
+                }
+                else if (ResourceLoader<T>::matches(*slots[it->second].resource, args...))
+                {
+                    stats.hits++;
+                    return addReference(it->second);
+                }
+                else
+                {
+                    stats.collisions++;
+                }
+                key = Hash::rehash(key);
+            }
+            if (foundFreeKey) key = freeKey;
+
+            stats.misses++;
+            std::unique_ptr<T> resource = ResourceLoader<T>::load(key, std::forward<Args>(args)...);
+            if (!resource) return ResourceHandle<T>();
+
+            uint32_t index = allocateSlot();
+            Slot& slot = slots[index];
+            slot.resource = std::move(resource);
+            slot.key = key;
+            slot.refCount = 0;
+
+            keyToSlot[key] = index;
+            pointerToSlot[slot.resource.get()] = index;
+            return addReference(index);
+        }
+
+        /**
+         * @brief Adds a reference to a resource that is already held.
+         * @param handle The handle.
+         * @return The same handle, or an invalid one if the handle is stale.
+         */
+        ResourceHandle<T> retain(ResourceHandle<T> handle)
+        {
+            return isAlive(handle) ? addReference(handle.index) : ResourceHandle<T>();
+        }
+
+        /**
+         * @brief Drops a reference. The resource is deleted by collect() once unused long enough.
+         * @param handle The handle.
+         * @return False if the handle is stale or holds no references.
+         */
+        bool release(ResourceHandle<T> handle)
+        {
+            if (!isAlive(handle)) return false;
+
+            Slot& slot = slots[handle.index];
+            if (slot.refCount == 0) return false;
+
+            if (--slot.refCount == 0)
+            {
+                slot.releasedFrame = frame;
+                if (!slot.queued)
+                {
+                    slot.queued = true;
+                    unusedSlots.push_back(handle.index);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Resolves a handle.
+         * @param handle The handle.
+         * @return The resource, or null if the handle is stale.
+         */
+        T* get(ResourceHandle<T> handle) const
+        {
+            return isAlive(handle) ? slots[handle.index].resource.get() : nullptr;
+        }
+
+        /**
+         * @brief Finds the handle of a resource pointer handed out earlier.
+         * @param resource The resource.
+         * @return The handle, invalid if the resource is not managed here.
+         */
+        ResourceHandle<T> findHandle(const T* resource) const
+        {
+            auto it = pointerToSlot.find(resource);
+            if (it == pointerToSlot.end()) return ResourceHandle<T>();
+            return makeHandle(it->second);
+        }
+
+        /**
+         * @brief Finds the handle of a cached key without adding a reference.
+         *
+         * Entries moved to another key after a collision are not found by their original key.
+         *
+         * @param key The cache key.
+         * @return The handle, invalid if the key is not cached.
+         */
+        ResourceHandle<T> findHandle(AssetId key) const
+        {
+            auto it = keyToSlot.find(key);
+            if (it == keyToSlot.end() || it->second == FREED_KEY) return ResourceHandle<T>();
+            return makeHandle(it->second);
+        }
+
+        /**
+         * @brief Gets the reference count of a resource.
+         * @param handle The handle.
+         * @return The count, 0 for stale handles.
+         */
+        uint32_t getRefCount(ResourceHandle<T> handle) const
+        {
+            return isAlive(handle) ? slots[handle.index].refCount : 0;
+        }
+
+        /**
+         * @brief Deletes resources unused for `retainFrames` frames.
+         *
+         * A regular collection also advances the frame counter, so call it once per frame.
+         *
+         * @param force Delete every unused resource regardless of when it was released.
+         * @return The number of resources deleted.
+         */
+        size_t collect(bool force = false)
+        {
+            if (!force) frame++;
+
+            // Only slots whose count dropped to zero are visited, not the whole cache
+            size_t collected = 0;
+            size_t kept = 0;
+            for (uint32_t index : unusedSlots)
+            {
+                Slot& slot = slots[index];
+                if (slot.refCount > 0)
+                {
+                    slot.queued = false; // Acquired again in the meantime
+                }
+                else if (force || frame - slot.releasedFrame >= retainFrames)
+                {
+                    freeSlot(index);
+                    collected++;
+                }
+                else
+                {
+                    unusedSlots[kept++] = index;
+                }
+            }
+            unusedSlots.resize(kept);
+            return collected;
+        }
+
+        /**
+         * @brief Deletes every resource, referenced or not, and invalidates all handles.
+         * @return The number of resources that were still referenced.
+         */
+        size_t clear()
+        {
+            size_t referenced = 0;
+            for (uint32_t i = 0; i < slots.size(); ++i)
+            {
+                if (!slots[i].resource) continue;
+                if (slots[i].refCount > 0) referenced++;
+                freeSlot(i);
+            }
+            unusedSlots.clear();
+            keyToSlot.clear();
+            return referenced;
+        }
+
+        /**
+         * @brief Sets how many collect() calls an unused resource survives before it is deleted.
+         * @param frames The number of frames, 0 deletes at the next collect().
+         */
+        void setRetainFrames(uint64_t frames) { retainFrames = frames; }
+
+        /**
+         * @brief Gets the number of cached resources, referenced or not.
+         * @return The resource count.
+         */
+        size_t getResourceCount() const { return pointerToSlot.size(); }
+
+        /**
+         * @brief Gets the lookup counters.
+         * @return The hit, miss and collision counts since startup.
+         */
+        const ResourceCacheStats& getStats() const { return stats; }
+
+    private:
+        static constexpr uint32_t FREED_KEY = 0xFFFFFFFFu; ///< `keyToSlot` value of a collected entry that continues a collision chain.
+
+        /**
+         * @struct Slot
+         * @brief Storage of one resource.
+         */
+        struct Slot
+        {
+            std::unique_ptr<T> resource;    ///< The resource, null when the slot is free.
+            AssetId key = 0;                ///< Cache key.
+            uint32_t refCount = 0;          ///< Outstanding references.
+            uint32_t generation = 0;        ///< Incremented every time the slot is freed.
+            uint64_t releasedFrame = 0;     ///< Frame the reference count dropped to zero.
+            bool queued = false;            ///< Listed in unusedSlots.
+        };
+
+        bool isAlive(ResourceHandle<T> handle) const
+        {
+            return handle.index < slots.size() && slots[handle.index].generation == handle.generation && slots[handle.index].resource;
+        }
+
+        ResourceHandle<T> makeHandle(uint32_t index) const
+        {
+            ResourceHandle<T> handle;
+            handle.index = index;
+            handle.generation = slots[index].generation;
+            return handle;
+        }
+
+        ResourceHandle<T> addReference(uint32_t index)
+        {
+            slots[index].refCount++;
+            return makeHandle(index);
+        }
+
+        uint32_t allocateSlot()
+        {
+            if (!freeSlots.empty())
+            {
+                uint32_t index = freeSlots.back();
+                freeSlots.pop_back();
+                return index;
+            }
+
+            slots.emplace_back();
+            return static_cast<uint32_t>(slots.size() - 1);
+        }
+
+        void freeSlot(uint32_t index)
+        {
+            Slot& slot = slots[index];
+            if (keyToSlot.count(Hash::rehash(slot.key)))
+            {
+                // Entries that collided with this one are only reachable through its key, keep the chain linked
+                keyToSlot[slot.key] = FREED_KEY;
+            }
+            else
+            {
+                keyToSlot.erase(slot.key);
+            }
+            pointerToSlot.erase(slot.resource.get());
+
+            slot.resource.reset();
+            slot.key = 0;
+            slot.refCount = 0;
+            slot.queued = false;
+            slot.generation++;
+            freeSlots.push_back(index);
+        }
+
+        std::vector<Slot> slots;                                ///< Slot storage, indexed by handles.
+        std::vector<uint32_t> freeSlots;                        ///< Indices of free slots.
+        std::vector<uint32_t> unusedSlots;                      ///< Slots whose reference count reached zero.
+        std::unordered_map<AssetId, uint32_t> keyToSlot;        ///< Cache key to slot index.
+        std::unordered_map<const T*, uint32_t> pointerToSlot;   ///< Resource pointer to slot index.
+        uint64_t frame = 0;                                     ///< Number of collect() calls.
+        uint64_t retainFrames = 2;                              ///< Frames an unused resource is kept.
+        ResourceCacheStats stats;                               ///< Lookup counters.
+    };
+}
@@ -0,0 +1,58 @@
+#include "ResourceManagementSystem.h"
+#include "Profiler.h"
+#include "Log.h"
+
+using namespace ScrapGameEngine;
+
+ResourceManagementSystem& ResourceManagementSystem::getInstance()
+{
+    static ResourceManagementSystem instance;
+    return instance;
+}
+
+void ResourceManagementSystem::releaseResource(const std::string& path)
+{
+    AssetId id = AssetPaths::intern(path);
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (textureAllocator.release(textureAllocator.findHandle(id))) return;
+
+    SGE_LOG_ERROR(ALLOCATER, "Error: Resource not found when releasing: {}", path);
+}
+
+void ResourceManagementSystem::garbageCollect()
+{
+    SGE_PROFILE_SCOPE("ResourceManagementSystem::garbageCollect");
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t collected = textureAllocator.collect() + meshAllocator.collect();
+    if (collected > 0)
+    {
+        SGE_LOG_DEBUG(ALLOCATER, "Collected {} unused resources", collected);
+    }
+}
+
+void ResourceManagementSystem::collectUnused()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t collected = textureAllocator.collect(true) + meshAllocator.collect(true);
+    SGE_LOG_DEBUG(ALLOCATER, "Released {} unused resources", collected);
+}
+
+void ResourceManagementSystem::shutdown()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const ResourceCacheStats& textureStats = textureAllocator.getStats();
+    const ResourceCacheStats& meshStats = meshAllocator.getStats();
+    SGE_LOG_INFO(ALLOCATER, "Texture cache: {} hits, {} misses, {} collisions", textureStats.hits, textureStats.misses, textureStats.collisions);
+    SGE_LOG_INFO(ALLOCATER, "Mesh cache: {} hits, {} misses, {} collisions", meshStats.hits, meshStats.misses, meshStats.collisions);
+
+    size_t textures = textureAllocator.clear();
+    size_t meshes = meshAllocator.clear();
+    if (textures > 0 || meshes > 0)
+    {
+        SGE_LOG_WARN(ALLOCATER, "{} textures and {} meshes were still referenced at shutdown", textures, meshes);
+    }
+}
@@ -1,40 +1,243 @@
-#pragma once
-#include "IResourceManager.h"
-#include "ResourceAllocator.h"
-#include "Texture2D.h"
-#include "Mesh.h"
-#include "GameObject.h"
-#include <memory>
-#include <mutex>
-
-namespace ScrapGameEngine
-{
-    class ResourceManagementSystem : public IResourceManager
-    {
-    public:
-        static ResourceManagementSystem& getInstance();
-
-        // Template method for loading resources
-        template <typename ResourceType, typename... Args>
-        ResourceType* loadResource(const std::string& path, Args&&... args)
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            return getAllocator<ResourceType>().getResource(path, std::forward<Args>(args)...);
-        }
-
-        void releaseResource(const std::string& path) override;
-        void garbageCollect() override;
-
-    private:
-        ResourceManagementSystem() = default;
-        std::mutex mutex_;
-
-        ResourceAllocator<Texture2D> textureAllocator;
-        ResourceAllocator<Mesh> meshAllocator;
-        ResourceAllocator<GameObject> gameObjectAllocator;
-
-        // Template specialization to retrieve the appropriate allocator
-        template <typename ResourceType>
-        ResourceAllocator<ResourceType>& getAllocator();
-    };
-}
+#pragma once
+#include "IResourceManager.h"
+#include "ResourceAllocator.h"
+#include "Texture2D.h"
+#include "Mesh.h"
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct ResourceLoader<Texture2D>
+     * @brief Loads textures from disk with a `TextureConfig`. Keys are interned paths.
+     */
+    template <>
+    struct ResourceLoader<Texture2D>
+    {
+        static std::unique_ptr<Texture2D> load(AssetId id, const TextureConfig& cfg)
+        {
+            return std::unique_ptr<Texture2D>(Texture2D::createTexture(AssetPaths::getPath(id), cfg));
+        }
+
+        static std::unique_ptr<Texture2D> load(AssetId id, const TextureConfig& cfg, const TextureData& data)
+        {
+            return std::unique_ptr<Texture2D>(Texture2D::createTexture(AssetPaths::getPath(id), cfg, data));
+        }
+
+        // Interned paths never collide, the ID alone identifies the texture
+        static bool matches(const Texture2D& /*texture*/, const TextureConfig& /*cfg*/)
+        {
+            return true;
+        }
+
+        static bool matches(const Texture2D& /*texture*/, const TextureConfig& /*cfg*/, const TextureData& /*data*/)
+        {
+            return true;
+        }
+    };
+
+    /**
+     * @struct ResourceLoader<Mesh>
+     * @brief Creates meshes from vertex data. Keys are content hashes of the vertices.
+     *
+     * A hash match alone is not trusted: the cached vertices are compared byte for byte, so two
+     * different meshes can never share a cache entry.
+     */
+    template <>
+    struct ResourceLoader<Mesh>
+    {
+        static std::unique_ptr<Mesh> load(AssetId /*key*/, const std::vector<Vertex>& vertices)
+        {
+            return std::make_unique<Mesh>(vertices);
+        }
+
+        static bool matches(const Mesh& mesh, const std::vector<Vertex>& vertices)
+        {
+            const std::vector<Vertex>& cached = mesh.getVertices();
+            return cached.size() == vertices.size() &&
+                (vertices.empty() || std::memcmp(cached.data(), vertices.data(), vertices.size() * sizeof(Vertex)) == 0);
+        }
+    };
+
+    /**
+     * @class ResourceManagementSystem
+     * @brief Owns one `ResourceAllocator` per resource type behind a single lock.
+     *
+     * Resources are acquired by `AssetId` (an interned path or a content hash) and referenced
+     * through typed handles. Releasing the last
+     * reference only marks a resource unused; garbageCollect(), called by the application once
+     * per frame, deletes resources that stayed unused for a few frames. `TextureAllocator` and
+     * `MeshAllocator` are thin facades over this system.
+     */
+    class ResourceManagementSystem : public IResourceManager
+    {
+    public:
+        /**
+         * @brief Gets the global instance.
+         * @return The resource management system.
+         */
+        static ResourceManagementSystem& getInstance();
+
+        /**
+         * @brief Gets a resource, loading it if needed, and adds a reference.
+         * @param key The cache key, see `AssetPaths::intern` and `Hash::xxh64`.
+         * @param args Arguments for `ResourceLoader<ResourceType>` when the resource is loaded.
+         * @return The handle, invalid if loading failed.
+         */
+        template <typename ResourceType, typename... Args>
+        ResourceHandle<ResourceType> acquire(AssetId key, Args&&... args)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return getAllocator<ResourceType>().acquire(key, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Gets a resource, loading it if needed, and adds a reference.
+         * @param key The cache key, see `AssetPaths::intern` and `Hash::xxh64`.
+         * @param args Arguments for `ResourceLoader<ResourceType>` when the resource is loaded.
+         * @return The resource, or null if loading failed.
+         */
+        template <typename ResourceType, typename... Args>
+        ResourceType* loadResource(AssetId key, Args&&... args)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ResourceAllocator<ResourceType>& allocator = getAllocator<ResourceType>();
+            return allocator.get(allocator.acquire(key, std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Gets a resource by path, loading it if needed, and adds a reference.
+         * @param path The asset path, interned into its `AssetId`.
+         * @param args Arguments for `ResourceLoader<ResourceType>` when the resource is loaded.
+         * @return The resource, or null if loading failed.
+         */
+        template <typename ResourceType, typename... Args>
+        ResourceType* loadResource(const std::string& path, Args&&... args)
+        {
+            return loadResource<ResourceType>(AssetPaths::intern(path), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Resolves a handle.
+         * @param handle The handle.
+         * @return The resource, or null if the handle is stale.
+         */
+        template <typename ResourceType>
+        ResourceType* get(ResourceHandle<ResourceType> handle)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return getAllocator<ResourceType>().get(handle);
+        }
+
+        /**
+         * @brief Looks a cached resource up by key without adding a reference.
+         * @param key The cache key.
+         * @return The resource, or null if nothing is cached under the key.
+         */
+        template <typename ResourceType>
+        ResourceType* find(AssetId key)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ResourceAllocator<ResourceType>& allocator = getAllocator<ResourceType>();
+            return allocator.get(allocator.findHandle(key));
+        }
+
+        /**
+         * @brief Drops a reference by handle.
+         * @param handle The handle.
+         * @return False if the handle is stale or holds no references.
+         */
+        template <typename ResourceType>
+        bool release(ResourceHandle<ResourceType> handle)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return getAllocator<ResourceType>().release(handle);
+        }
+
+        /**
+         * @brief Drops a reference by resource pointer.
+         * @param resource A resource returned by loadResource() or get().
+         * @return False if the resource is not managed or holds no references.
+         */
+        template <typename ResourceType>
+        bool release(const ResourceType* resource)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ResourceAllocator<ResourceType>& allocator = getAllocator<ResourceType>();
+            return allocator.release(allocator.findHandle(resource));
+        }
+
+        /**
+         * @brief Drops a reference to the texture loaded from a path.
+         * @param path The asset path.
+         */
+        void releaseResource(const std::string& path) override;
+
+        /**
+         * @brief Deletes resources that have been unused for a few frames. Call once per frame.
+         */
+        void garbageCollect() override;
+
+        /**
+         * @brief Deletes every unused resource immediately.
+         */
+        void collectUnused();
+
+        /**
+         * @brief Deletes every unused resource of one type immediately.
+         * @return The number of resources deleted.
+         */
+        template <typename ResourceType>
+        size_t collectUnused()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return getAllocator<ResourceType>().collect(true);
+        }
+
+        /**
+         * @brief Gets the cache hit, miss and collision counters of one type.
+         * @return A copy of the counters.
+         */
+        template <typename ResourceType>
+        ResourceCacheStats getCacheStats()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return getAllocator<ResourceType>().getStats();
+        }
+
+        /**
+         * @brief Deletes every resource, reporting the ones that were still referenced.
+         *
+         * Call before the graphics context is destroyed.
+         */
+        void shutdown();
+
+        /**
+         * @brief Gets the allocator of a resource type. The caller must not use it concurrently.
+         * @return The allocator.
+         */
+        template <typename ResourceType>
+        ResourceAllocator<ResourceType>& getAllocator();
+
+    private:
+        ResourceManagementSystem() = default;
+        std::mutex mutex_; ///< Serializes access to the allocators.
+
+        ResourceAllocator<Texture2D> textureAllocator; ///< Textures keyed by interned path.
+        ResourceAllocator<Mesh> meshAllocator;          ///< Meshes keyed by vertex content hash.
+    };
+
+    template <>
+    inline ResourceAllocator<Texture2D>& ResourceManagementSystem::getAllocator<Texture2D>()
+    {
+        return textureAllocator;
+    }
+
+    template <>
+    inline ResourceAllocator<Mesh>& ResourceManagementSystem::getAllocator<Mesh>()
+    {
+        return meshAllocator;
+    }
+}
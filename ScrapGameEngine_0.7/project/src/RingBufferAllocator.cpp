@@ -0,0 +1,166 @@
+#include "RingBufferAllocator.h"
+
+namespace ScrapGameEngine
+{
+    // Round value up to the next multiple of alignment (alignment must be a power of two)
+    static size_t alignUp(size_t value, size_t alignment)
+    {
+        if (alignment <= 1) return value;
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    RingBufferAllocator::RingBufferAllocator(size_t capacity, unsigned int maxFramesInFlight, FenceWaitFn waitFn, FenceReleaseFn releaseFn)
+        : capacity(capacity), maxFramesInFlight(maxFramesInFlight > 0 ? maxFramesInFlight : 1), waitFn(waitFn), releaseFn(releaseFn)
+    {
+    }
+
+    RingBufferAllocator::~RingBufferAllocator()
+    {
+        // Fences may still be pending, but nobody will wait on them anymore.
+        for (auto& region : inFlight)
+        {
+            if (region.fence && releaseFn) releaseFn(region.fence);
+        }
+        inFlight.clear();
+    }
+
+    bool RingBufferAllocator::allocate(size_t size, size_t alignment, size_t& outOffset)
+    {
+        if (size == 0 || size > capacity) return false;
+
+        retireCompleted();
+
+        while (true)
+        {
+            // Nothing is live, restart from the beginning of the buffer
+            if (liveBytes == 0)
+            {
+                head = tail = frameBegin = 0;
+                frameWrapCount = 0;
+            }
+
+            size_t aligned = alignUp(head, alignment);
+            size_t placed = 0;
+            bool fits = false;
+            bool wraps = false;
+
+            if (liveBytes > 0 && head == tail)
+            {
+                // Buffer completely full
+                fits = false;
+            }
+            else if (head >= tail)
+            {
+                // Free space is [head, capacity) and [0, tail)
+                if (aligned + size <= capacity)
+                {
+                    placed = aligned;
+                    fits = true;
+                }
+                else if (size <= tail)
+                {
+                    placed = 0;
+                    fits = true;
+                    wraps = true;
+                }
+            }
+            else if (aligned + size <= tail)
+            {
+                // Free space is [head, tail)
+                placed = aligned;
+                fits = true;
+            }
+
+            if (fits)
+            {
+                size_t padding = wraps ? (capacity - head) : (placed - head);
+                size_t consumed = padding + size;
+
+                if (wraps)
+                {
+                    frameWrapCount++;
+                    wrapCount++;
+                }
+
+                liveBytes += consumed;
+                frameBytes += consumed;
+                head = placed + size;
+
+                outOffset = placed;
+                return true;
+            }
+
+            // Out of space: wait for the oldest frame in flight to free its region
+            if (!retireOldest(true))
+            {
+                // Only the current frame is live and the block does not fit next to it
+                return false;
+            }
+        }
+    }
+
+    void RingBufferAllocator::endFrame(FenceHandle fence)
+    {
+        if (frameBytes == 0)
+        {
+            // Nothing to protect
+            if (fence && releaseFn) releaseFn(fence);
+        }
+        else
+        {
+            inFlight.push_back({ head, frameBytes, fence });
+        }
+
+        frameBegin = head;
+        frameBytes = 0;
+        frameWrapCount = 0;
+
+        // Limit the number of frames the CPU can run ahead of the GPU
+        while (inFlight.size() > maxFramesInFlight)
+        {
+            retireOldest(true);
+        }
+
+        retireCompleted();
+    }
+
+    void RingBufferAllocator::reset()
+    {
+        while (retireOldest(true)) {}
+
+        head = tail = frameBegin = 0;
+        liveBytes = 0;
+        frameBytes = 0;
+        frameWrapCount = 0;
+    }
+
+    bool RingBufferAllocator::retireOldest(bool block)
+    {
+        if (inFlight.empty()) return false;
+
+        FrameRegion region = inFlight.front();
+        if (region.fence)
+        {
+            if (!waitFn || !waitFn(region.fence, false))
+            {
+                if (!block) return false;
+
+                // The GPU is still reading this region, we have to wait
+                stallCount++;
+                if (waitFn) waitFn(region.fence, true);
+            }
+
+            if (releaseFn) releaseFn(region.fence);
+        }
+
+        inFlight.pop_front();
+        liveBytes -= region.bytes;
+        tail = region.end;
+        return true;
+    }
+
+    void RingBufferAllocator::retireCompleted()
+    {
+        while (retireOldest(false)) {}
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <functional>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @typedef FenceHandle
+     * @brief Opaque handle to a backend fence object (e.g. an OpenGL sync object).
+     */
+    using FenceHandle = void*;
+
+    /**
+     * @typedef FenceWaitFn
+     * @brief Checks (and optionally blocks on) a fence.
+     * @param fence The fence to query.
+     * @param block If true, wait until the fence is signaled.
+     * @return True if the fence is signaled.
+     */
+    using FenceWaitFn = std::function<bool(FenceHandle fence, bool block)>;
+
+    /**
+     * @typedef FenceReleaseFn
+     * @brief Releases a fence once the ring buffer no longer needs it.
+     * @param fence The fence to release.
+     */
+    using FenceReleaseFn = std::function<void(FenceHandle fence)>;
+
+    /**
+     * @class RingBufferAllocator
+     * @brief Backend-independent bookkeeping for a ring buffer sub-allocated per frame.
+     *
+     * The allocator hands out byte offsets into a buffer of fixed capacity. Everything allocated
+     * during a frame is retired together by the fence passed to `endFrame()`, and its space is only
+     * reused once that fence is signaled. When the buffer is full the allocator waits on the oldest
+     * fence, which is counted as a stall. No graphics API calls are made here; the fence callbacks
+     * are supplied by the owner.
+     */
+    class RingBufferAllocator
+    {
+    public:
+        /**
+         * @brief Constructs a ring buffer allocator.
+         * @param capacity The size of the buffer in bytes.
+         * @param maxFramesInFlight The maximum number of frames that may be pending on the GPU.
+         * @param waitFn Callback used to query or wait on a fence.
+         * @param releaseFn Callback used to release a fence after it has been retired.
+         */
+        RingBufferAllocator(size_t capacity, unsigned int maxFramesInFlight, FenceWaitFn waitFn, FenceReleaseFn releaseFn);
+
+        /**
+         * @brief Releases all fences still in flight.
+         */
+        ~RingBufferAllocator();
+
+        /**
+         * @brief Allocates a block for the current frame.
+         * @param size The size of the block in bytes.
+         * @param alignment The required alignment of the block in bytes (power of two).
+         * @param outOffset Receives the byte offset of the block inside the buffer.
+         * @return True on success, false if the block can never fit.
+         */
+        bool allocate(size_t size, size_t alignment, size_t& outOffset);
+
+        /**
+         * @brief Closes the current frame, protecting its allocations with the given fence.
+         * @param fence The fence signaled once the GPU is done with this frame (may be nullptr).
+         */
+        void endFrame(FenceHandle fence);
+
+        /**
+         * @brief Waits for all frames in flight and resets the buffer to empty.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the capacity of the buffer in bytes.
+         * @return The capacity in bytes.
+         */
+        size_t getCapacity() const { return capacity; }
+
+        /**
+         * @brief Gets the number of bytes currently in use, including alignment and wrap padding.
+         * @return The used bytes.
+         */
+        size_t getUsedBytes() const { return liveBytes; }
+
+        /**
+         * @brief Gets the offset at which the current frame started writing.
+         * @return The byte offset of the current frame's first allocation.
+         */
+        size_t getFrameBegin() const { return frameBegin; }
+
+        /**
+         * @brief Gets the offset of the next allocation.
+         * @return The current write head.
+         */
+        size_t getHead() const { return head; }
+
+        /**
+         * @brief Checks whether the current frame wrapped around the end of the buffer.
+         * @return True if the frame's allocations are split in two ranges.
+         */
+        bool frameWrapped() const { return frameWrapCount > 0; }
+
+        /**
+         * @brief Gets the number of bytes allocated in the current frame.
+         * @return The frame's bytes including padding.
+         */
+        size_t getFrameBytes() const { return frameBytes; }
+
+        /**
+         * @brief Gets how many times an allocation had to block on a fence.
+         * @return The stall count.
+         */
+        unsigned int getStallCount() const { return stallCount; }
+
+        /**
+         * @brief Gets how many times the write head wrapped around.
+         * @return The wrap count.
+         */
+        unsigned int getWrapCount() const { return wrapCount; }
+
+        /**
+         * @brief Gets the number of frames still waiting on their fence.
+         * @return The number of frames in flight.
+         */
+        size_t getFramesInFlight() const { return inFlight.size(); }
+
+    private:
+        /**
+         * @struct FrameRegion
+         * @brief A closed frame waiting for its fence.
+         */
+        struct FrameRegion
+        {
+            size_t end;         ///< Offset just past the frame's last allocation.
+            size_t bytes;       ///< Bytes consumed by the frame, including padding.
+            FenceHandle fence;  ///< Fence protecting the region.
+        };
+
+        /**
+         * @brief Retires the oldest frame in flight.
+         * @param block If true, wait on the fence when it is not yet signaled.
+         * @return True if a frame was retired.
+         */
+        bool retireOldest(bool block);
+
+        /**
+         * @brief Retires every frame whose fence is already signaled.
+         */
+        void retireCompleted();
+
+        size_t capacity;                 ///< Size of the buffer in bytes.
+        unsigned int maxFramesInFlight;  ///< Frames allowed to be pending at once.
+        FenceWaitFn waitFn;              ///< Backend fence query.
+        FenceReleaseFn releaseFn;        ///< Backend fence release.
+
+        size_t head = 0;                 ///< Next write offset.
+        size_t tail = 0;                 ///< Offset of the oldest live byte.
+        size_t liveBytes = 0;            ///< Bytes not yet retired.
+        size_t frameBegin = 0;           ///< Offset where the current frame started.
+        size_t frameBytes = 0;           ///< Bytes consumed by the current frame.
+        unsigned int frameWrapCount = 0; ///< Wraps performed by the current frame.
+
+        unsigned int stallCount = 0;     ///< Blocking fence waits performed.
+        unsigned int wrapCount = 0;      ///< Total wraps performed.
+
+        std::deque<FrameRegion> inFlight; ///< Closed frames, oldest first.
+    };
+}
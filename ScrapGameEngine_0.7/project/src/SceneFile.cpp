@@ -0,0 +1,266 @@
+#include "SceneFile.h"
+#include "SceneRecords.h"
+#include "GameObjectCollection.h"
+#include "TextureAllocator.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "AudioSource.h"
+#include "TweenComponent.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <chrono>
+#include <cstring>
+
+using namespace ScrapGameEngine;
+
+GameObject* SceneInstance::find(const std::string& name) const
+{
+    for (GameObject* object : objects)
+    {
+        if (object->getName() == name) return object;
+    }
+    return nullptr;
+}
+
+// Points a section pointer at the records following the previous section
+template <typename Record>
+static const unsigned char* takeSection(const unsigned char* cursor, uint32_t count, const Record*& section)
+{
+    section = reinterpret_cast<const Record*>(cursor);
+    return cursor + static_cast<size_t>(count) * sizeof(Record);
+}
+
+bool SceneFile::open(const std::string& filePath)
+{
+    close();
+
+    if (!file.open(filePath))
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Failed to open scene file: {}", filePath);
+        return false;
+    }
+
+    const unsigned char* data = file.getData();
+    const SceneFileHeader* candidate = reinterpret_cast<const SceneFileHeader*>(data);
+    if (file.getSize() < sizeof(SceneFileHeader) || std::memcmp(candidate->magic, "SGES", 4) != 0)
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Not a scene file: {}", filePath);
+        file.close();
+        return false;
+    }
+    if (candidate->version != SCENE_FORMAT_VERSION)
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Scene file {} has version {}, expected {}", filePath, candidate->version, SCENE_FORMAT_VERSION);
+        file.close();
+        return false;
+    }
+
+    // 64-bit sums, the counts come from the file
+    uint64_t expected = sizeof(SceneFileHeader)
+        + uint64_t(candidate->objectCount) * sizeof(SceneObjectRecord)
+        + uint64_t(candidate->spriteCount) * sizeof(SceneSpriteRecord)
+        + uint64_t(candidate->buttonCount) * sizeof(SceneButtonRecord)
+        + uint64_t(candidate->audioCount) * sizeof(SceneAudioRecord)
+        + uint64_t(candidate->tweenCount) * sizeof(SceneTweenRecord)
+        + uint64_t(candidate->assetCount) * sizeof(SceneAssetRecord)
+        + candidate->stringBytes;
+    if (expected != file.getSize())
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Scene file {} is {} bytes, its header describes {}", filePath, file.getSize(), expected);
+        file.close();
+        return false;
+    }
+
+    const unsigned char* cursor = data + sizeof(SceneFileHeader);
+    cursor = takeSection(cursor, candidate->objectCount, objects);
+    cursor = takeSection(cursor, candidate->spriteCount, sprites);
+    cursor = takeSection(cursor, candidate->buttonCount, buttons);
+    cursor = takeSection(cursor, candidate->audioCount, audio);
+    cursor = takeSection(cursor, candidate->tweenCount, tweens);
+    cursor = takeSection(cursor, candidate->assetCount, assets);
+    strings = reinterpret_cast<const char*>(cursor);
+    header = candidate;
+    path = filePath;
+
+    if (!validate())
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Scene file {} is malformed", filePath);
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SceneFile::close()
+{
+    file.close();
+    path.clear();
+    header = nullptr;
+    objects = nullptr;
+    sprites = nullptr;
+    buttons = nullptr;
+    audio = nullptr;
+    tweens = nullptr;
+    assets = nullptr;
+    strings = nullptr;
+}
+
+bool SceneFile::validate() const
+{
+    const uint32_t stringBytes = header->stringBytes;
+    if (stringBytes > 0 && strings[stringBytes - 1] != '\0') return false;
+
+    for (uint32_t i = 0; i < header->assetCount; ++i)
+    {
+        const SceneAssetRecord& asset = assets[i];
+        if (asset.type > static_cast<uint32_t>(AssetType::FONT) || asset.path >= stringBytes) return false;
+        if (asset.wrapModeX > static_cast<uint32_t>(TextureWrapMode::CLAMP_TO_BORDER) ||
+            asset.wrapModeY > static_cast<uint32_t>(TextureWrapMode::CLAMP_TO_BORDER) ||
+            asset.filterMode > static_cast<uint32_t>(TextureFilterMode::NEAREST_MIPMAP_LINEAR) ||
+            asset.mipFilter > static_cast<uint32_t>(MipFilter::KAISER)) return false;
+    }
+
+    // Parents precede their children, so there are no cycles
+    for (uint32_t i = 0; i < header->objectCount; ++i)
+    {
+        const SceneObjectRecord& object = objects[i];
+        if (object.name >= stringBytes || object.parent < -1 || object.parent >= static_cast<int32_t>(i)) return false;
+    }
+
+    auto isAsset = [this](int32_t index, AssetType type)
+    {
+        return index == -1 || (index >= 0 && static_cast<uint32_t>(index) < header->assetCount &&
+            assets[index].type == static_cast<uint32_t>(type));
+    };
+
+    for (uint32_t i = 0; i < header->spriteCount; ++i)
+    {
+        if (sprites[i].object >= header->objectCount || !isAsset(sprites[i].texture, AssetType::TEXTURE)) return false;
+    }
+    for (uint32_t i = 0; i < header->buttonCount; ++i)
+    {
+        if (buttons[i].object >= header->objectCount) return false;
+    }
+    for (uint32_t i = 0; i < header->audioCount; ++i)
+    {
+        if (audio[i].object >= header->objectCount || !isAsset(audio[i].clip, AssetType::AUDIO)) return false;
+    }
+    for (uint32_t i = 0; i < header->tweenCount; ++i)
+    {
+        const SceneTweenRecord& tween = tweens[i];
+        if (tween.object >= header->objectCount ||
+            tween.type > static_cast<uint32_t>(TweenType::COLOR) ||
+            tween.easing > static_cast<uint32_t>(EasingType::EASE_IN_OUT_BOUNCE)) return false;
+    }
+    return true;
+}
+
+void SceneFile::declareAssets(SceneManifest& manifest) const
+{
+    if (!isOpen()) return;
+
+    for (uint32_t i = 0; i < header->assetCount; ++i)
+    {
+        const SceneAssetRecord& asset = assets[i];
+        switch (static_cast<AssetType>(asset.type))
+        {
+        case AssetType::TEXTURE:
+            manifest.addTexture(getString(asset.path), SceneRecords::toTextureConfig(asset));
+            break;
+        case AssetType::AUDIO:
+            manifest.addAudio(getString(asset.path));
+            break;
+        case AssetType::FONT:
+            manifest.addFont(getString(asset.path));
+            break;
+        }
+    }
+}
+
+bool SceneFile::instantiate(SceneInstance& instance, bool addToCollection) const
+{
+    if (!isOpen()) return false;
+    SGE_PROFILE_SCOPE("SceneFile::instantiate");
+    auto start = std::chrono::steady_clock::now();
+
+    // Each texture is acquired once, however many sprites use it
+    size_t firstAsset = instance.textures.size();
+    instance.textures.resize(firstAsset + header->assetCount, nullptr);
+    for (uint32_t i = 0; i < header->assetCount; ++i)
+    {
+        if (assets[i].type != static_cast<uint32_t>(AssetType::TEXTURE)) continue;
+
+        std::string texturePath = getString(assets[i].path);
+        TextureConfig cfg = SceneRecords::toTextureConfig(assets[i]);
+        instance.textures[firstAsset + i] = TextureAllocator::getTexture(texturePath, cfg);
+    }
+
+    size_t first = instance.objects.size();
+    instance.objects.reserve(first + header->objectCount);
+    for (uint32_t i = 0; i < header->objectCount; ++i)
+    {
+        const SceneObjectRecord& record = objects[i];
+        GameObject* object = GameObject::Create(getString(record.name));
+        object->transform->setPosition({ record.position[0], record.position[1] });
+        object->transform->setRotation(record.rotation);
+        object->transform->setScale({ record.scale[0], record.scale[1] });
+        if (record.parent >= 0)
+        {
+            object->transform->setParent(instance.objects[first + record.parent]->transform);
+        }
+        instance.objects.push_back(object);
+    }
+
+    for (uint32_t i = 0; i < header->spriteCount; ++i)
+    {
+        const SceneSpriteRecord& record = sprites[i];
+        auto* sprite = instance.objects[first + record.object]->addComponent<SpriteRenderer>();
+        Texture2D* texture = record.texture >= 0 ? instance.textures[firstAsset + record.texture] : nullptr;
+        SceneRecords::apply(record, *sprite, texture);
+    }
+
+    for (uint32_t i = 0; i < header->buttonCount; ++i)
+    {
+        const SceneButtonRecord& record = buttons[i];
+        auto* button = instance.objects[first + record.object]->addComponent<Button>();
+        SceneRecords::apply(record, *button);
+    }
+
+    for (uint32_t i = 0; i < header->audioCount; ++i)
+    {
+        const SceneAudioRecord& record = audio[i];
+        auto* source = instance.objects[first + record.object]->addComponent<AudioSource>();
+        SceneRecords::apply(record, *source, record.clip >= 0 ? getString(assets[record.clip].path) : nullptr);
+    }
+
+    for (uint32_t i = 0; i < header->tweenCount; ++i)
+    {
+        const SceneTweenRecord& record = tweens[i];
+        auto* tween = instance.objects[first + record.object]->addComponent<TweenComponent>();
+        SceneRecords::apply(record, *tween);
+    }
+
+    if (addToCollection)
+    {
+        for (size_t i = first; i < instance.objects.size(); ++i)
+        {
+            GameObjectCollection::add(instance.objects[i]);
+        }
+    }
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    SGE_LOG_INFO(SCENE_MANAGER, "Instantiated {} objects from {} in {} ms", header->objectCount, path, elapsedMs);
+    return true;
+}
+
+void SceneFile::release(SceneInstance& instance)
+{
+    for (Texture2D* texture : instance.textures)
+    {
+        if (texture)
+        {
+            TextureAllocator::returnTexture(texture);
+        }
+    }
+    instance.textures.clear();
+}
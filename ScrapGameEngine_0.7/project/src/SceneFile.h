@@ -0,0 +1,109 @@
+#pragma once
+#include "SceneFormat.h"
+#include "SceneManifest.h"
+#include "MappedFile.h"
+#include "GameObject.h"
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct SceneInstance
+     * @brief The objects and assets created from a scene file.
+     */
+    struct SceneInstance
+    {
+        std::vector<GameObject*> objects;   /**< One per object record, in file order. */
+        std::vector<Texture2D*> textures;   /**< One reference per texture asset, null for the others. */
+
+        /**
+         * @brief Finds an object by name.
+         * @param name The name.
+         * @return The first object with that name, or null.
+         */
+        GameObject* find(const std::string& name) const;
+    };
+
+    /**
+     * @class SceneFile
+     * @brief Loads scenes written by `SceneWriter`.
+     *
+     * The file is memory-mapped and validated once by open(); the records are then read in
+     * place, never copied or parsed. instantiate() creates the objects in one pass per
+     * section, acquiring each texture once, and hands them to the `GameObjectCollection`
+     * of the scene being initialized, which awakes, updates, renders and disposes them.
+     */
+    class SceneFile
+    {
+    public:
+        /**
+         * @brief Maps and validates a scene file.
+         * @param path The file path.
+         * @return False if the file is missing, has another version, or is malformed.
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief Unmaps the file. Instances created from it are not affected.
+         */
+        void close();
+
+        /**
+         * @brief Checks whether a valid file is mapped.
+         * @return True after a successful open().
+         */
+        bool isOpen() const { return header != nullptr; }
+
+        /**
+         * @brief Gets the header.
+         * @return The header. Only valid while open.
+         */
+        const SceneFileHeader& getHeader() const { return *header; }
+
+        /**
+         * @brief Gets a string from the string table.
+         * @param offset The offset stored in a record.
+         * @return The string, valid while the file is open.
+         */
+        const char* getString(uint32_t offset) const { return strings + offset; }
+
+        /**
+         * @brief Declares the file's assets for `SceneLoader`, from a scene's `declareAssets`.
+         * @param manifest Receives the textures and audio clips.
+         */
+        void declareAssets(SceneManifest& manifest) const;
+
+        /**
+         * @brief Creates the objects and components described by the file.
+         * @param instance Receives the objects and texture references, appended to any it already holds.
+         * @param addToCollection False to keep the objects out of the `GameObjectCollection`; the caller then owns them.
+         * @return False if the file is not open.
+         */
+        bool instantiate(SceneInstance& instance, bool addToCollection = true) const;
+
+        /**
+         * @brief Returns the texture references of an instance. The objects are left to their owner.
+         * @param instance The instance.
+         */
+        static void release(SceneInstance& instance);
+
+    private:
+        /**
+         * @brief Checks every index and offset in the records, so instantiate() needs no checks.
+         * @return True if the records are consistent.
+         */
+        bool validate() const;
+
+        MappedFile file;                                /**< The mapped file. */
+        std::string path;                               /**< Path of the mapped file. */
+        const SceneFileHeader* header = nullptr;        /**< Start of the file, null if not open. */
+        const SceneObjectRecord* objects = nullptr;     /**< Object section. */
+        const SceneSpriteRecord* sprites = nullptr;     /**< Sprite section. */
+        const SceneButtonRecord* buttons = nullptr;     /**< Button section. */
+        const SceneAudioRecord* audio = nullptr;        /**< Audio section. */
+        const SceneTweenRecord* tweens = nullptr;       /**< Tween section. */
+        const SceneAssetRecord* assets = nullptr;       /**< Asset section. */
+        const char* strings = nullptr;                  /**< String table. */
+    };
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @brief Version written by `SceneWriter`. `SceneFile` rejects other versions.
+     */
+    constexpr uint32_t SCENE_FORMAT_VERSION = 1;
+
+    /**
+     * @brief Extension of binary scene files.
+     */
+    constexpr const char* SCENE_FILE_EXTENSION = ".sgescene";
+
+    /*
+     * Layout of a `.sgescene` file, little-endian, every record 4-byte aligned:
+     *
+     *   SceneFileHeader
+     *   SceneObjectRecord[objectCount]   one per GameObject, with its Transform
+     *   SceneSpriteRecord[spriteCount]   sorted by object
+     *   SceneButtonRecord[buttonCount]   sorted by object
+     *   SceneAudioRecord[audioCount]     sorted by object
+     *   SceneTweenRecord[tweenCount]     sorted by object
+     *   SceneAssetRecord[assetCount]     textures and audio clips, each path once
+     *   char[stringBytes]                null-terminated names and paths
+     *
+     * Records only hold plain numbers; names and paths are offsets into the string table and
+     * assets are indices into the asset records, so a mapped file is read without parsing.
+     */
+
+    /**
+     * @struct SceneFileHeader
+     * @brief Start of a scene file.
+     */
+    struct SceneFileHeader
+    {
+        char magic[4];          /**< "SGES". */
+        uint32_t version;       /**< SCENE_FORMAT_VERSION. */
+        uint32_t objectCount;   /**< Number of object records. */
+        uint32_t spriteCount;   /**< Number of sprite records. */
+        uint32_t buttonCount;   /**< Number of button records. */
+        uint32_t audioCount;    /**< Number of audio records. */
+        uint32_t tweenCount;    /**< Number of tween records. */
+        uint32_t assetCount;    /**< Number of asset records. */
+        uint32_t stringBytes;   /**< Size of the string table. */
+        uint32_t reserved;      /**< Zero. */
+    };
+
+    /**
+     * @struct SceneObjectRecord
+     * @brief A GameObject and the local values of its Transform.
+     */
+    struct SceneObjectRecord
+    {
+        uint32_t name;          /**< String offset of the name. */
+        int32_t parent;         /**< Index of an earlier object, -1 for none. */
+        float position[2];      /**< Local position. */
+        float rotation;         /**< Local rotation in degrees. */
+        float scale[2];         /**< Local scale. */
+    };
+
+    /**
+     * @struct SceneSpriteRecord
+     * @brief A SpriteRenderer.
+     */
+    struct SceneSpriteRecord
+    {
+        uint32_t object;        /**< Index of the owning object. */
+        int32_t texture;        /**< Index of a texture asset, -1 for none. */
+        float color[3];         /**< RGB tint. */
+        float opacity;          /**< Alpha, 0 to 1. */
+        float size[2];          /**< Width and height. */
+        float pivot[2];         /**< Pivot point. */
+    };
+
+    /**
+     * @struct SceneButtonRecord
+     * @brief A Button. Click handlers are code, scenes connect them after loading.
+     */
+    struct SceneButtonRecord
+    {
+        uint32_t object;        /**< Index of the owning object. */
+        float size[2];          /**< Width and height. */
+        float color[4];         /**< Background color. */
+        float hoverColor[4];    /**< Background color while hovered. */
+        float transparency;     /**< Background opacity. */
+    };
+
+    /**
+     * @struct SceneAudioRecord
+     * @brief An AudioSource.
+     */
+    struct SceneAudioRecord
+    {
+        uint32_t object;        /**< Index of the owning object. */
+        int32_t clip;           /**< Index of an audio asset, -1 for none. */
+        float volume;           /**< Volume, 0 to 1. */
+        uint32_t loop;          /**< Non-zero to loop. */
+    };
+
+    /**
+     * @struct SceneTweenRecord
+     * @brief A TweenComponent and the tween it starts with.
+     */
+    struct SceneTweenRecord
+    {
+        uint32_t object;        /**< Index of the owning object. */
+        uint32_t type;          /**< TweenType. */
+        uint32_t easing;        /**< EasingType. */
+        float target[3];        /**< Target value. */
+        float duration;         /**< Duration in seconds. */
+        uint32_t autoStart;     /**< Non-zero to start the tween when the object is created. */
+    };
+
+    /**
+     * @struct SceneAssetRecord
+     * @brief A file referenced by components. Texture fields are ignored for audio.
+     */
+    struct SceneAssetRecord
+    {
+        uint32_t type;              /**< AssetType. */
+        uint32_t path;              /**< String offset of the path. */
+        uint32_t wrapModeX;         /**< TextureWrapMode for X. */
+        uint32_t wrapModeY;         /**< TextureWrapMode for Y. */
+        uint32_t filterMode;        /**< TextureFilterMode. */
+        uint32_t generateMipmaps;   /**< Non-zero to generate mipmaps. */
+        uint32_t mipFilter;         /**< MipFilter. */
+        float borderColor[4];       /**< Border color for CLAMP_TO_BORDER. */
+    };
+
+    static_assert(sizeof(SceneFileHeader) == 40, "Scene header layout changed");
+    static_assert(sizeof(SceneObjectRecord) == 28, "Scene object layout changed");
+    static_assert(sizeof(SceneSpriteRecord) == 40, "Scene sprite layout changed");
+    static_assert(sizeof(SceneButtonRecord) == 48, "Scene button layout changed");
+    static_assert(sizeof(SceneAudioRecord) == 16, "Scene audio layout changed");
+    static_assert(sizeof(SceneTweenRecord) == 32, "Scene tween layout changed");
+    static_assert(sizeof(SceneAssetRecord) == 44, "Scene asset layout changed");
+    static_assert(std::is_trivially_copyable<SceneObjectRecord>::value && std::is_trivially_copyable<SceneAssetRecord>::value,
+        "Scene records are read in place and must stay plain data");
+}
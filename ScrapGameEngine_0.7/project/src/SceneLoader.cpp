@@ -0,0 +1,393 @@
+#include "SceneLoader.h"
+#include "SceneStateMachine.h"
+#include "ResourceManagementSystem.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+using namespace ScrapGameEngine;
+
+std::string SceneLoader::sceneName;
+std::vector<SceneLoader::Node> SceneLoader::nodes;
+std::vector<ResourceHandle<Texture2D>> SceneLoader::handles;
+std::vector<std::thread> SceneLoader::workers;
+std::mutex SceneLoader::mutex;
+std::condition_variable SceneLoader::wake;
+std::condition_variable SceneLoader::decodedReady;
+std::deque<size_t> SceneLoader::ready;
+std::deque<size_t> SceneLoader::decoded;
+bool SceneLoader::stopping = false;
+bool SceneLoader::loading = false;
+size_t SceneLoader::loadedCount = 0;
+uint64_t SceneLoader::totalBytes = 0;
+uint64_t SceneLoader::loadedBytes = 0;
+double SceneLoader::decodeMs = 0.0;
+double SceneLoader::startTime = 0.0;
+double SceneLoader::completeTime = 0.0;
+
+// Seconds on a monotonic clock
+static double nowSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Reads a whole file
+static bool readFile(const std::string& path, std::vector<char>& contents)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    contents.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(contents.data(), contents.size()));
+}
+
+bool SceneLoader::begin(const std::string& name)
+{
+    if (loading) finish();
+
+    BaseScene* scene = SceneStateMachine::findScene(name);
+    if (!scene)
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Cannot preload scene '{}': Scene not found.", name);
+        return false;
+    }
+
+    SceneManifest manifest;
+    scene->declareAssets(manifest);
+
+    sceneName = name;
+    nodes.clear();
+    handles.clear();
+    loadedCount = 0;
+    totalBytes = 0;
+    loadedBytes = 0;
+    decodeMs = 0.0;
+    stopping = false;
+    loading = true;
+    startTime = nowSeconds();
+    completeTime = 0.0;
+
+    for (const AssetRequest& request : manifest.getAssets())
+    {
+        Node node;
+        node.request = request;
+
+        std::error_code error;
+        uintmax_t size = std::filesystem::file_size(request.path, error);
+        node.bytes = error ? 0 : static_cast<uint64_t>(size);
+        totalBytes += node.bytes;
+
+        nodes.push_back(std::move(node));
+    }
+
+    buildGraph();
+
+    // Textures a previous scene left in the cache only need a reference
+    ResourceManagementSystem& rms = ResourceManagementSystem::getInstance();
+    std::vector<bool> resident(nodes.size(), false);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        Node& node = nodes[i];
+        if (node.request.type != AssetType::TEXTURE) continue;
+
+        AssetId id = AssetPaths::intern(node.request.path);
+        if (rms.find<Texture2D>(id))
+        {
+            handles.push_back(rms.acquire<Texture2D>(id, node.request.textureConfig));
+            resident[i] = true;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (!resident[i] && nodes[i].waitingOn == 0) ready.push_back(i);
+        }
+    }
+
+    // Every resident node is marked before any is completed, so a resident dependent can never reach zero and be queued
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (resident[i]) nodes[i].waitingOn = -1;
+    }
+
+    // Dependents of resident textures become ready here
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (resident[i]) complete(i);
+    }
+
+    unsigned int workerCount = std::min<unsigned int>(MAX_WORKERS, std::max(1u, std::thread::hardware_concurrency()));
+    workerCount = std::min<unsigned int>(workerCount, static_cast<unsigned int>(nodes.size() - loadedCount));
+    for (unsigned int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&SceneLoader::workerLoop);
+    }
+
+    SGE_LOG_INFO(SCENE_MANAGER, "Preloading {} assets ({} bytes) for scene '{}' on {} workers", nodes.size(), totalBytes, name, workerCount);
+    return true;
+}
+
+void SceneLoader::buildGraph()
+{
+    std::unordered_map<std::string, size_t> indices;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        indices[nodes[i].request.path] = i;
+    }
+
+    std::vector<std::vector<size_t>> edges(nodes.size());
+    std::vector<int> inDegree(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        for (const std::string& dependency : nodes[i].request.dependencies)
+        {
+            auto it = indices.find(dependency);
+            if (it == indices.end() || it->second == i)
+            {
+                SGE_LOG_WARN(SCENE_MANAGER, "Ignoring dependency of {} on {}: Not declared by the scene.", nodes[i].request.path, dependency);
+                continue;
+            }
+
+            edges[it->second].push_back(i);
+            inDegree[i]++;
+        }
+    }
+
+    // Kahn's algorithm, whatever it cannot order is part of or behind a cycle
+    std::vector<int> remaining = inDegree;
+    std::vector<size_t> queue;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (remaining[i] == 0) queue.push_back(i);
+    }
+    std::vector<bool> ordered(nodes.size(), false);
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        size_t index = queue[head];
+        ordered[index] = true;
+        for (size_t dependent : edges[index])
+        {
+            if (--remaining[dependent] == 0) queue.push_back(dependent);
+        }
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (!ordered[i])
+        {
+            SGE_LOG_WARN(SCENE_MANAGER, "Ignoring dependencies of {}: Dependency cycle.", nodes[i].request.path);
+        }
+    }
+
+    // Unordered nodes load without waiting, an ordered node never depends on an unordered one
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        for (size_t dependent : edges[i])
+        {
+            if (!ordered[dependent]) continue;
+
+            nodes[i].dependents.push_back(dependent);
+            nodes[dependent].waitingOn++;
+        }
+    }
+}
+
+void SceneLoader::workerLoop()
+{
+    SGE_PROFILE_THREAD("SceneLoader");
+
+    while (true)
+    {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [] { return stopping || !ready.empty(); });
+            if (stopping) return;
+
+            index = ready.front();
+            ready.pop_front();
+        }
+
+        // Only this worker touches the node until it is queued for the main thread
+        Node& node = nodes[index];
+        double start = nowSeconds();
+        {
+            SGE_PROFILE_SCOPE("SceneLoader::decode");
+            if (node.request.type == AssetType::TEXTURE)
+            {
+                node.failed = !Texture2D::decodeFile(node.request.path, node.texture);
+            }
+            else
+            {
+                // Audio and fonts are loaded by their components, reading them here warms the file cache
+                std::vector<char> contents;
+                node.failed = !readFile(node.request.path, contents);
+            }
+        }
+        double elapsed = (nowSeconds() - start) * 1000.0;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            decodeMs += elapsed;
+            decoded.push_back(index);
+        }
+        decodedReady.notify_one();
+    }
+}
+
+void SceneLoader::update()
+{
+    if (!loading) return;
+    SGE_PROFILE_SCOPE("SceneLoader::update");
+
+    ResourceManagementSystem& rms = ResourceManagementSystem::getInstance();
+    int uploads = 0;
+    while (uploads < MAX_FINALIZE_PER_FRAME)
+    {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (decoded.empty()) break;
+            index = decoded.front();
+            decoded.pop_front();
+        }
+
+        Node& node = nodes[index];
+        if (node.failed)
+        {
+            SGE_LOG_ERROR(SCENE_MANAGER, "Failed to preload {}", node.request.path);
+        }
+        else if (node.request.type == AssetType::TEXTURE)
+        {
+            ResourceHandle<Texture2D> handle = rms.acquire<Texture2D>(AssetPaths::intern(node.request.path), node.request.textureConfig, node.texture);
+            if (handle.isValid())
+            {
+                handles.push_back(handle);
+            }
+            else
+            {
+                SGE_LOG_ERROR(SCENE_MANAGER, "Failed to upload {}", node.request.path);
+            }
+
+            node.texture = TextureData();
+            uploads++;
+        }
+
+        complete(index);
+    }
+}
+
+void SceneLoader::waitUntilComplete()
+{
+    if (!loading) return;
+    SGE_PROFILE_SCOPE("SceneLoader::waitUntilComplete");
+
+    // An incomplete node is queued, decoding, decoded or waiting on one that is, so each wait ends
+    while (!isComplete())
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            decodedReady.wait(lock, [] { return !decoded.empty(); });
+        }
+        update();
+    }
+}
+
+void SceneLoader::complete(size_t index)
+{
+    Node& node = nodes[index];
+    loadedCount++;
+    loadedBytes += node.bytes;
+    if (loadedCount == nodes.size())
+    {
+        completeTime = nowSeconds();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t dependent : node.dependents)
+    {
+        if (--nodes[dependent].waitingOn == 0) ready.push_back(dependent);
+    }
+    wake.notify_all();
+}
+
+void SceneLoader::finish()
+{
+    if (!loading) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+
+    ResourceManagementSystem& rms = ResourceManagementSystem::getInstance();
+    for (const ResourceHandle<Texture2D>& handle : handles)
+    {
+        rms.release(handle);
+    }
+    handles.clear();
+
+    double finishTime = completeTime > 0.0 ? completeTime : nowSeconds();
+    SGE_LOG_INFO(SCENE_MANAGER, "Preloaded {}/{} assets ({} bytes) for scene '{}' in {} ms, {} ms of worker time",
+        loadedCount, nodes.size(), loadedBytes, sceneName, (finishTime - startTime) * 1000.0, decodeMs);
+
+    nodes.clear();
+    ready.clear();
+    decoded.clear();
+    loading = false;
+}
+
+bool SceneLoader::isLoading()
+{
+    return loading;
+}
+
+bool SceneLoader::isComplete()
+{
+    return loading && loadedCount == nodes.size();
+}
+
+float SceneLoader::getProgress()
+{
+    if (nodes.empty()) return loading ? 1.0f : 0.0f;
+    if (totalBytes == 0) return static_cast<float>(loadedCount) / nodes.size();
+    return static_cast<float>(static_cast<double>(loadedBytes) / totalBytes);
+}
+
+size_t SceneLoader::getAssetCount()
+{
+    return nodes.size();
+}
+
+size_t SceneLoader::getLoadedAssetCount()
+{
+    return loadedCount;
+}
+
+uint64_t SceneLoader::getTotalBytes()
+{
+    return totalBytes;
+}
+
+uint64_t SceneLoader::getLoadedBytes()
+{
+    return loadedBytes;
+}
+
+const std::string& SceneLoader::getSceneName()
+{
+    return sceneName;
+}
@@ -0,0 +1,158 @@
+#pragma once
+#include "SceneManifest.h"
+#include "ResourceAllocator.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class SceneLoader
+     * @brief Preloads the assets a scene declares, in parallel, before the scene is switched to.
+     *
+     * begin() asks the scene for its `SceneManifest` and turns it into a dependency graph.
+     * Assets whose dependencies are resident are read and decoded by worker threads; update()
+     * uploads the decoded textures on the main thread, a few per frame, and holds a reference
+     * to them until finish(). By then the scene's own `TextureAllocator::getTexture` calls are
+     * cache hits, so its initialization does no disk or decoding work for declared textures.
+     *
+     * Progress is measured in bytes read from disk. Missing files and failed decodes count as
+     * done and are logged, so a broken asset cannot stall the loading screen.
+     */
+    class SceneLoader
+    {
+    public:
+        SceneLoader() = delete; ///< Prevent instantiation of this class.
+
+        static constexpr unsigned int MAX_WORKERS = 4;  ///< Upper bound on worker threads.
+        static constexpr int MAX_FINALIZE_PER_FRAME = 4; ///< Textures uploaded per update().
+
+        /**
+         * @brief Starts preloading a scene's assets. Finishes any load still in progress first.
+         * @param sceneName The name of a scene added to the `SceneStateMachine`.
+         * @return False if the scene does not exist.
+         */
+        static bool begin(const std::string& sceneName);
+
+        /**
+         * @brief Uploads decoded assets. Call once per frame on the main thread.
+         */
+        static void update();
+
+        /**
+         * @brief Blocks, uploading decoded assets, until every declared asset is resident or has failed.
+         *
+         * Replays use it to finish a load on the frame the recording did, however long this machine takes.
+         */
+        static void waitUntilComplete();
+
+        /**
+         * @brief Releases the preloaded assets, stops the workers and logs the load times.
+         *
+         * Call after the scene is initialized, so its own references keep the assets alive.
+         */
+        static void finish();
+
+        /**
+         * @brief Checks whether a load was begun and not finished.
+         * @return True while loading.
+         */
+        static bool isLoading();
+
+        /**
+         * @brief Checks whether every declared asset is resident or has failed.
+         * @return True once the scene can be switched to.
+         */
+        static bool isComplete();
+
+        /**
+         * @brief Gets the fraction of bytes loaded, or of assets if the sizes are unknown.
+         * @return A value from 0 to 1.
+         */
+        static float getProgress();
+
+        /**
+         * @brief Gets the number of declared assets.
+         * @return The asset count.
+         */
+        static size_t getAssetCount();
+
+        /**
+         * @brief Gets the number of assets that are resident or have failed.
+         * @return The finished asset count.
+         */
+        static size_t getLoadedAssetCount();
+
+        /**
+         * @brief Gets the total size of the declared files.
+         * @return The size in bytes.
+         */
+        static uint64_t getTotalBytes();
+
+        /**
+         * @brief Gets the size of the finished files.
+         * @return The size in bytes.
+         */
+        static uint64_t getLoadedBytes();
+
+        /**
+         * @brief Gets the scene being loaded.
+         * @return The name passed to begin().
+         */
+        static const std::string& getSceneName();
+
+    private:
+        /**
+         * @struct Node
+         * @brief A declared asset in the dependency graph.
+         */
+        struct Node
+        {
+            AssetRequest request;           /**< The declaration. */
+            uint64_t bytes = 0;             /**< File size, measured in begin(). */
+            std::vector<size_t> dependents; /**< Nodes waiting for this one. */
+            int waitingOn = 0;              /**< Dependencies not yet resident. */
+            bool failed = false;            /**< Set by a worker if the file could not be read. */
+            TextureData texture;            /**< Decoded contents of a texture. */
+        };
+
+        /**
+         * @brief Links the nodes, dropping missing and cyclic dependencies.
+         */
+        static void buildGraph();
+
+        /**
+         * @brief Reads and decodes ready nodes until finish().
+         */
+        static void workerLoop();
+
+        /**
+         * @brief Marks a node resident and schedules the dependents it was blocking. Main thread only.
+         * @param index The node.
+         */
+        static void complete(size_t index);
+
+        static std::string sceneName;                   /**< The scene being loaded. */
+        static std::vector<Node> nodes;                 /**< The dependency graph. */
+        static std::vector<ResourceHandle<Texture2D>> handles; /**< Preloaded textures, held until finish(). */
+        static std::vector<std::thread> workers;        /**< Worker threads. */
+        static std::mutex mutex;                        /**< Guards the queues and `stopping`. */
+        static std::condition_variable wake;            /**< Signals workers when `ready` grows. */
+        static std::condition_variable decodedReady;    /**< Signals waitUntilComplete() when `decoded` grows. */
+        static std::deque<size_t> ready;                /**< Nodes for the workers. */
+        static std::deque<size_t> decoded;              /**< Nodes for the main thread. */
+        static bool stopping;                           /**< Tells the workers to exit. */
+        static bool loading;                            /**< True between begin() and finish(). */
+        static size_t loadedCount;                      /**< Finished nodes. */
+        static uint64_t totalBytes;                     /**< Size of all files. */
+        static uint64_t loadedBytes;                    /**< Size of the finished files. */
+        static double decodeMs;                         /**< Worker time, summed over workers. Guarded by `mutex`. */
+        static double startTime;                        /**< Time of begin(), in seconds. */
+        static double completeTime;                     /**< Time the last node finished, in seconds. */
+    };
+}
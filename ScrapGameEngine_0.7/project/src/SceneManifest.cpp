@@ -0,0 +1,54 @@
+#include "SceneManifest.h"
+#include <algorithm>
+
+using namespace ScrapGameEngine;
+
+void SceneManifest::addTexture(const std::string& path, const TextureConfig& cfg)
+{
+    size_t count = assets.size();
+    AssetRequest& asset = add(AssetType::TEXTURE, path);
+
+    // Only a new declaration sets the configuration
+    if (assets.size() != count)
+    {
+        asset.textureConfig = cfg;
+    }
+}
+
+void SceneManifest::addAudio(const std::string& path)
+{
+    add(AssetType::AUDIO, path);
+}
+
+void SceneManifest::addFont(const std::string& path)
+{
+    add(AssetType::FONT, path);
+}
+
+void SceneManifest::addDependency(const std::string& path, const std::string& dependsOn)
+{
+    for (AssetRequest& asset : assets)
+    {
+        if (asset.path != path) continue;
+
+        if (std::find(asset.dependencies.begin(), asset.dependencies.end(), dependsOn) == asset.dependencies.end())
+        {
+            asset.dependencies.push_back(dependsOn);
+        }
+        return;
+    }
+}
+
+AssetRequest& SceneManifest::add(AssetType type, const std::string& path)
+{
+    for (AssetRequest& asset : assets)
+    {
+        if (asset.path == path) return asset;
+    }
+
+    AssetRequest asset;
+    asset.type = type;
+    asset.path = path;
+    assets.push_back(std::move(asset));
+    return assets.back();
+}
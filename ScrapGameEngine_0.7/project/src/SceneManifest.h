@@ -0,0 +1,84 @@
+#pragma once
+#include "Texture2D.h"
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum AssetType
+     * @brief Specifies how the scene loader reads an asset.
+     */
+    enum class AssetType
+    {
+        TEXTURE,    /**< Decoded on a worker, uploaded and cached on the main thread. */
+        AUDIO,      /**< Read on a worker so the scene's own load hits the OS file cache. */
+        FONT        /**< Read on a worker so the scene's own load hits the OS file cache. */
+    };
+
+    /**
+     * @struct AssetRequest
+     * @brief An asset a scene needs before it can be initialized.
+     */
+    struct AssetRequest
+    {
+        AssetType type = AssetType::TEXTURE;    /**< How the asset is loaded. */
+        std::string path;                       /**< The file path, as passed to the scene's loaders. */
+        TextureConfig textureConfig;            /**< Configuration of a texture, must match the scene's. */
+        std::vector<std::string> dependencies;  /**< Paths that must be resident before this one. */
+    };
+
+    /**
+     * @class SceneManifest
+     * @brief The list of assets a scene declares in `BaseScene::declareAssets`.
+     *
+     * Assets are loaded in parallel unless a dependency orders them. Declaring the same
+     * path twice keeps the first declaration and merges the dependencies.
+     */
+    class SceneManifest
+    {
+    public:
+        /**
+         * @brief Declares a texture.
+         * @param path The file path.
+         * @param cfg The configuration the scene loads it with. The first load decides the cached texture's configuration.
+         */
+        void addTexture(const std::string& path, const TextureConfig& cfg);
+
+        /**
+         * @brief Declares an audio clip.
+         * @param path The file path.
+         */
+        void addAudio(const std::string& path);
+
+        /**
+         * @brief Declares a font.
+         * @param path The file path.
+         */
+        void addFont(const std::string& path);
+
+        /**
+         * @brief Makes one asset wait for another.
+         * @param path The asset that waits.
+         * @param dependsOn The asset that must be resident first.
+         */
+        void addDependency(const std::string& path, const std::string& dependsOn);
+
+        /**
+         * @brief Gets the declared assets.
+         * @return The assets in declaration order.
+         */
+        const std::vector<AssetRequest>& getAssets() const { return assets; }
+
+    private:
+        /**
+         * @brief Finds or adds an asset.
+         * @param type The type used if the asset is new.
+         * @param path The file path.
+         * @return The asset.
+         */
+        AssetRequest& add(AssetType type, const std::string& path);
+
+        std::vector<AssetRequest> assets; /**< Declared assets. */
+    };
+}
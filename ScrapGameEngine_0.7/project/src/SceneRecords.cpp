@@ -0,0 +1,112 @@
+#include "SceneRecords.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "AudioSource.h"
+#include "TweenComponent.h"
+#include <algorithm>
+
+using namespace ScrapGameEngine;
+
+SceneSpriteRecord SceneRecords::makeSprite(uint32_t object, int32_t texture)
+{
+    SceneSpriteRecord record{};
+    record.object = object;
+    record.texture = texture;
+    record.color[0] = record.color[1] = record.color[2] = 1.0f;
+    record.opacity = 1.0f;
+    record.size[0] = record.size[1] = 1.0f;
+    record.pivot[0] = record.pivot[1] = 0.5f;
+    return record;
+}
+
+SceneButtonRecord SceneRecords::makeButton(uint32_t object)
+{
+    SceneButtonRecord record{};
+    record.object = object;
+    record.size[0] = record.size[1] = 1.0f;
+    std::fill(std::begin(record.color), std::end(record.color), 1.0f);
+    std::fill(std::begin(record.hoverColor), std::end(record.hoverColor), 0.5f);
+    record.transparency = 1.0f;
+    return record;
+}
+
+SceneAudioRecord SceneRecords::makeAudio(uint32_t object, int32_t clip)
+{
+    SceneAudioRecord record{};
+    record.object = object;
+    record.clip = clip;
+    record.volume = 1.0f;
+    return record;
+}
+
+SceneTweenRecord SceneRecords::makeTween(uint32_t object)
+{
+    SceneTweenRecord record{};
+    record.object = object;
+    return record;
+}
+
+SceneAssetRecord SceneRecords::makeAsset(AssetType type, uint32_t path, const TextureConfig& cfg)
+{
+    SceneAssetRecord record{};
+    record.type = static_cast<uint32_t>(type);
+    record.path = path;
+    record.wrapModeX = static_cast<uint32_t>(cfg.wrapModeX);
+    record.wrapModeY = static_cast<uint32_t>(cfg.wrapModeY);
+    record.filterMode = static_cast<uint32_t>(cfg.filterMode);
+    record.generateMipmaps = cfg.generateMipmaps ? 1 : 0;
+    record.mipFilter = static_cast<uint32_t>(cfg.mipFilter);
+    for (int i = 0; i < 4; ++i) record.borderColor[i] = cfg.borderColor[i];
+    return record;
+}
+
+TextureConfig SceneRecords::toTextureConfig(const SceneAssetRecord& asset)
+{
+    TextureConfig cfg{};
+    cfg.wrapModeX = static_cast<TextureWrapMode>(asset.wrapModeX);
+    cfg.wrapModeY = static_cast<TextureWrapMode>(asset.wrapModeY);
+    cfg.filterMode = static_cast<TextureFilterMode>(asset.filterMode);
+    cfg.borderColor = { asset.borderColor[0], asset.borderColor[1], asset.borderColor[2], asset.borderColor[3] };
+    cfg.generateMipmaps = asset.generateMipmaps != 0;
+    cfg.mipFilter = static_cast<MipFilter>(asset.mipFilter);
+    return cfg;
+}
+
+void SceneRecords::apply(const SceneSpriteRecord& record, SpriteRenderer& sprite, Texture2D* texture)
+{
+    sprite.setColour(record.color[0], record.color[1], record.color[2]);
+    sprite.setOpacity(record.opacity);
+    sprite.setSize(record.size[0], record.size[1]);
+    sprite.setPivot(record.pivot[0], record.pivot[1]);
+    if (texture)
+    {
+        sprite.setTexture(texture);
+    }
+}
+
+void SceneRecords::apply(const SceneButtonRecord& record, Button& button)
+{
+    button.setSize(glm::vec2(record.size[0], record.size[1]));
+    button.setColor({ record.color[0], record.color[1], record.color[2], record.color[3] });
+    button.setHoverColor({ record.hoverColor[0], record.hoverColor[1], record.hoverColor[2], record.hoverColor[3] });
+    button.setTransparency(record.transparency);
+}
+
+void SceneRecords::apply(const SceneAudioRecord& record, AudioSource& source, const char* clipPath)
+{
+    if (clipPath)
+    {
+        source.load(clipPath, record.loop != 0);
+    }
+    source.setLooping(record.loop != 0);
+    source.setVolume(record.volume);
+}
+
+void SceneRecords::apply(const SceneTweenRecord& record, TweenComponent& tween)
+{
+    if (record.autoStart)
+    {
+        tween.startTween(static_cast<TweenType>(record.type), { record.target[0], record.target[1], record.target[2] },
+            record.duration, static_cast<EasingType>(record.easing));
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "SceneFormat.h"
+#include "SceneManifest.h"
+
+namespace ScrapGameEngine
+{
+    class SpriteRenderer;
+    class Button;
+    class AudioSource;
+    class TweenComponent;
+
+    /**
+     * @class SceneRecords
+     * @brief Creates and applies the component records shared by `SceneFile` and `Prefab`.
+     *
+     * A record holds the values a component is configured with. The make functions return
+     * one filled with the component's defaults; the apply functions configure a component
+     * from one.
+     */
+    class SceneRecords
+    {
+    public:
+        SceneRecords() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Makes a sprite record with white color, full opacity, unit size and a centered pivot.
+         * @param object The owning object.
+         * @param texture The texture asset, or -1.
+         * @return The record.
+         */
+        static SceneSpriteRecord makeSprite(uint32_t object, int32_t texture);
+
+        /**
+         * @brief Makes a button record with unit size, white color, grey hover color and full opacity.
+         * @param object The owning object.
+         * @return The record.
+         */
+        static SceneButtonRecord makeButton(uint32_t object);
+
+        /**
+         * @brief Makes an audio record at full volume without looping.
+         * @param object The owning object.
+         * @param clip The audio asset, or -1.
+         * @return The record.
+         */
+        static SceneAudioRecord makeAudio(uint32_t object, int32_t clip);
+
+        /**
+         * @brief Makes a tween record that starts no tween.
+         * @param object The owning object.
+         * @return The record.
+         */
+        static SceneTweenRecord makeTween(uint32_t object);
+
+        /**
+         * @brief Makes an asset record.
+         * @param type The asset type.
+         * @param path The string offset of the path.
+         * @param cfg The texture configuration, stored for every type.
+         * @return The record.
+         */
+        static SceneAssetRecord makeAsset(AssetType type, uint32_t path, const TextureConfig& cfg);
+
+        /**
+         * @brief Rebuilds the texture configuration stored in an asset record.
+         * @param asset The record.
+         * @return The configuration.
+         */
+        static TextureConfig toTextureConfig(const SceneAssetRecord& asset);
+
+        /**
+         * @brief Configures a sprite.
+         * @param record The record.
+         * @param sprite The sprite.
+         * @param texture The resolved texture asset, or null to leave it unset.
+         */
+        static void apply(const SceneSpriteRecord& record, SpriteRenderer& sprite, Texture2D* texture);
+
+        /**
+         * @brief Configures a button.
+         * @param record The record.
+         * @param button The button.
+         */
+        static void apply(const SceneButtonRecord& record, Button& button);
+
+        /**
+         * @brief Configures an audio source.
+         * @param record The record.
+         * @param source The audio source.
+         * @param clipPath The resolved audio asset path, or null to leave it unloaded.
+         */
+        static void apply(const SceneAudioRecord& record, AudioSource& source, const char* clipPath);
+
+        /**
+         * @brief Starts the recorded tween, if the record asks for it.
+         * @param record The record.
+         * @param tween The tween component.
+         */
+        static void apply(const SceneTweenRecord& record, TweenComponent& tween);
+    };
+}
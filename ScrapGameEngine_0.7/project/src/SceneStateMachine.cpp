@@ -1,99 +1,369 @@
-#include "SceneStateMachine.h"
-#include "GameObjectCollection.h"
-using namespace ScrapGameEngine;
-
-std::unordered_map<std::string, BaseScene*> SceneStateMachine::scenes;
-BaseScene* SceneStateMachine::currentScene;
-unsigned int SceneStateMachine::sceneIdCounter;
-
-void SceneStateMachine::loadScene(const std::string name)
-{
-    std::cout << "[SCENE_MANAGER] Loading scene: " << name << std::endl; // Log scene name
-
-    // 1. Look for the scene matching the name
-    auto it = scenes.find(name);
-    if (it != scenes.end())
-    {
-        // If found:
-        // a. Deactivate currentScene, if there is one
-        if (currentScene)
-        {
-            currentScene->deactivate();
-            std::cout << "[SCENE_MANAGER] Deactivated scene: " << currentScene->getName() << std::endl; // Logging
-        }
-
-        // b. Dispose all currently active gameObjects.
-        GameObjectCollection::dispose();
-
-        // c. Point currentScene to the new scene.
-        currentScene = it->second;
-
-        // d. Initialize and activate the new scene.
-        currentScene->initialize();
-        currentScene->activate();
-    }
-    else
-    {
-        // Otherwise, log error
-        std::cout << "[SCENE_MANAGER] Error: Scene '" << name << "' not found." << std::endl;
-    }
-}
-
-void SceneStateMachine::loadScene(const unsigned int index)
-{
-    std::cout << "[SCENE_MANAGER] Loading scene: " << index << std::endl; // Log scene name
-
-    // Ensure the index is valid
-    if (index < scenes.size())
-    {
-        auto it = std::next(scenes.begin(), index);
-        loadScene(it->first);
-    }
-    else
-    {
-        std::cout << "[SCENE_MANAGER] Error: Invalid scene index." << std::endl;
-    }
-}
-
-void SceneStateMachine::update(float deltaTime)
-{
-    // Update current scene if there is one.
-    if (currentScene)
-    {
-        currentScene->update(deltaTime);
-    }
-}
-
-void SceneStateMachine::render()
-{
-    // Render current scene if there is one.
-    if (currentScene)
-    {
-        currentScene->render();
-    }
-}
-
-void SceneStateMachine::dispose()
-{
-    // Dispose all currently active gameObjects.
-    GameObjectCollection::dispose();
-
-    // For each element in scenes
-    for (auto& scene : scenes)
-    {
-        delete scene.second; // Clean up each scene
-        std::cout << "[SCENE_MANAGER] Disposing scene: " << scene.second->getName() << std::endl; // Log scene name
-    }
-    scenes.clear(); // Clear the collection
-
-    // Reset sceneIdCounter
-    sceneIdCounter = 0;
-
-    // Set currentScene to nullptr for safety.
-    currentScene = nullptr;
-}
-
-BaseScene* SceneStateMachine::getCurrentScene()
-{
-	return currentScene;
-}
+#include "SceneStateMachine.h"
+#include "GameObjectCollection.h"
+#include "SceneLoader.h"
+#include "FontCache.h"
+#include "TweenSystem.h"
+#include "SpriteAnimationSystem.h"
+#include "EventBus.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+using namespace ScrapGameEngine;
+
+std::unordered_map<std::string, BaseScene*> SceneStateMachine::scenes;
+BaseScene* SceneStateMachine::currentScene;
+unsigned int SceneStateMachine::sceneIdCounter;
+std::list<SceneStateMachine::ResidentScene> SceneStateMachine::residentScenes;
+std::string SceneStateMachine::preparingScene;
+bool SceneStateMachine::pinPreparation = false;
+uint64_t SceneStateMachine::currentSceneBytes = 0;
+uint64_t SceneStateMachine::residentBudget = 0;
+uint64_t SceneStateMachine::requestSubscription = 0;
+uint64_t SceneStateMachine::updateCount = 0;
+uint64_t SceneStateMachine::preparedUpdate = 0;
+bool SceneStateMachine::scriptedPreparation = false;
+uint64_t SceneStateMachine::scheduledPreparation = 0;
+
+void SceneStateMachine::loadScene(const std::string name)
+{
+    SGE_LOG_INFO(SCENE_MANAGER, "Loading scene: {}", name);
+    auto start = std::chrono::steady_clock::now();
+
+    // 1. Look for the scene matching the name
+    auto it = scenes.find(name);
+    if (it != scenes.end())
+    {
+        BaseScene* nextScene = it->second;
+
+        // Scenes prepared for a switch that did not happen no longer need to stay resident
+        unpinPrepared(nextScene);
+        if (preparingScene != name) pinPreparation = false;
+
+        auto resident = std::find_if(residentScenes.begin(), residentScenes.end(),
+            [nextScene](const ResidentScene& entry) { return entry.scene == nextScene; });
+
+        // If found:
+        // a. Suspend or deactivate currentScene, if there is one
+        if (currentScene)
+        {
+            if (currentScene != nextScene)
+            {
+                // Keep its objects aside, update() deactivates it if it does not fit the budget
+                currentScene->suspend();
+                ResidentScene entry;
+                entry.scene = currentScene;
+                entry.bytes = currentSceneBytes;
+                GameObjectCollection::swap(entry.objects);
+                residentScenes.push_front(std::move(entry));
+                SGE_LOG_INFO(SCENE_MANAGER, "Suspended scene: {}", currentScene->getName());
+            }
+            else
+            {
+                currentScene->deactivate();
+                SGE_LOG_INFO(SCENE_MANAGER, "Deactivated scene: {}", currentScene->getName());
+            }
+        }
+
+        // b. Dispose all currently active gameObjects, then the fonts only their text used.
+        GameObjectCollection::dispose();
+        FontCache::releaseUnusedFonts();
+
+        // c. Point currentScene to the new scene.
+        currentScene = nextScene;
+
+        // d. Initialize the new scene, unless it is resident, and activate it.
+        bool warm = resident != residentScenes.end();
+        if (warm)
+        {
+            GameObjectCollection::swap(resident->objects);
+            currentSceneBytes = resident->bytes;
+            residentScenes.erase(resident);
+        }
+        else
+        {
+            uint64_t before = getTrackedBytes();
+            currentScene->initialize();
+            uint64_t after = getTrackedBytes();
+            currentSceneBytes = after > before ? after - before : 0;
+        }
+        currentScene->activate();
+
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        SGE_LOG_INFO(SCENE_MANAGER, "Switched to scene '{}' in {} ms ({})", name, elapsedMs, warm ? "resident" : "initialized");
+    }
+    else
+    {
+        // Otherwise, log error
+        SGE_LOG_ERROR(SCENE_MANAGER, "Error: Scene '{}' not found.", name);
+    }
+}
+
+bool SceneStateMachine::prepareScene(const std::string& name)
+{
+    BaseScene* scene = findScene(name);
+    if (!scene)
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Error: Scene '{}' not found.", name);
+        return false;
+    }
+
+    // Already initialized, or on its way
+    if (scene->isInitialized() || preparingScene == name) return true;
+
+    if (!SceneLoader::begin(name)) return false;
+    preparingScene = name;
+    pinPreparation = true;
+
+    // Only the latest prepared scene is kept regardless of the budget
+    unpinPrepared(scene);
+    return true;
+}
+
+bool SceneStateMachine::isSceneReady(const std::string& name)
+{
+    BaseScene* scene = findScene(name);
+    return scene && scene != currentScene && scene->isInitialized();
+}
+
+void SceneStateMachine::setResidentBudget(uint64_t bytes)
+{
+    residentBudget = bytes;
+    enforceBudget();
+}
+
+uint64_t SceneStateMachine::getResidentBytes()
+{
+    uint64_t total = 0;
+    for (const ResidentScene& entry : residentScenes)
+    {
+        total += entry.bytes;
+    }
+    return total;
+}
+
+void SceneStateMachine::finishPreparation()
+{
+    BaseScene* scene = findScene(preparingScene);
+    std::string name = preparingScene;
+    preparingScene.clear();
+    if (!scene || scene->isInitialized())
+    {
+        SceneLoader::finish();
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Initialize into an empty collection, the current scene's objects are parked meanwhile
+    ResidentScene entry;
+    entry.scene = scene;
+    entry.pinned = pinPreparation;
+    GameObjectCollection::swap(entry.objects);
+
+    uint64_t before = getTrackedBytes();
+    scene->initialize();
+    uint64_t after = getTrackedBytes();
+    entry.bytes = after > before ? after - before : 0;
+
+    GameObjectCollection::swap(entry.objects);
+    uint64_t bytes = entry.bytes;
+
+    // Another scene was activated meanwhile, so this one is evicted first if over the budget
+    if (entry.pinned)
+    {
+        residentScenes.push_front(std::move(entry));
+    }
+    else
+    {
+        residentScenes.push_back(std::move(entry));
+    }
+
+    // The scene holds its own references now
+    SceneLoader::finish();
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    SGE_LOG_INFO(SCENE_MANAGER, "Prepared scene '{}' in {} ms, {} bytes", name, elapsedMs, bytes);
+}
+
+void SceneStateMachine::unpinPrepared(const BaseScene* keep)
+{
+    for (auto it = residentScenes.begin(); it != residentScenes.end();)
+    {
+        auto next = std::next(it);
+        if (it->pinned && it->scene != keep)
+        {
+            // Least recently used position, it was never shown
+            it->pinned = false;
+            residentScenes.splice(residentScenes.end(), residentScenes, it);
+            SGE_LOG_DEBUG(SCENE_MANAGER, "Prepared scene '{}' passed over, no longer pinned", it->scene->getName());
+        }
+        it = next;
+    }
+}
+
+void SceneStateMachine::enforceBudget()
+{
+    uint64_t total = getResidentBytes();
+    auto it = residentScenes.end();
+    while (total > residentBudget && it != residentScenes.begin())
+    {
+        auto candidate = std::prev(it);
+        if (candidate->pinned)
+        {
+            it = candidate;
+            continue;
+        }
+
+        total -= candidate->bytes;
+        unloadResident(candidate);
+    }
+}
+
+void SceneStateMachine::unloadResident(std::list<ResidentScene>::iterator it)
+{
+    // Swap the scene's objects in so deactivate() disposes them, not the current ones
+    GameObjectCollection::swap(it->objects);
+    it->scene->deactivate();
+    GameObjectCollection::swap(it->objects);
+
+    SGE_LOG_INFO(SCENE_MANAGER, "Deactivated resident scene: {}", it->scene->getName());
+    residentScenes.erase(it);
+}
+
+uint64_t SceneStateMachine::getTrackedBytes()
+{
+    return MemoryTracker::getTotalBytes(false) + MemoryTracker::getTotalBytes(true);
+}
+
+void SceneStateMachine::loadScene(const unsigned int index)
+{
+    SGE_LOG_INFO(SCENE_MANAGER, "Loading scene: {}", index);
+
+    // Ensure the index is valid
+    if (index < scenes.size())
+    {
+        auto it = std::next(scenes.begin(), index);
+        loadScene(it->first);
+    }
+    else
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Error: Invalid scene index.");
+    }
+}
+
+void SceneStateMachine::update(float deltaTime)
+{
+    SGE_PROFILE_SCOPE("SceneStateMachine::update");
+    updateCount++;
+
+    // Initialize a prepared scene once its assets are resident
+    if (!preparingScene.empty())
+    {
+        if (!SceneLoader::isLoading() || SceneLoader::getSceneName() != preparingScene)
+        {
+            // Another load replaced ours
+            preparingScene.clear();
+        }
+        else if (scriptedPreparation ? updateCount == scheduledPreparation : SceneLoader::isComplete())
+        {
+            // A replay finishes on the recorded update even if this machine loads slower
+            SceneLoader::waitUntilComplete();
+            finishPreparation();
+            preparedUpdate = updateCount;
+        }
+    }
+
+    // Scenes left behind are deactivated here rather than during the switch
+    enforceBudget();
+
+    // Update current scene if there is one.
+    if (currentScene)
+    {
+        currentScene->update(deltaTime);
+    }
+
+    // Tweens and animations started by the scene this frame advance with the others
+    TweenSystem::update(deltaTime);
+    SpriteAnimationSystem::update(deltaTime);
+}
+
+void SceneStateMachine::render()
+{
+    SGE_PROFILE_SCOPE("SceneStateMachine::render");
+
+    // Render current scene if there is one.
+    if (currentScene)
+    {
+        currentScene->render();
+    }
+}
+
+void SceneStateMachine::dispose()
+{
+    // Dispose all currently active gameObjects.
+    GameObjectCollection::dispose();
+
+    // Deactivate resident scenes so their objects are released too
+    while (!residentScenes.empty())
+    {
+        unloadResident(residentScenes.begin());
+    }
+    preparingScene.clear();
+    pinPreparation = false;
+    currentSceneBytes = 0;
+
+    // For each element in scenes
+    for (auto& scene : scenes)
+    {
+        SGE_LOG_INFO(SCENE_MANAGER, "Disposing scene: {}", scene.second->getName());
+        delete scene.second; // Clean up each scene
+    }
+    scenes.clear(); // Clear the collection
+
+    // Reset sceneIdCounter
+    sceneIdCounter = 0;
+
+    // Set currentScene to nullptr for safety.
+    currentScene = nullptr;
+
+    if (requestSubscription != 0)
+    {
+        EventBus::unsubscribe(requestSubscription);
+        requestSubscription = 0;
+    }
+}
+
+void SceneStateMachine::setScriptedPreparation(bool scripted)
+{
+    scriptedPreparation = scripted;
+    scheduledPreparation = 0;
+}
+
+void SceneStateMachine::requestScene(const std::string& name)
+{
+    if (requestSubscription == 0)
+    {
+        requestSubscription = EventBus::subscribeBatch<SceneRequest>(&SceneStateMachine::onSceneRequests);
+    }
+    EventBus::publish(SceneRequest{ name });
+}
+
+void SceneStateMachine::onSceneRequests(const SceneRequest* requests, size_t count)
+{
+    if (count > 1)
+    {
+        SGE_LOG_DEBUG(SCENE_MANAGER, "{} scene requests in one frame, loading the last: {}", count, requests[count - 1].name);
+    }
+    loadScene(requests[count - 1].name);
+}
+
+BaseScene* SceneStateMachine::getCurrentScene()
+{
+	return currentScene;
+}
+
+BaseScene* SceneStateMachine::findScene(const std::string& name)
+{
+    auto it = scenes.find(name);
+    return it != scenes.end() ? it->second : nullptr;
+}
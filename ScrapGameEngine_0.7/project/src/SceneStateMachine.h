@@ -1,113 +1,286 @@
-#pragma once
-#include "BaseScene.h"
-#include <unordered_map>
-#include <iostream>
-
-namespace ScrapGameEngine
-{
-    /**
-     * @class SceneStateMachine
-     * @brief Manages scenes within the game engine, enabling the addition, loading, and management of scenes.
-     *
-     * The SceneStateMachine is a static class that provides functionality for handling game scenes.
-     * It supports adding new scenes, loading scenes by name or index, and accessing the current scene.
-     */
-    class SceneStateMachine
-    {
-    public:
-        /**
-         * @brief Deleted default constructor to prevent instantiation of the SceneStateMachine class.
-         */
-        SceneStateMachine() = delete;
-
-        /**
-         * @brief Adds a new scene to the scene manager.
-         *
-         * This function is a template and only allows types derived from BaseScene.
-         * If a scene with the same name already exists, the function fails.
-         *
-         * @tparam T The type of the scene to add (must inherit from BaseScene).
-         * @return A pointer to the newly added scene if successful; otherwise, nullptr.
-         */
-        template<typename T, typename = typename std::enable_if<std::is_base_of<BaseScene, T>::value>::type>
-        static T* addScene() {
-            T* newScene = new T();
-
-            auto pair = std::make_pair(newScene->getName(), newScene);
-
-            std::pair < std::unordered_map<std::string, BaseScene*>::iterator, bool > result = scenes.insert(pair);
-
-            // if successfully adding the new pair
-            if (result.second) {
-                std::cout << "Scene '" << newScene->getName() << "' added successfully with ID: " << sceneIdCounter << std::endl;
-
-                // For challenge (see below)
-                unsigned int currentId = sceneIdCounter;
-                sceneIdCounter++;
-
-                return newScene;
-            }
-            else {
-                std::cout << "Failed to add scene '" << newScene->getName() << "': Scene already exists." << std::endl;
-                delete newScene;
-                return nullptr;
-            }
-        }
-
-        /**
-         * @brief Loads a scene by its name.
-         *
-         * @param name The name of the scene to load.
-         */
-        static void loadScene(const std::string name);
-
-        /**
-         * @brief Loads a scene by its index in the scene manager.
-         *
-         * The index is 0-based and corresponds to the order in which scenes are added.
-         *
-         * @param index The index of the scene to load.
-         */
-        static void loadScene(const unsigned int index);
-
-        /**
-         * @brief Retrieves the current active scene.
-         *
-         * @return A pointer to the current active BaseScene.
-         */
-        static BaseScene* getCurrentScene();
-
-    private:
-        /**
-         * @brief Updates the current scene.
-         *
-         * This function is called internally by the engine to update the active scene each frame.
-         *
-         * @param deltaTime The time elapsed since the last frame.
-         */
-        static void update(float deltaTime);
-
-        /**
-         * @brief Renders the current scene.
-         *
-         * This function is called internally by the engine to render the active scene each frame.
-         */
-        static void render();
-
-        /**
-         * @brief Disposes of all scenes and cleans up memory.
-         *
-         * This function is called during engine shutdown to ensure all resources are released.
-         */
-        static void dispose();
-
-        static std::unordered_map<std::string, BaseScene*> scenes; /**< Map of scene names to their respective BaseScene instances. */
-        static BaseScene* currentScene; /**< Pointer to the currently active scene. */
-        static unsigned int sceneIdCounter; /**< Counter for assigning unique IDs to scenes. */
-
-        /**
-         * @brief Grants the Application class access to private members and methods.
-         */
-        friend class Application;
-    };
-}
+#pragma once
+#include "BaseScene.h"
+#include "GameObjectCollection.h"
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include "Log.h"
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct SceneRequest
+     * @brief Event asking the SceneStateMachine to load a scene, published by requestScene().
+     */
+    struct SceneRequest
+    {
+        std::string name; /**< The name of the scene to load. */
+    };
+
+    /**
+     * @class SceneStateMachine
+     * @brief Manages scenes within the game engine, enabling the addition, loading, and management of scenes.
+     *
+     * The SceneStateMachine is a static class that provides functionality for handling game scenes.
+     * It supports adding new scenes, loading scenes by name or index, and accessing the current scene.
+     *
+     * A scene can be prepared ahead of time with prepareScene(): its assets are preloaded by the
+     * `SceneLoader` and it is initialized while another scene is current, with its objects kept
+     * apart from the current ones. Switching to a prepared scene then only swaps the object
+     * collections. Scenes that are left are suspended and stay resident while their combined
+     * footprint fits the resident budget, so switching back to them is just as cheap. The least
+     * recently used ones over the budget are deactivated on the next update, never during the switch.
+     * A prepared scene is exempt from the budget until another scene is prepared or activated.
+     */
+    class SceneStateMachine
+    {
+    public:
+        /**
+         * @brief Deleted default constructor to prevent instantiation of the SceneStateMachine class.
+         */
+        SceneStateMachine() = delete;
+
+        /**
+         * @brief Adds a new scene to the scene manager.
+         *
+         * This function is a template and only allows types derived from BaseScene.
+         * If a scene with the same name already exists, the function fails.
+         *
+         * @tparam T The type of the scene to add (must inherit from BaseScene).
+         * @return A pointer to the newly added scene if successful; otherwise, nullptr.
+         */
+        template<typename T, typename = typename std::enable_if<std::is_base_of<BaseScene, T>::value>::type>
+        static T* addScene() {
+            T* newScene = new T();
+
+            auto pair = std::make_pair(newScene->getName(), newScene);
+
+            std::pair < std::unordered_map<std::string, BaseScene*>::iterator, bool > result = scenes.insert(pair);
+
+            // if successfully adding the new pair
+            if (result.second) {
+                SGE_LOG_DEBUG(SCENE_MANAGER, "Scene '{}' added successfully with ID: {}", newScene->getName(), sceneIdCounter);
+
+                // For challenge (see below)
+                unsigned int currentId = sceneIdCounter;
+                sceneIdCounter++;
+
+                return newScene;
+            }
+            else {
+                SGE_LOG_ERROR(SCENE_MANAGER, "Failed to add scene '{}': Scene already exists.", newScene->getName());
+                delete newScene;
+                return nullptr;
+            }
+        }
+
+        /**
+         * @brief Loads a scene by its name.
+         *
+         * @param name The name of the scene to load.
+         */
+        static void loadScene(const std::string name);
+
+        /**
+         * @brief Loads a scene at the next `EventBus` dispatch, after the scene updates of this frame.
+         *
+         * Use this from scene updates and callbacks instead of loadScene(), so the current scene is
+         * not swapped out while its own code is running. When several scenes are requested before
+         * a dispatch, the last request wins.
+         *
+         * @param name The name of the scene to load.
+         */
+        static void requestScene(const std::string& name);
+
+        /**
+         * @brief Starts preparing a scene in the background, so loadScene() does not have to initialize it.
+         *
+         * The scene's declared assets are preloaded over the next frames and the scene is initialized,
+         * but not activated, once they are resident. Preparing a scene that is already initialized does nothing.
+         * A scene prepared earlier and not activated loses its exemption from the resident budget.
+         *
+         * @param name The name of the scene to prepare.
+         * @return False if the scene does not exist.
+         */
+        static bool prepareScene(const std::string& name);
+
+        /**
+         * @brief Checks whether a scene is initialized and waiting to be activated.
+         *
+         * @param name The name of the scene.
+         * @return True if loadScene() would only swap the scene in.
+         */
+        static bool isSceneReady(const std::string& name);
+
+        /**
+         * @brief Sets how much memory scenes that are not current may keep.
+         *
+         * The footprint of a scene is the memory tracked while it initialized, textures shared
+         * with other scenes are counted by the scene that loaded them first.
+         *
+         * @param bytes The budget in bytes. 0, the default, deactivates every scene on the update after it is left.
+         */
+        static void setResidentBudget(uint64_t bytes);
+
+        /**
+         * @brief Gets the combined footprint of the scenes kept resident.
+         *
+         * @return The size in bytes, not including the current scene.
+         */
+        static uint64_t getResidentBytes();
+
+        /**
+         * @brief Loads a scene by its index in the scene manager.
+         *
+         * The index is 0-based and corresponds to the order in which scenes are added.
+         *
+         * @param index The index of the scene to load.
+         */
+        static void loadScene(const unsigned int index);
+
+        /**
+         * @brief Retrieves the current active scene.
+         *
+         * @return A pointer to the current active BaseScene.
+         */
+        static BaseScene* getCurrentScene();
+
+        /**
+         * @brief Finds a scene without loading it.
+         *
+         * @param name The name of the scene.
+         * @return A pointer to the scene, or nullptr if no scene has that name.
+         */
+        static BaseScene* findScene(const std::string& name);
+
+    private:
+        /**
+         * @brief Updates the current scene.
+         *
+         * This function is called internally by the engine to update the active scene each frame.
+         *
+         * @param deltaTime The time elapsed since the last frame.
+         */
+        static void update(float deltaTime);
+
+        /**
+         * @brief Renders the current scene.
+         *
+         * This function is called internally by the engine to render the active scene each frame.
+         */
+        static void render();
+
+        /**
+         * @brief Disposes of all scenes and cleans up memory.
+         *
+         * This function is called during engine shutdown to ensure all resources are released.
+         */
+        static void dispose();
+
+        /**
+         * @brief Gets the number of update() calls so far, so a frame can tell which of its updates is which.
+         *
+         * @return The update count.
+         */
+        static uint64_t getUpdateCount() { return updateCount; }
+
+        /**
+         * @brief Gets the update that last finished preparing a scene.
+         *
+         * @return The value getUpdateCount() had after that update, 0 if none did.
+         */
+        static uint64_t getPreparedUpdate() { return preparedUpdate; }
+
+        /**
+         * @brief Lets a replay decide when prepared scenes are initialized, instead of the loader's progress.
+         *
+         * How many frames a preload takes depends on the disk and the worker threads, so a replay
+         * finishes each preparation on the update the recording did, waiting for the assets if needed.
+         *
+         * @param scripted True to finish preparations only on the update set by schedulePreparation().
+         */
+        static void setScriptedPreparation(bool scripted);
+
+        /**
+         * @brief Sets the update that finishes the scene being prepared, while preparation is scripted.
+         *
+         * @param update The value getUpdateCount() will have after that update, 0 for none.
+         */
+        static void schedulePreparation(uint64_t update) { scheduledPreparation = update; }
+
+        /**
+         * @struct ResidentScene
+         * @brief An initialized scene that is not current.
+         */
+        struct ResidentScene
+        {
+            BaseScene* scene = nullptr;             /**< The scene. */
+            GameObjectCollection::Storage objects;  /**< Its objects, swapped in when it becomes current. */
+            uint64_t bytes = 0;                     /**< Memory tracked while it initialized. */
+            bool pinned = false;                    /**< Prepared and not yet passed over, never evicted. */
+        };
+
+        /**
+         * @brief Initializes the scene being prepared once its assets are resident.
+         */
+        static void finishPreparation();
+
+        /**
+         * @brief Unpins prepared scenes that were passed over, making them the first to be evicted.
+         *
+         * @param keep The scene being prepared or activated, left as it is.
+         */
+        static void unpinPrepared(const BaseScene* keep);
+
+        /**
+         * @brief Deactivates resident scenes, least recently used first, until they fit the budget.
+         */
+        static void enforceBudget();
+
+        /**
+         * @brief Deactivates a resident scene and drops it from the list.
+         *
+         * @param it The scene's entry.
+         */
+        static void unloadResident(std::list<ResidentScene>::iterator it);
+
+        /**
+         * @brief Gets the memory tracked on the CPU and the GPU.
+         *
+         * @return The total in bytes.
+         */
+        static uint64_t getTrackedBytes();
+
+        /**
+         * @brief Loads the last scene of a batch of requests.
+         *
+         * @param requests The requests published since the last dispatch.
+         * @param count The number of requests.
+         */
+        static void onSceneRequests(const SceneRequest* requests, size_t count);
+
+        static std::unordered_map<std::string, BaseScene*> scenes; /**< Map of scene names to their respective BaseScene instances. */
+        static BaseScene* currentScene; /**< Pointer to the currently active scene. */
+        static unsigned int sceneIdCounter; /**< Counter for assigning unique IDs to scenes. */
+        static std::list<ResidentScene> residentScenes; /**< Initialized scenes other than the current one, most recently used first. */
+        static std::string preparingScene; /**< The scene whose assets are being preloaded, empty if none. */
+        static bool pinPreparation; /**< Pin the scene being prepared once initialized, cleared when another scene is activated meanwhile. */
+        static uint64_t currentSceneBytes; /**< Footprint of the current scene. */
+        static uint64_t residentBudget; /**< Memory resident scenes may keep, 0 to keep none. */
+        static uint64_t requestSubscription; /**< EventBus subscription receiving the scene requests, 0 until the first one. */
+        static uint64_t updateCount; /**< Number of update() calls. */
+        static uint64_t preparedUpdate; /**< Update that last finished a preparation, 0 if none did. */
+        static bool scriptedPreparation; /**< Preparations finish on `scheduledPreparation`, not when the loader completes. */
+        static uint64_t scheduledPreparation; /**< Update that finishes the preparation while scripted, 0 for none. */
+
+        /**
+         * @brief Grants the Application class access to private members and methods.
+         */
+        friend class Application;
+
+        /**
+         * @brief Grants the benchmarks' frame driver the same access, so they run scenes without a window.
+         */
+        friend class SceneFrameDriver;
+    };
+}
@@ -0,0 +1,140 @@
+#include "SceneWriter.h"
+#include "SceneRecords.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+using namespace ScrapGameEngine;
+
+uint32_t SceneWriter::addObject(const std::string& name, const glm::vec2& position, float rotation, const glm::vec2& scale, int32_t parent)
+{
+    SceneObjectRecord record{};
+    record.name = addString(name);
+    record.parent = parent;
+    record.position[0] = position.x;
+    record.position[1] = position.y;
+    record.rotation = rotation;
+    record.scale[0] = scale.x;
+    record.scale[1] = scale.y;
+
+    objects.push_back(record);
+    return static_cast<uint32_t>(objects.size() - 1);
+}
+
+SceneSpriteRecord& SceneWriter::addSprite(uint32_t object, const std::string& texturePath, const TextureConfig& cfg)
+{
+    int32_t texture = texturePath.empty() ? -1 : addAsset(AssetType::TEXTURE, texturePath, cfg);
+    sprites.push_back(SceneRecords::makeSprite(object, texture));
+    return sprites.back();
+}
+
+SceneButtonRecord& SceneWriter::addButton(uint32_t object)
+{
+    buttons.push_back(SceneRecords::makeButton(object));
+    return buttons.back();
+}
+
+SceneAudioRecord& SceneWriter::addAudio(uint32_t object, const std::string& clipPath)
+{
+    int32_t clip = clipPath.empty() ? -1 : addAsset(AssetType::AUDIO, clipPath, TextureConfig{});
+    audio.push_back(SceneRecords::makeAudio(object, clip));
+    return audio.back();
+}
+
+SceneTweenRecord& SceneWriter::addTween(uint32_t object)
+{
+    tweens.push_back(SceneRecords::makeTween(object));
+    return tweens.back();
+}
+
+// Writes a whole section in one call
+template <typename Record>
+static void writeRecords(std::ofstream& file, const std::vector<Record>& records)
+{
+    if (!records.empty())
+    {
+        file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+    }
+}
+
+// Orders records by object and checks they point at one
+template <typename Record>
+static bool sortByObject(std::vector<Record>& records, size_t objectCount)
+{
+    std::stable_sort(records.begin(), records.end(),
+        [](const Record& a, const Record& b) { return a.object < b.object; });
+    return records.empty() || records.back().object < objectCount;
+}
+
+bool SceneWriter::write(const std::string& path)
+{
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        // Parents come first, so the loader links them in one pass and cycles cannot exist
+        if (objects[i].parent >= static_cast<int32_t>(i))
+        {
+            SGE_LOG_ERROR(SCENE_MANAGER, "Cannot write scene {}: Object {} has parent {}, which is not an earlier object.", path, i, objects[i].parent);
+            return false;
+        }
+    }
+
+    if (!sortByObject(sprites, objects.size()) || !sortByObject(buttons, objects.size()) ||
+        !sortByObject(audio, objects.size()) || !sortByObject(tweens, objects.size()))
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Cannot write scene {}: A component refers to a missing object.", path);
+        return false;
+    }
+
+    SceneFileHeader header{};
+    std::memcpy(header.magic, "SGES", 4);
+    header.version = SCENE_FORMAT_VERSION;
+    header.objectCount = static_cast<uint32_t>(objects.size());
+    header.spriteCount = static_cast<uint32_t>(sprites.size());
+    header.buttonCount = static_cast<uint32_t>(buttons.size());
+    header.audioCount = static_cast<uint32_t>(audio.size());
+    header.tweenCount = static_cast<uint32_t>(tweens.size());
+    header.assetCount = static_cast<uint32_t>(assets.size());
+    header.stringBytes = static_cast<uint32_t>(strings.size());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        SGE_LOG_ERROR(SCENE_MANAGER, "Cannot write scene {}: File could not be opened.", path);
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeRecords(file, objects);
+    writeRecords(file, sprites);
+    writeRecords(file, buttons);
+    writeRecords(file, audio);
+    writeRecords(file, tweens);
+    writeRecords(file, assets);
+    writeRecords(file, strings);
+    return static_cast<bool>(file);
+}
+
+uint32_t SceneWriter::addString(const std::string& value)
+{
+    auto it = stringOffsets.find(value);
+    if (it != stringOffsets.end()) return it->second;
+
+    uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings.insert(strings.end(), value.begin(), value.end());
+    strings.push_back('\0');
+
+    stringOffsets.emplace(value, offset);
+    return offset;
+}
+
+int32_t SceneWriter::addAsset(AssetType type, const std::string& path, const TextureConfig& cfg)
+{
+    auto it = assetIndices.find(path);
+    if (it != assetIndices.end()) return it->second;
+
+    int32_t index = static_cast<int32_t>(assets.size());
+    assets.push_back(SceneRecords::makeAsset(type, addString(path), cfg));
+    assetIndices.emplace(path, index);
+    return index;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "SceneFormat.h"
+#include "SceneManifest.h"
+#include <glm/vec2.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class SceneWriter
+     * @brief Builds a binary scene and writes it as a `.sgescene` file for `SceneFile`.
+     *
+     * Objects are added first; components refer to them by the index addObject() returns.
+     * The add functions return the new record filled with the components' defaults, so
+     * only the values that differ need to be set; the reference is valid until the next add
+     * of the same component. Asset paths and names are stored once.
+     */
+    class SceneWriter
+    {
+    public:
+        /**
+         * @brief Adds a GameObject.
+         * @param name The name of the object.
+         * @param position The local position.
+         * @param rotation The local rotation in degrees.
+         * @param scale The local scale.
+         * @param parent The index of an object added earlier, or -1.
+         * @return The index of the object.
+         */
+        uint32_t addObject(const std::string& name, const glm::vec2& position = glm::vec2(0.0f), float rotation = 0.0f,
+            const glm::vec2& scale = glm::vec2(1.0f), int32_t parent = -1);
+
+        /**
+         * @brief Adds a SpriteRenderer.
+         * @param object The owning object.
+         * @param texturePath The texture, empty for none.
+         * @param cfg The texture configuration. The first one given for a path is kept.
+         * @return The record, with white color, full opacity, unit size and a centered pivot.
+         */
+        SceneSpriteRecord& addSprite(uint32_t object, const std::string& texturePath, const TextureConfig& cfg);
+
+        /**
+         * @brief Adds a Button.
+         * @param object The owning object.
+         * @return The record, with unit size, white color, grey hover color and full opacity.
+         */
+        SceneButtonRecord& addButton(uint32_t object);
+
+        /**
+         * @brief Adds an AudioSource.
+         * @param object The owning object.
+         * @param clipPath The audio file, empty for none.
+         * @return The record, at full volume without looping.
+         */
+        SceneAudioRecord& addAudio(uint32_t object, const std::string& clipPath);
+
+        /**
+         * @brief Adds a TweenComponent.
+         * @param object The owning object.
+         * @return The record, with no tween started.
+         */
+        SceneTweenRecord& addTween(uint32_t object);
+
+        /**
+         * @brief Gets the number of objects added.
+         * @return The object count.
+         */
+        size_t getObjectCount() const { return objects.size(); }
+
+        /**
+         * @brief Writes the scene. Component records are sorted by object first.
+         * @param path The file path, normally ending in `SCENE_FILE_EXTENSION`.
+         * @return False if a record is invalid or the file could not be written.
+         */
+        bool write(const std::string& path);
+
+    private:
+        /**
+         * @brief Adds a string to the string table once.
+         * @param value The string.
+         * @return Its offset.
+         */
+        uint32_t addString(const std::string& value);
+
+        /**
+         * @brief Adds an asset once.
+         * @param type The asset type.
+         * @param path The file path.
+         * @param cfg The texture configuration, ignored for other types.
+         * @return Its index.
+         */
+        int32_t addAsset(AssetType type, const std::string& path, const TextureConfig& cfg);
+
+        std::vector<SceneObjectRecord> objects;         /**< Object records. */
+        std::vector<SceneSpriteRecord> sprites;         /**< Sprite records. */
+        std::vector<SceneButtonRecord> buttons;         /**< Button records. */
+        std::vector<SceneAudioRecord> audio;            /**< Audio records. */
+        std::vector<SceneTweenRecord> tweens;           /**< Tween records. */
+        std::vector<SceneAssetRecord> assets;           /**< Asset records. */
+        std::vector<char> strings;                      /**< String table. */
+        std::unordered_map<std::string, uint32_t> stringOffsets;   /**< String to offset. */
+        std::unordered_map<std::string, int32_t> assetIndices;     /**< Path to asset index. */
+    };
+}
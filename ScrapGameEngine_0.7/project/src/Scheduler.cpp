@@ -1,62 +1,107 @@
-#include "Scheduler.h"
-#include <iostream> 
-
-namespace ScrapGameEngine
-{
-    // Static variables
-    std::vector<std::pair<std::function<void()>, float>> Scheduler::delayedTasks;
-    std::vector<std::function<bool()>> Scheduler::repeatingTasks;
-
-    void Scheduler::addDelayedTask(std::function<void()> task, float delay)
-    {
-        delayedTasks.emplace_back(task, delay);
-
-        std::cout << "[SCHEDULER] Added new Delayed Task: " << delay << " seconds." << std::endl;
-    }
-
-    void Scheduler::addRepeatingTask(std::function<bool()> task)
-    {
-        repeatingTasks.push_back(task);
-
-        std::cout << "[SCHEDULER] Added new Repeating Task." << std::endl;
-    }
-
-    void Scheduler::update(float deltaTime)
-    {
-        // Handle delayed tasks
-        for (auto it = delayedTasks.begin(); it != delayedTasks.end();)
-        {
-            it->second -= deltaTime; // Reduce the delay time
-            if (it->second <= 0.0f)
-            {
-                it->first(); // Execute the task
-                it = delayedTasks.erase(it); // Remove the task
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        // Handle repeating tasks
-        for (auto it = repeatingTasks.begin(); it != repeatingTasks.end();)
-        {
-            if ((*it)()) // If the task returns true, stop repeating
-            {
-                it = repeatingTasks.erase(it); // Remove the task
-            }
-            else
-            {
-                ++it;
-            }
-        }
-    }
-
-    void Scheduler::dispose()
-    {  
-        // Clear all tasks
-        delayedTasks.clear();
-        repeatingTasks.clear();
-        std::cout << "[SCHEDULER] Disposed all tasks." << std::endl;
-    }
-}
+#include "Scheduler.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+
+namespace ScrapGameEngine
+{
+    // Static variables
+    std::vector<Scheduler::DelayedTask> Scheduler::delayedTasks;
+    std::vector<Scheduler::RepeatingTask> Scheduler::repeatingTasks;
+    uint64_t Scheduler::lastTaskId = 0;
+
+    uint64_t Scheduler::addDelayedTask(std::function<void()> task, float delay)
+    {
+        SGE_PROFILE_SCOPE("Scheduler::addDelayedTask");
+
+        uint64_t id = ++lastTaskId;
+        delayedTasks.push_back({ id, std::move(task), delay });
+
+        SGE_LOG_DEBUG(SCHEDULER, "Added new Delayed Task {}: {} seconds.", id, delay);
+        return id;
+    }
+
+    uint64_t Scheduler::addRepeatingTask(std::function<bool()> task)
+    {
+        uint64_t id = ++lastTaskId;
+        repeatingTasks.push_back({ id, std::move(task) });
+
+        SGE_LOG_DEBUG(SCHEDULER, "Added new Repeating Task {}.", id);
+        return id;
+    }
+
+    bool Scheduler::cancel(uint64_t id)
+    {
+        // Emptied rather than erased, update() may be iterating the list
+        for (DelayedTask& entry : delayedTasks)
+        {
+            if (entry.id == id && entry.task)
+            {
+                entry.task = nullptr;
+                SGE_LOG_DEBUG(SCHEDULER, "Cancelled Delayed Task {}.", id);
+                return true;
+            }
+        }
+        for (RepeatingTask& entry : repeatingTasks)
+        {
+            if (entry.id == id && entry.task)
+            {
+                entry.task = nullptr;
+                SGE_LOG_DEBUG(SCHEDULER, "Cancelled Repeating Task {}.", id);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Scheduler::update(float deltaTime)
+    {
+        SGE_PROFILE_SCOPE("Scheduler::update");
+
+        // Indices, not iterators: a task may add or cancel tasks while it runs.
+        // Tasks added meanwhile are first considered on the next update.
+
+        // Handle delayed tasks
+        size_t delayedCount = delayedTasks.size();
+        for (size_t i = 0; i < delayedCount; ++i)
+        {
+            if (!delayedTasks[i].task) continue;
+
+            delayedTasks[i].delay -= deltaTime; // Reduce the delay time
+            if (delayedTasks[i].delay <= 0.0f)
+            {
+                std::function<void()> task = std::move(delayedTasks[i].task);
+                delayedTasks[i].task = nullptr; // Done, removed below
+                task(); // Execute the task
+            }
+        }
+
+        // Handle repeating tasks
+        size_t repeatingCount = repeatingTasks.size();
+        for (size_t i = 0; i < repeatingCount; ++i)
+        {
+            if (!repeatingTasks[i].task) continue;
+
+            // Copied, the task may cancel itself or grow the list while it runs
+            std::function<bool()> task = repeatingTasks[i].task;
+            if (task() && repeatingTasks[i].task) // If the task returns true, stop repeating
+            {
+                repeatingTasks[i].task = nullptr;
+            }
+        }
+
+        // Remove finished and cancelled tasks
+        delayedTasks.erase(std::remove_if(delayedTasks.begin(), delayedTasks.end(),
+            [](const DelayedTask& entry) { return !entry.task; }), delayedTasks.end());
+        repeatingTasks.erase(std::remove_if(repeatingTasks.begin(), repeatingTasks.end(),
+            [](const RepeatingTask& entry) { return !entry.task; }), repeatingTasks.end());
+    }
+
+    void Scheduler::dispose()
+    {  
+        // Clear all tasks
+        delayedTasks.clear();
+        repeatingTasks.clear();
+        SGE_LOG_DEBUG(SCHEDULER, "Disposed all tasks.");
+    }
+}
@@ -1,51 +1,84 @@
-#pragma once
-#include <functional>
-#include <vector>
-#include <utility> 
-
-namespace ScrapGameEngine
-{
-    /**
-     * @class Scheduler
-     * @brief A task scheduler that manages delayed and repeating tasks.
-     *
-     * The Scheduler allows you to register tasks to run after a specified delay or repeatedly.
-     * It provides methods to update the state of the scheduler by advancing the time and executing due tasks.
-     */
-    class Scheduler
-    {
-    public:
-        /**
-         * @brief Register a task to run after a specified delay.
-         *
-         * @param task The task function to be executed.
-         * @param delay The time (in seconds) after which the task should run.
-         */
-        static void addDelayedTask(std::function<void()> task, float delay);
-
-        /**
-         * @brief Register a repeating task.
-         *
-         * The task function should return `true` to stop the task or `false` to continue repeating.
-         *
-         * @param task The task function to be executed.
-         */
-        static void addRepeatingTask(std::function<bool()> task);
-
-        /**
-         * @brief Update the scheduler (call this every frame) to check for due tasks.
-         *
-         * @param deltaTime The time (in seconds) since the last frame.
-         */
-        static void update(float deltaTime);
-
-        /**
-         * @brief Clean up resources (clear all tasks).
-         */
-        static void dispose();
-
-    private:
-        static std::vector<std::pair<std::function<void()>, float>> delayedTasks; ///< List of delayed tasks with their execution time
-        static std::vector<std::function<bool()>> repeatingTasks; ///< List of repeating tasks with their stop condition
-    };
-}
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <utility> 
+
+namespace ScrapGameEngine
+{
+    /**
+     * @class Scheduler
+     * @brief A task scheduler that manages delayed and repeating tasks.
+     *
+     * The Scheduler allows you to register tasks to run after a specified delay or repeatedly.
+     * It provides methods to update the state of the scheduler by advancing the time and executing due tasks.
+     * Every task gets an ID, so whoever captured state in it can cancel it before that state goes away.
+     */
+    class Scheduler
+    {
+    public:
+        /**
+         * @brief Register a task to run after a specified delay.
+         *
+         * @param task The task function to be executed.
+         * @param delay The time (in seconds) after which the task should run.
+         * @return The task ID, never 0.
+         */
+        static uint64_t addDelayedTask(std::function<void()> task, float delay);
+
+        /**
+         * @brief Register a repeating task.
+         *
+         * The task function should return `true` to stop the task or `false` to continue repeating.
+         *
+         * @param task The task function to be executed.
+         * @return The task ID, never 0.
+         */
+        static uint64_t addRepeatingTask(std::function<bool()> task);
+
+        /**
+         * @brief Removes a task before it runs again. Safe to call from a running task.
+         * @param id The task ID.
+         * @return False if the task already finished or was cancelled.
+         */
+        static bool cancel(uint64_t id);
+
+        /**
+         * @brief Update the scheduler (call this every frame) to check for due tasks.
+         *
+         * @param deltaTime The time (in seconds) since the last frame.
+         */
+        static void update(float deltaTime);
+
+        /**
+         * @brief Clean up resources (clear all tasks).
+         */
+        static void dispose();
+
+    private:
+        /**
+         * @struct DelayedTask
+         * @brief A task waiting for its delay to run out.
+         */
+        struct DelayedTask
+        {
+            uint64_t id;                    /**< Task ID. */
+            std::function<void()> task;     /**< The task, empty once cancelled. */
+            float delay;                    /**< Seconds left before it runs. */
+        };
+
+        /**
+         * @struct RepeatingTask
+         * @brief A task run every update until it returns true.
+         */
+        struct RepeatingTask
+        {
+            uint64_t id;                    /**< Task ID. */
+            std::function<bool()> task;     /**< The task, empty once cancelled. */
+        };
+
+        static std::vector<DelayedTask> delayedTasks; ///< List of delayed tasks with their execution time
+        static std::vector<RepeatingTask> repeatingTasks; ///< List of repeating tasks with their stop condition
+        static uint64_t lastTaskId; ///< Last task ID handed out.
+    };
+}
@@ -0,0 +1,243 @@
+#include "SpriteAnimationSystem.h"
+#include "SpriteRenderer.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace ScrapGameEngine;
+
+std::vector<SpriteAnimator*> SpriteAnimationSystem::animators;
+std::vector<SpriteRenderer*> SpriteAnimationSystem::sprites;
+std::vector<const AnimationClip*> SpriteAnimationSystem::clips;
+std::vector<float> SpriteAnimationSystem::frameTimes;
+std::vector<float> SpriteAnimationSystem::frameDurations;
+std::vector<float> SpriteAnimationSystem::rates;
+std::vector<uint32_t> SpriteAnimationSystem::frames;
+std::vector<int8_t> SpriteAnimationSystem::directions;
+std::vector<uint32_t> SpriteAnimationSystem::due;
+std::vector<std::pair<SpriteAnimator*, const AnimationEvent*>> SpriteAnimationSystem::raised;
+std::vector<uint32_t> SpriteAnimationSystem::finished;
+std::vector<std::pair<std::function<void(const std::string&)>, const std::string*>> SpriteAnimationSystem::eventCalls;
+std::vector<std::function<void()>> SpriteAnimationSystem::completionCalls;
+
+void SpriteAnimationSystem::update(float deltaTime)
+{
+    if (animators.empty() && raised.empty())
+    {
+        return;
+    }
+
+    SGE_PROFILE_SCOPE("SpriteAnimationSystem::update");
+
+    const size_t count = animators.size();
+    float* times = frameTimes.data();
+    const float* durations = frameDurations.data();
+    const float* speeds = rates.data();
+
+    // Kept apart from the frame changes so the compiler can vectorize it
+    for (size_t i = 0; i < count; ++i)
+    {
+        times[i] += deltaTime * speeds[i];
+    }
+
+    due.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (times[i] >= durations[i])
+        {
+            due.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    finished.clear();
+    for (uint32_t index : due)
+    {
+        bool done = false;
+        advance(index, done);
+        if (done)
+        {
+            finished.push_back(index);
+        }
+    }
+
+    // Take the callbacks before running any, a callback may destroy other animators
+    eventCalls.clear();
+    for (const auto& event : raised)
+    {
+        if (event.first->eventCallback)
+        {
+            eventCalls.emplace_back(event.first->eventCallback, &event.second->name);
+        }
+    }
+    raised.clear();
+
+    // Finished animators leave after their last events were taken
+    completionCalls.clear();
+    for (auto it = finished.rbegin(); it != finished.rend(); ++it)
+    {
+        SpriteAnimator* animator = animators[*it];
+        if (animator->onComplete)
+        {
+            completionCalls.push_back(animator->onComplete);
+        }
+        remove(animator);
+    }
+
+    for (auto& event : eventCalls)
+    {
+        event.first(*event.second);
+    }
+    for (auto& completion : completionCalls)
+    {
+        completion();
+    }
+
+    // Drop what the callbacks captured, the capacity stays for the next update
+    eventCalls.clear();
+    completionCalls.clear();
+}
+
+void SpriteAnimationSystem::advance(uint32_t index, bool& finished)
+{
+    const AnimationClip* clip = clips[index];
+    const uint32_t count = clip->getFrameCount();
+    float time = frameTimes[index];
+    uint32_t frame = frames[index];
+    int8_t direction = directions[index];
+
+    // After a long stall skip whole passes instead of stepping through them, their events are dropped
+    if (clip->loopMode != AnimationLoopMode::ONCE && time >= clip->duration)
+    {
+        time = std::fmod(time, clip->duration);
+    }
+
+    while (time >= clip->frameDurations[frame])
+    {
+        time -= clip->frameDurations[frame];
+
+        if (clip->loopMode == AnimationLoopMode::LOOP)
+        {
+            frame = frame + 1 < count ? frame + 1 : 0;
+        }
+        else if (clip->loopMode == AnimationLoopMode::ONCE)
+        {
+            if (frame + 1 >= count)
+            {
+                finished = true;
+                time = 0.0f;
+                break;
+            }
+            ++frame;
+        }
+        else if (count > 1)
+        {
+            if ((direction > 0 && frame + 1 >= count) || (direction < 0 && frame == 0))
+            {
+                direction = -direction;
+            }
+            frame += direction;
+        }
+
+        if (clip->frameEvents[frame])
+        {
+            raise(animators[index], clip, frame);
+        }
+    }
+
+    frameTimes[index] = time;
+    frames[index] = frame;
+    directions[index] = direction;
+    frameDurations[index] = clip->frameDurations[frame];
+    sprites[index]->_uvRect = clip->frames[frame];
+}
+
+void SpriteAnimationSystem::raise(SpriteAnimator* animator, const AnimationClip* clip, uint32_t frame)
+{
+    for (const AnimationEvent& event : clip->events)
+    {
+        if (event.frame == frame)
+        {
+            raised.emplace_back(animator, &event);
+        }
+    }
+}
+
+void SpriteAnimationSystem::add(SpriteAnimator* animator, SpriteRenderer* sprite, const AnimationClip* clip)
+{
+    animator->slot = static_cast<uint32_t>(animators.size());
+
+    animators.push_back(animator);
+    sprites.push_back(sprite);
+    clips.push_back(clip);
+    frameTimes.push_back(0.0f);
+    frameDurations.push_back(clip->frameDurations[0]);
+    rates.push_back(animator->paused ? 0.0f : animator->speed);
+    frames.push_back(0);
+    directions.push_back(1);
+
+    sprite->_uvRect = clip->frames[0];
+    if (clip->frameEvents[0])
+    {
+        raise(animator, clip, 0);
+    }
+}
+
+void SpriteAnimationSystem::remove(SpriteAnimator* animator)
+{
+    uint32_t index = animator->slot;
+    animator->lastFrame = frames[index];
+    animator->slot = SpriteAnimator::NO_SLOT;
+
+    // Its queued events would outlive it
+    raised.erase(std::remove_if(raised.begin(), raised.end(),
+        [animator](const std::pair<SpriteAnimator*, const AnimationEvent*>& event) { return event.first == animator; }), raised.end());
+
+    size_t last = animators.size() - 1;
+    if (index != last)
+    {
+        animators[index] = animators[last];
+        sprites[index] = sprites[last];
+        clips[index] = clips[last];
+        frameTimes[index] = frameTimes[last];
+        frameDurations[index] = frameDurations[last];
+        rates[index] = rates[last];
+        frames[index] = frames[last];
+        directions[index] = directions[last];
+        animators[index]->slot = index;
+    }
+
+    animators.pop_back();
+    sprites.pop_back();
+    clips.pop_back();
+    frameTimes.pop_back();
+    frameDurations.pop_back();
+    rates.pop_back();
+    frames.pop_back();
+    directions.pop_back();
+}
+
+void SpriteAnimationSystem::refreshRate(SpriteAnimator* animator)
+{
+    rates[animator->slot] = animator->paused ? 0.0f : animator->speed;
+}
+
+void SpriteAnimationSystem::clear()
+{
+    for (SpriteAnimator* animator : animators)
+    {
+        animator->lastFrame = frames[animator->slot];
+        animator->slot = SpriteAnimator::NO_SLOT;
+    }
+
+    animators.clear();
+    sprites.clear();
+    clips.clear();
+    frameTimes.clear();
+    frameDurations.clear();
+    rates.clear();
+    frames.clear();
+    directions.clear();
+    due.clear();
+    raised.clear();
+    finished.clear();
+}
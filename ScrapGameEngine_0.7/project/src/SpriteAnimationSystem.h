@@ -0,0 +1,105 @@
+#pragma once
+#include "SpriteAnimator.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    class SpriteRenderer;
+
+    /**
+     * @class SpriteAnimationSystem
+     * @brief Advances every playing SpriteAnimator in one pass per frame.
+     *
+     * The state of playing animators is kept in parallel arrays. A first loop adds the frame time
+     * to every animator and finds those whose frame ran out; only those are moved to their next
+     * frame, which writes the frame's atlas area into the sprite. Sprites between frames cost one
+     * addition and one comparison. Main thread only.
+     */
+    class SpriteAnimationSystem
+    {
+    public:
+        SpriteAnimationSystem() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Advances all animations and invokes the events and completion callbacks raised.
+         * @param deltaTime The time elapsed since the last update.
+         */
+        static void update(float deltaTime);
+
+        /**
+         * @brief Gets the number of animations playing, paused ones included.
+         * @return The active animators.
+         */
+        static size_t getActiveCount() { return animators.size(); }
+
+        /**
+         * @brief Stops every animation.
+         */
+        static void clear();
+
+    private:
+        friend class SpriteAnimator; ///< Starts and stops its own animation.
+
+        /**
+         * @brief Starts animating a sprite from the first frame of a clip.
+         * @param animator The animator, not already playing.
+         * @param sprite The sprite drawing the clip's atlas.
+         * @param clip The clip, with at least one frame.
+         */
+        static void add(SpriteAnimator* animator, SpriteRenderer* sprite, const AnimationClip* clip);
+
+        /**
+         * @brief Stops an animator by moving the last one into its slot.
+         * @param animator The animator, playing.
+         */
+        static void remove(SpriteAnimator* animator);
+
+        /**
+         * @brief Sets how fast an animator advances.
+         * @param animator The animator, playing.
+         */
+        static void refreshRate(SpriteAnimator* animator);
+
+        /**
+         * @brief Gets the frame an animator shows.
+         * @param animator The animator, playing.
+         * @return The frame index.
+         */
+        static uint32_t getFrame(const SpriteAnimator* animator) { return frames[animator->slot]; }
+
+        /**
+         * @brief Moves an animator whose frame ran out to the frame its time falls in.
+         * @param index The animator's slot.
+         * @param finished Set when a ONCE clip reached its end.
+         */
+        static void advance(uint32_t index, bool& finished);
+
+        /**
+         * @brief Queues the events of a frame until the end of the next update.
+         * @param animator The animator reaching the frame.
+         * @param clip Its clip.
+         * @param frame The frame.
+         */
+        static void raise(SpriteAnimator* animator, const AnimationClip* clip, uint32_t frame);
+
+        static std::vector<SpriteAnimator*> animators;      ///< Playing animators.
+        static std::vector<SpriteRenderer*> sprites;        ///< Sprite of each animator.
+        static std::vector<const AnimationClip*> clips;     ///< Clip of each animator.
+        static std::vector<float> frameTimes;               ///< Time spent in the current frame.
+        static std::vector<float> frameDurations;           ///< Duration of the current frame.
+        static std::vector<float> rates;                    ///< Speed, 0 while paused.
+        static std::vector<uint32_t> frames;                ///< Current frame.
+        static std::vector<int8_t> directions;              ///< 1 forwards, -1 backwards in PING_PONG.
+        static std::vector<uint32_t> due;                   ///< Slots whose frame ran out this update.
+        static std::vector<std::pair<SpriteAnimator*, const AnimationEvent*>> raised; ///< Events waiting for their callbacks.
+
+        // Reused by every update so a steady frame allocates nothing
+        static std::vector<uint32_t> finished;                                                          ///< Slots whose ONCE clip ended this update.
+        static std::vector<std::pair<std::function<void(const std::string&)>, const std::string*>> eventCalls; ///< Event callbacks taken this update.
+        static std::vector<std::function<void()>> completionCalls;                                      ///< Completion callbacks taken this update.
+    };
+}
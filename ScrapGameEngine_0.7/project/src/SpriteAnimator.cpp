@@ -0,0 +1,161 @@
+#include "GameObject.h"
+#include "SpriteRenderer.h"
+#include "SpriteAnimationSystem.h"
+#include "Log.h"
+#include "SpriteAnimator.h"
+#include <algorithm>
+
+namespace ScrapGameEngine
+{
+    namespace
+    {
+        constexpr float MIN_FRAME_DURATION = 1e-4f;
+    }
+
+    AnimationClip::AnimationClip(const std::string& name, AnimationLoopMode loopMode)
+        : name(name), loopMode(loopMode)
+    {
+    }
+
+    AnimationClip AnimationClip::fromGrid(const std::string& name, int columns, int rows, int firstCell, int frameCount,
+        float frameDuration, AnimationLoopMode loopMode)
+    {
+        AnimationClip clip(name, loopMode);
+        if (columns <= 0 || rows <= 0)
+        {
+            SGE_LOG_WARN(GAMEOBJECT, "Animation clip {} has an empty grid", name);
+            return clip;
+        }
+
+        // Textures are loaded flipped, so the top row sits at the top of the UV range
+        glm::vec2 cell(1.0f / columns, 1.0f / rows);
+        for (int i = 0; i < frameCount; ++i)
+        {
+            int index = firstCell + i;
+            int column = index % columns;
+            int row = index / columns;
+            if (row >= rows)
+            {
+                SGE_LOG_WARN(GAMEOBJECT, "Animation clip {} runs past the {}x{} grid", name, columns, rows);
+                break;
+            }
+            clip.addFrame({ column * cell.x, 1.0f - (row + 1) * cell.y, cell.x, cell.y }, frameDuration);
+        }
+        return clip;
+    }
+
+    void AnimationClip::addFrame(const glm::vec4& uvRect, float frameDuration)
+    {
+        frameDuration = std::max(frameDuration, MIN_FRAME_DURATION);
+        frames.push_back(uvRect);
+        frameDurations.push_back(frameDuration);
+        frameEvents.push_back(0);
+        duration += frameDuration;
+    }
+
+    void AnimationClip::addEvent(uint32_t frame, const std::string& eventName)
+    {
+        if (frame >= frames.size())
+        {
+            SGE_LOG_WARN(GAMEOBJECT, "Animation clip {} has no frame {} for event {}", name, frame, eventName);
+            return;
+        }
+        frameEvents[frame] = 1;
+        events.push_back({ frame, eventName });
+    }
+
+    SpriteAnimator::SpriteAnimator(GameObject* owner)
+        : BaseComponent(owner)
+    {
+    }
+
+    SpriteAnimator::~SpriteAnimator()
+    {
+        stop();
+    }
+
+    void SpriteAnimator::play(const AnimationClip* clip, bool restart)
+    {
+        if (!clip || clip->getFrameCount() == 0)
+        {
+            SGE_LOG_WARN(GAMEOBJECT, "SpriteAnimator on {} was given a clip without frames", gameObject->getName());
+            return;
+        }
+
+        if (slot != NO_SLOT)
+        {
+            if (this->clip == clip && !restart)
+            {
+                return;
+            }
+            SpriteAnimationSystem::remove(this);
+        }
+
+        auto* sprite = gameObject->getComponent<SpriteRenderer>();
+        if (!sprite)
+        {
+            SGE_LOG_WARN(GAMEOBJECT, "SpriteAnimator on {} has no SpriteRenderer to animate", gameObject->getName());
+            return;
+        }
+
+        this->clip = clip;
+        paused = false;
+        SpriteAnimationSystem::add(this, sprite, clip);
+    }
+
+    void SpriteAnimator::stop()
+    {
+        if (slot != NO_SLOT)
+        {
+            SpriteAnimationSystem::remove(this);
+        }
+        paused = false;
+    }
+
+    void SpriteAnimator::pause()
+    {
+        paused = true;
+        if (slot != NO_SLOT)
+        {
+            SpriteAnimationSystem::refreshRate(this);
+        }
+    }
+
+    void SpriteAnimator::resume()
+    {
+        paused = false;
+        if (slot != NO_SLOT)
+        {
+            SpriteAnimationSystem::refreshRate(this);
+        }
+    }
+
+    void SpriteAnimator::setSpeed(float speed)
+    {
+        this->speed = std::max(speed, 0.0f);
+        if (slot != NO_SLOT)
+        {
+            SpriteAnimationSystem::refreshRate(this);
+        }
+    }
+
+    void SpriteAnimator::setEventCallback(std::function<void(const std::string&)> callback)
+    {
+        eventCallback = std::move(callback);
+    }
+
+    void SpriteAnimator::setOnComplete(std::function<void()> callback)
+    {
+        onComplete = std::move(callback);
+    }
+
+    bool SpriteAnimator::isPlaying() const
+    {
+        return slot != NO_SLOT;
+    }
+
+    uint32_t SpriteAnimator::getFrame() const
+    {
+        return slot != NO_SLOT ? SpriteAnimationSystem::getFrame(this) : lastFrame;
+    }
+}
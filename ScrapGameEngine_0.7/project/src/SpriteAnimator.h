@@ -0,0 +1,206 @@
+#pragma once
+
+#include "BaseComponent.h"
+#include <glm/vec4.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum AnimationLoopMode
+     * @brief What an animation does after its last frame.
+     */
+    enum class AnimationLoopMode
+    {
+        ONCE,       ///< Stop on the last frame.
+        LOOP,       ///< Start over from the first frame.
+        PING_PONG   ///< Play backwards to the first frame, then forwards again.
+    };
+
+    /**
+     * @struct AnimationEvent
+     * @brief A named event raised when an animation reaches a frame.
+     */
+    struct AnimationEvent
+    {
+        uint32_t frame;     ///< Frame raising the event.
+        std::string name;   ///< Name passed to the event callback.
+    };
+
+    /**
+     * @class AnimationClip
+     * @brief A sequence of frames on one atlas texture, each an area of it shown for its own duration.
+     *
+     * Clips hold no per-sprite state, so one clip drives any number of sprites. The sprites draw
+     * the atlas set with `SpriteRenderer::setTexture`; the clip only selects the area.
+     */
+    class AnimationClip
+    {
+    public:
+        /**
+         * @brief Creates a clip without frames.
+         * @param name The clip name.
+         * @param loopMode What the clip does after its last frame.
+         */
+        AnimationClip(const std::string& name, AnimationLoopMode loopMode = AnimationLoopMode::LOOP);
+
+        /**
+         * @brief Creates a clip from consecutive cells of a sprite sheet laid out as a grid.
+         * @param name The clip name.
+         * @param columns The number of cells across the sheet.
+         * @param rows The number of cells down the sheet.
+         * @param firstCell The first cell, counted left to right from the top row.
+         * @param frameCount The number of cells.
+         * @param frameDuration The time each frame is shown in seconds.
+         * @param loopMode What the clip does after its last frame.
+         * @return The clip.
+         */
+        static AnimationClip fromGrid(const std::string& name, int columns, int rows, int firstCell, int frameCount,
+            float frameDuration, AnimationLoopMode loopMode = AnimationLoopMode::LOOP);
+
+        /**
+         * @brief Appends a frame.
+         * @param uvRect The area of the atlas, offset in xy and size in zw in texture coordinates.
+         * @param duration The time the frame is shown in seconds.
+         */
+        void addFrame(const glm::vec4& uvRect, float duration);
+
+        /**
+         * @brief Raises an event each time the animation reaches a frame.
+         * @param frame The frame index.
+         * @param name The event name.
+         */
+        void addEvent(uint32_t frame, const std::string& name);
+
+        /**
+         * @brief Gets the clip name.
+         * @return The name.
+         */
+        const std::string& getName() const { return name; }
+
+        /**
+         * @brief Gets the number of frames.
+         * @return The frame count.
+         */
+        uint32_t getFrameCount() const { return static_cast<uint32_t>(frames.size()); }
+
+        /**
+         * @brief Gets the time one pass over all frames takes.
+         * @return The duration in seconds.
+         */
+        float getDuration() const { return duration; }
+
+        /**
+         * @brief Gets what the clip does after its last frame.
+         * @return The loop mode.
+         */
+        AnimationLoopMode getLoopMode() const { return loopMode; }
+
+    private:
+        friend class SpriteAnimationSystem; ///< Reads the frame tables while advancing sprites.
+
+        std::string name;                       ///< Clip name.
+        AnimationLoopMode loopMode;             ///< Behaviour after the last frame.
+        std::vector<glm::vec4> frames;          ///< Atlas area of each frame.
+        std::vector<float> frameDurations;      ///< Time each frame is shown.
+        std::vector<uint8_t> frameEvents;       ///< Non-zero for frames raising events.
+        std::vector<AnimationEvent> events;     ///< Events, in the order they were added.
+        float duration = 0.0f;                  ///< Sum of the frame durations.
+    };
+
+    /**
+     * @class SpriteAnimator
+     * @brief Component that plays sprite sheet animations on the owner's SpriteRenderer.
+     *
+     * Animators are advanced together by `SpriteAnimationSystem`, so they need no update call.
+     * Playing a clip changes only the area of the atlas the sprite draws, never its texture.
+     */
+    class SpriteAnimator : public BaseComponent
+    {
+    public:
+        /**
+         * @brief Constructor for SpriteAnimator.
+         * @param owner Pointer to the GameObject that owns this component.
+         */
+        SpriteAnimator(GameObject* owner);
+
+        /**
+         * @brief Stops the animation.
+         */
+        ~SpriteAnimator() override;
+
+        /**
+         * @brief Plays a clip from its first frame, unless it is already playing.
+         * @param clip The clip, kept alive by the caller while it plays.
+         * @param restart True to start over when the clip is already playing.
+         */
+        void play(const AnimationClip* clip, bool restart = false);
+
+        /**
+         * @brief Stops the animation, the sprite keeps its current frame.
+         */
+        void stop();
+
+        /**
+         * @brief Pauses the animation.
+         */
+        void pause();
+
+        /**
+         * @brief Resumes the animation if it was paused.
+         */
+        void resume();
+
+        /**
+         * @brief Sets the playback speed.
+         * @param speed The multiplier of the frame durations' rate, 1 for normal speed.
+         */
+        void setSpeed(float speed);
+
+        /**
+         * @brief Sets the callback invoked when the animation reaches a frame with events.
+         * @param callback Receives the event name.
+         */
+        void setEventCallback(std::function<void(const std::string&)> callback);
+
+        /**
+         * @brief Sets the callback invoked when a clip played ONCE reaches its end.
+         * @param callback The callback.
+         */
+        void setOnComplete(std::function<void()> callback);
+
+        /**
+         * @brief Checks whether a clip is playing.
+         * @return True while the animation advances or is paused, false once stopped or finished.
+         */
+        bool isPlaying() const;
+
+        /**
+         * @brief Gets the clip played last.
+         * @return The clip, or null if none was played.
+         */
+        const AnimationClip* getClip() const { return clip; }
+
+        /**
+         * @brief Gets the frame shown.
+         * @return The frame index.
+         */
+        uint32_t getFrame() const;
+
+    private:
+        friend class SpriteAnimationSystem; ///< Keeps `slot` up to date and invokes the callbacks.
+
+        static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu; ///< `slot` when not playing.
+
+        const AnimationClip* clip = nullptr;                        ///< Clip played last.
+        uint32_t slot = NO_SLOT;                                    ///< Index in the system's arrays while playing.
+        uint32_t lastFrame = 0;                                     ///< Frame shown when the animation stopped.
+        float speed = 1.0f;                                         ///< Playback speed.
+        bool paused = false;                                        ///< Whether the animation is paused.
+        std::function<void(const std::string&)> eventCallback;      ///< Invoked for frame events.
+        std::function<void()> onComplete;                           ///< Invoked when a ONCE clip ends.
+    };
+}
@@ -1,149 +1,210 @@
-#include <iostream>
-#include <glad/glad.h>
-#include "GameObject.h"
-#include "TextureAllocator.h"
-#include "SpriteRenderer.h"
-#include "Text.h"
-
-namespace ScrapGameEngine
-{
-    Text::Text(GameObject* owner)
-        : BaseComponent(owner), textureAtlasID(0), atlasWidth(512), atlasHeight(512), position(0.0f, 0.0f), scale(1.0f), color(1.0f, 1.0f, 1.0f, 1.0f)
-    {
-        if (FT_Init_FreeType(&ft))
-        {
-            std::cerr << "Could not initialize FreeType library" << std::endl;
-        }
-        else
-        {
-            std::cout << "[Text_Component] FreeType library initialized successfully." << std::endl;
-        }
-    }
-
-    Text::~Text()
-    {
-        if (face)
-        {
-            FT_Done_Face(face);
-        }
-
-        FT_Done_FreeType(ft);
-    }
-
-    void Text::loadFont(const std::string& filePath, int fontSize)
-    {
-        if (FT_New_Face(ft, filePath.c_str(), 0, &face))
-        {
-            std::cerr << "[Text_Component] Failed to load font: " << filePath << std::endl;
-            return;
-        }
-
-        FT_Set_Pixel_Sizes(face, 0, fontSize);
-
-        std::vector<unsigned char> textureBuffer(atlasWidth * atlasHeight, 0);
-
-        int padding = 2;
-        int row = padding;
-        int col = padding;
-
-        for (unsigned char c = 32; c < 127; ++c)
-        {
-            if (FT_Load_Char(face, c, FT_LOAD_RENDER))
-            {
-                std::cerr << "[Text_Component] Failed to load character: " << c << std::endl;
-                continue;
-            }
-
-            if (col + face->glyph->bitmap.width + padding > atlasWidth)
-            {
-                col = padding;
-                row += fontSize + padding;
-            }
-
-            if (row + face->glyph->bitmap.rows + padding > atlasHeight)
-            {
-                std::cerr << "[Text_Component] Texture atlas overflow. Increase atlas size." << std::endl;
-                break;
-            }
-
-            for (unsigned int y = 0; y < face->glyph->bitmap.rows; ++y)
-            {
-                for (unsigned int x = 0; x < face->glyph->bitmap.width; ++x)
-                {
-                    textureBuffer[(row + y) * atlasWidth + (col + x)] =
-                        face->glyph->bitmap.buffer[y * face->glyph->bitmap.width + x];
-                }
-            }
-
-            glyphs[c] = {
-                glm::vec2(col / (float)atlasWidth, row / (float)atlasHeight),
-                glm::vec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-                glm::vec2((float)(face->glyph->advance.x >> 6), (float)(face->glyph->advance.y >> 6)),
-                glm::vec2(face->glyph->bitmap_left, face->glyph->bitmap_top)
-            };
-
-            col += face->glyph->bitmap.width + padding;
-        }
-
-        // Create and configure the texture
-        TextureConfig cfg{};
-        cfg.wrapModeX = TextureWrapMode::CLAMP_TO_BORDER;
-        cfg.wrapModeY = TextureWrapMode::CLAMP_TO_BORDER;
-        cfg.filterMode = TextureFilterMode::LINEAR;
-        cfg.borderColor = { 1.0f, 1.0f, 1.0f, 1.0f };
-        cfg.generateMipmaps = false;
-
-        std::string texturePath = "../assets/Assets/text.png";
-        auto texture = TextureAllocator::getTexture(texturePath, cfg);
-
-        if (!texture)
-        {
-            std::cerr << "[Text_Component] Failed to create texture atlas." << std::endl;
-            return;
-        }
-
-        // Assign the texture to the SpriteRenderer
-        auto spriteRenderer = gameObject->getComponent<SpriteRenderer>();
-        if (!spriteRenderer)
-        {
-            spriteRenderer = gameObject->addComponent<SpriteRenderer>();
-        }
-        spriteRenderer->awake();
-        spriteRenderer->setTexture(texture);
-    }
-
-    void Text::render()
-    {
-      
-    }
-
-    void Text::SetFont(const std::string& filePath)
-    {
-        loadFont(filePath, static_cast<int>(scale * 16)); // Default font size
-    }
-
-    void Text::setText(const std::string& newText)
-    {
-        text = newText;
-    }
-
-    void Text::setPosition(float x, float y)
-    {
-        position = { x, y };
-    }
-
-    void Text::setScale(float newScale)
-    {
-        scale = newScale;
-    }
-
-    void Text::setColor(float r, float g, float b, float a)
-    {
-        color = { r, g, b, a };
-    }
-
-    void Text::setColour(float r, float g, float b, float a)
-    {
-        color = { r, g, b, a };
-    }
-}
+#include "GameObject.h"
+#include "Graphics.h"
+#include "Time.h"
+#include "Profiler.h"
+#include "Text.h"
+#include <glm/common.hpp>
+
+namespace ScrapGameEngine
+{
+    namespace
+    {
+        // Decodes the UTF-8 sequence at `index` and moves past it; malformed bytes become U+FFFD
+        uint32_t nextCodepoint(const std::string& text, size_t& index)
+        {
+            const unsigned char lead = static_cast<unsigned char>(text[index++]);
+            if (lead < 0x80) return lead;
+
+            int length;
+            uint32_t codepoint;
+            if ((lead & 0xE0) == 0xC0) { length = 1; codepoint = lead & 0x1F; }
+            else if ((lead & 0xF0) == 0xE0) { length = 2; codepoint = lead & 0x0F; }
+            else if ((lead & 0xF8) == 0xF0) { length = 3; codepoint = lead & 0x07; }
+            else return 0xFFFD;
+
+            for (int i = 0; i < length; ++i)
+            {
+                if (index >= text.size() || (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80) return 0xFFFD;
+                codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[index++]) & 0x3F);
+            }
+            return codepoint;
+        }
+    }
+
+    unsigned int Text::frameLayouts = 0;
+    unsigned int Text::lastFrameLayouts = 0;
+    unsigned long long Text::totalLayouts = 0;
+
+    Text::Text(GameObject* owner)
+        : BaseComponent(owner), font(nullptr), boundsMin(0.0f, 0.0f), boundsMax(0.0f, 0.0f), layoutDirty(true), layoutGeneration(0),
+        position(0.0f, 0.0f), scale(1.0f), color(1.0f, 1.0f, 1.0f, 1.0f)
+    {
+    }
+
+    Text::~Text()
+    {
+        FontCache::returnFont(font);
+    }
+
+    void Text::buildVertices()
+    {
+        vertices.clear();
+        boundsMin = boundsMax = glm::vec2(0.0f, 0.0f);
+        if (!font || text.empty()) return;
+
+        vertices.reserve(text.size() * 6);
+
+        // Glyph metrics are in pixels, with y pointing up from the baseline
+        const float unitsPerPixel = EM_SIZE * scale / static_cast<float>(font->getPixelSize());
+        glm::vec2 pen(0.0f, 0.0f);
+
+        for (size_t i = 0; i < text.size();)
+        {
+            uint32_t c = nextCodepoint(text, i);
+            if (c == '\n')
+            {
+                pen.x = 0.0f;
+                pen.y -= font->getLineHeight();
+                continue;
+            }
+
+            const Glyph* glyph = font->getGlyph(c);
+            if (!glyph) continue;
+
+            if (glyph->size.x > 0.0f && glyph->size.y > 0.0f)
+            {
+                float x0 = (pen.x + glyph->offset.x) * unitsPerPixel;
+                float y1 = (pen.y + glyph->offset.y) * unitsPerPixel;
+                float x1 = x0 + glyph->size.x * unitsPerPixel;
+                float y0 = y1 - glyph->size.y * unitsPerPixel;
+
+                if (vertices.empty())
+                {
+                    boundsMin = glm::vec2(x0, y0);
+                    boundsMax = glm::vec2(x1, y1);
+                }
+                boundsMin = glm::min(boundsMin, glm::vec2(x0, y0));
+                boundsMax = glm::max(boundsMax, glm::vec2(x1, y1));
+
+                // The atlas rows run top to bottom, so the top edge has the smaller v
+                float u0 = glyph->textureCoords.x;
+                float v0 = glyph->textureCoords.y;
+                float u1 = u0 + glyph->textureSize.x;
+                float v1 = v0 + glyph->textureSize.y;
+
+                vertices.push_back(Vertex({ x0, y1, 0.0f }, { u0, v0 }));
+                vertices.push_back(Vertex({ x0, y0, 0.0f }, { u0, v1 }));
+                vertices.push_back(Vertex({ x1, y0, 0.0f }, { u1, v1 }));
+
+                vertices.push_back(Vertex({ x1, y0, 0.0f }, { u1, v1 }));
+                vertices.push_back(Vertex({ x1, y1, 0.0f }, { u1, v0 }));
+                vertices.push_back(Vertex({ x0, y1, 0.0f }, { u0, v0 }));
+            }
+
+            pen.x += glyph->advance.x;
+        }
+    }
+
+    void Text::updateLayout()
+    {
+        // A hot reload moves the glyphs in the atlas without telling the texts using it
+        uint32_t generation = font ? font->getGeneration() : 0;
+        if (!layoutDirty && generation == layoutGeneration) return;
+
+        buildVertices();
+        layoutDirty = false;
+        layoutGeneration = generation;
+        frameLayouts++;
+        totalLayouts++;
+    }
+
+    void Text::getBounds(glm::vec2& min, glm::vec2& max)
+    {
+        updateLayout();
+        min = boundsMin;
+        max = boundsMax;
+    }
+
+    void Text::endFrame()
+    {
+        lastFrameLayouts = frameLayouts;
+        frameLayouts = 0;
+    }
+
+    void Text::render()
+    {
+        SGE_PROFILE_SCOPE("Text::render");
+
+        updateLayout();
+        if (vertices.empty()) return;
+
+        // Blend between the last two simulation steps when running with a fixed time step
+        float alpha = Time::getInterpolationAlpha();
+        glm::vec2 origin = gameObject->transform->getInterpolatedPosition(alpha) + position;
+        glm::vec2 objectScale = gameObject->transform->getInterpolatedScale(alpha);
+
+        // One draw for the whole string
+        RenderParams params{};
+        params.tint = color;
+        params.translation = { origin.x, origin.y, 0.0f };
+        params.rotationZ = gameObject->transform->getInterpolatedRotation(alpha);
+        params.scale = { objectScale.x, objectScale.y, 1.0f };
+        params.texture = font->getAtlas();
+        params.distanceField = font->isDistanceField();
+
+        Graphics::drawDynamic(vertices.data(), static_cast<unsigned int>(vertices.size()), params);
+    }
+
+    void Text::SetFont(const std::string& filePath)
+    {
+        SetFont(filePath, static_cast<int>(scale * 16)); // Default font size
+    }
+
+    void Text::SetFont(const std::string& filePath, int pixelSize)
+    {
+        useFont(FontCache::getFont(filePath, pixelSize));
+    }
+
+    void Text::SetDistanceFieldFont(const std::string& filePath)
+    {
+        useFont(FontCache::getFont(filePath, DISTANCE_FIELD_PIXEL_SIZE, true));
+    }
+
+    void Text::useFont(Font* newFont)
+    {
+        if (!newFont) return; // The cache logged why
+
+        FontCache::returnFont(font);
+        if (newFont != font) layoutDirty = true;
+        font = newFont;
+    }
+
+    void Text::setText(const std::string& newText)
+    {
+        if (text == newText) return;
+        text = newText;
+        layoutDirty = true;
+    }
+
+    void Text::setPosition(float x, float y)
+    {
+        position = { x, y };
+    }
+
+    void Text::setScale(float newScale)
+    {
+        if (scale == newScale) return;
+        scale = newScale;
+        layoutDirty = true;
+    }
+
+    void Text::setColor(float r, float g, float b, float a)
+    {
+        color = { r, g, b, a };
+    }
+
+    void Text::setColour(float r, float g, float b, float a)
+    {
+        color = { r, g, b, a };
+    }
+}
@@ -1,119 +1,167 @@
-#pragma once
-
-#include "BaseComponent.h"
-#include <unordered_map>
-#include <string>
-#include <glm/vec2.hpp>
-#include <glm/vec4.hpp>
-#include <ft2build.h>
-
-#include FT_FREETYPE_H
-
-namespace ScrapGameEngine {
-
-    /**
-     * @struct Glyph
-     * @brief Represents a character glyph in the texture atlas.
-     *
-     * This structure holds information about a character glyph, including its
-     * size, texture coordinates, advance, and offset.
-     */
-    struct Glyph
-    {
-        glm::vec2 textureCoords; ///< Texture coordinates for the glyph in the atlas
-        glm::vec2 size;          ///< Size of the glyph (width, height)
-        glm::vec2 advance;       ///< The distance to move to the next glyph
-        glm::vec2 offset;        ///< Offset from the baseline to render the glyph
-    };
-
-    /**
-     * @class Text
-     * @brief Manages and renders text using a TrueType font.
-     *
-     * This component handles loading a TrueType font, creating a texture atlas for
-     * glyphs, and rendering text in the game. It supports setting text content,
-     * position, scale, and color.
-     */
-    class Text : public BaseComponent
-    {
-    public:
-        /**
-         * @brief Constructs a Text component.
-         * @param owner Pointer to the associated GameObject.
-         */
-        explicit Text(GameObject* owner);
-
-        /**
-         * @brief Destructor.
-         */
-        ~Text();
-
-        /**
-         * @brief Renders the text.
-         */
-        void render() override;
-
-        /**
-         * @brief Sets the font to be used for rendering the text.
-         * @param filePath File path to the TrueType font.
-         */
-        void SetFont(const std::string& filePath);
-
-        /**
-         * @brief Sets the text to be displayed.
-         * @param newText The string to be displayed.
-         */
-        void setText(const std::string& newText);
-
-        /**
-         * @brief Sets the position of the text in the game world.
-         * @param x X-coordinate.
-         * @param y Y-coordinate.
-         */
-        void setPosition(float x, float y);
-
-        /**
-         * @brief Sets the scale of the text.
-         * @param newScale Scale factor for the text size.
-         */
-        void setScale(float newScale);
-
-        /**
-         * @brief Sets the color of the text.
-         * @param r Red component (0.0 to 1.0).
-         * @param g Green component (0.0 to 1.0).
-         * @param b Blue component (0.0 to 1.0).
-         * @param a Alpha (transparency) component (0.0 to 1.0).
-         */
-        void setColor(float r, float g, float b, float a);
-
-        /**
-         * @brief Sets the color of the text.
-         * @param r Red component (0.0 to 1.0).
-         * @param g Green component (0.0 to 1.0).
-         * @param b Blue component (0.0 to 1.0).
-         * @param a Alpha (transparency) component (0.0 to 1.0).
-         */
-        void setColour(float r, float g, float b, float a);
-
-    private:
-        /**
-         * @brief Loads the font from a TrueType font file.
-         * @param filePath File path to the font file.
-         * @param fontSize Size of the font.
-         */
-        void loadFont(const std::string& filePath, int fontSize);
-
-        FT_Library ft;                 ///< FreeType library handle
-        FT_Face face;                   ///< FreeType face (font) handle
-        std::unordered_map<char, Glyph> glyphs; ///< Map of character glyphs
-        unsigned int textureAtlasID;   ///< ID of the texture atlas for glyphs
-        int atlasWidth;                 ///< Width of the texture atlas
-        int atlasHeight;                ///< Height of the texture atlas
-
-        std::string text;               ///< The text string to display
-        glm::vec2 position;              ///< Position of the text
-        float scale;                     ///< Scale factor for text size
-        glm::vec4 color;                  ///< Color of the text (RGBA)
-    };
-}
+#pragma once
+
+#include "BaseComponent.h"
+#include "FontCache.h"
+#include "Mesh.h"
+#include <string>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+namespace ScrapGameEngine {
+
+    /**
+     * @class Text
+     * @brief Manages and renders text using a TrueType font.
+     *
+     * This component gets its font from the `FontCache`, so every Text using the same
+     * file and pixel size shares one glyph atlas. Each string is drawn as one batch of
+     * glyph quads through `Graphics::drawDynamic`. It supports setting text content,
+     * as UTF-8, position, scale, and color.
+     *
+     * The quads and bounds are laid out once and kept until the text, scale or font
+     * changes. Position and color are applied per draw, so changing them costs nothing.
+     * A distance field font keeps a single atlas sharp at every scale.
+     */
+    class Text : public BaseComponent
+    {
+    public:
+        static constexpr float EM_SIZE = 0.16f; ///< Height of one em in world units at a scale of 1.
+        static constexpr int DISTANCE_FIELD_PIXEL_SIZE = 32; ///< Pixel size distance field atlases are stored at.
+
+        /**
+         * @brief Constructs a Text component.
+         * @param owner Pointer to the associated GameObject.
+         */
+        explicit Text(GameObject* owner);
+
+        /**
+         * @brief Returns the font to the cache.
+         */
+        ~Text() override;
+
+        /**
+         * @brief Renders the text.
+         */
+        void render() override;
+
+        /**
+         * @brief Sets the font to be used for rendering the text, rasterized at 16 pixels times the scale.
+         * @param filePath File path to the TrueType font.
+         */
+        void SetFont(const std::string& filePath);
+
+        /**
+         * @brief Sets the font to be used for rendering the text.
+         * @param filePath File path to the TrueType font.
+         * @param pixelSize Pixel size the glyphs are rasterized at. Only sharpness depends on it.
+         */
+        void SetFont(const std::string& filePath, int pixelSize);
+
+        /**
+         * @brief Sets a distance field font, one atlas that stays sharp at every scale.
+         * @param filePath File path to the TrueType font.
+         */
+        void SetDistanceFieldFont(const std::string& filePath);
+
+        /**
+         * @brief Gets the font used for rendering the text.
+         * @return The font, or null if none is set.
+         */
+        Font* getFont() const { return font; }
+
+        /**
+         * @brief Sets the text to be displayed.
+         * @param newText The string to be displayed, UTF-8 encoded.
+         */
+        void setText(const std::string& newText);
+
+        /**
+         * @brief Sets the position of the text's first baseline, relative to the GameObject.
+         * @param x X-coordinate.
+         * @param y Y-coordinate.
+         */
+        void setPosition(float x, float y);
+
+        /**
+         * @brief Sets the scale of the text.
+         * @param newScale Scale factor for the text size, one em is `EM_SIZE * newScale` world units.
+         */
+        void setScale(float newScale);
+
+        /**
+         * @brief Sets the color of the text.
+         * @param r Red component (0.0 to 1.0).
+         * @param g Green component (0.0 to 1.0).
+         * @param b Blue component (0.0 to 1.0).
+         * @param a Alpha (transparency) component (0.0 to 1.0).
+         */
+        void setColor(float r, float g, float b, float a);
+
+        /**
+         * @brief Sets the color of the text.
+         * @param r Red component (0.0 to 1.0).
+         * @param g Green component (0.0 to 1.0).
+         * @param b Blue component (0.0 to 1.0).
+         * @param a Alpha (transparency) component (0.0 to 1.0).
+         */
+        void setColour(float r, float g, float b, float a);
+
+        /**
+         * @brief Gets the extent of the glyph quads, laying the text out first if it changed.
+         * @param min Receives the bottom left corner, relative to the text position and before the GameObject's transform.
+         * @param max Receives the top right corner. Equal to `min` when nothing is drawn.
+         */
+        void getBounds(glm::vec2& min, glm::vec2& max);
+
+        /**
+         * @brief Closes the layout count of the frame. Called once per frame after rendering.
+         */
+        static void endFrame();
+
+        /**
+         * @brief Gets the number of texts laid out during the last frame.
+         * @return The layouts of the last frame; zero when every text was unchanged.
+         */
+        static unsigned int getFrameLayouts() { return lastFrameLayouts; }
+
+        /**
+         * @brief Gets the number of texts laid out since startup.
+         * @return The total number of layouts.
+         */
+        static unsigned long long getTotalLayouts() { return totalLayouts; }
+
+    private:
+        /**
+         * @brief Lays the glyph quads of the text out into `vertices`, relative to the baseline start.
+         */
+        void buildVertices();
+
+        /**
+         * @brief Rebuilds the layout if the text, scale or font changed since the last one.
+         */
+        void updateLayout();
+
+        /**
+         * @brief Replaces the font with one from the cache, keeping the current one if it is null.
+         * @param newFont A reference from FontCache::getFont(), or null.
+         */
+        void useFont(Font* newFont);
+
+        static unsigned int frameLayouts;           ///< Layouts so far in the current frame
+        static unsigned int lastFrameLayouts;       ///< Layouts of the last finished frame
+        static unsigned long long totalLayouts;     ///< Layouts since startup
+
+        Font* font;                     ///< Font from the FontCache, null if none is set
+        std::vector<Vertex> vertices;   ///< Laid out glyph quads, reused until the layout is stale
+        glm::vec2 boundsMin;            ///< Bottom left corner of the quads
+        glm::vec2 boundsMax;            ///< Top right corner of the quads
+        bool layoutDirty;               ///< Set when the text, scale or font changes
+        uint32_t layoutGeneration;      ///< Font generation the layout was built from
+
+        std::string text;               ///< The text string to display
+        glm::vec2 position;              ///< Position of the text
+        float scale;                     ///< Scale factor for text size
+        glm::vec4 color;                  ///< Color of the text (RGBA)
+    };
+}
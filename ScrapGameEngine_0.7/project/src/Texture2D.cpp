@@ -1,216 +1,470 @@
-#pragma once
-#include <glad/glad.h>
-#include "Texture2D.h"
-#include <iostream>
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image/stb_image.h>
-
-using namespace ScrapGameEngine;
-
-// Utility function to convert TextureWrapMode to OpenGL 
-static GLint toGLFormat_WrapMode(TextureWrapMode wrapMode)
-{
-    switch (wrapMode)
-    {
-    case TextureWrapMode::REPEAT: return GL_REPEAT;
-    case TextureWrapMode::CLAMP: return GL_CLAMP_TO_EDGE;
-    case TextureWrapMode::MIRRORED_REPEAT: return GL_MIRRORED_REPEAT;
-    case TextureWrapMode::CLAMP_TO_BORDER: return GL_CLAMP_TO_BORDER;
-    }
-    return GL_REPEAT; // Default to REPEAT if no match
-}
-
-// Utility function to convert TextureFilterMode to OpenGL format (Mag Filter)
-static GLint toGLFormat_MagFilter(TextureFilterMode filterMode)
-{
-    switch (filterMode)
-    {
-    case TextureFilterMode::LINEAR: return GL_LINEAR;
-    case TextureFilterMode::NEAREST: return GL_NEAREST; // Handle NEAREST filter mode
-    }
-    return 0;
-}
-
-// Utility function to convert TextureFilterMode to OpenGL format (Min Filter)
-static GLint toGLFormat_MinFilter(TextureFilterMode filterMode)
-{
-    switch (filterMode)
-    {
-    case TextureFilterMode::LINEAR: return GL_LINEAR;
-    case TextureFilterMode::NEAREST: return GL_NEAREST; // Handle NEAREST filter mode
-    case TextureFilterMode::NEAREST_MIPMAP_NEAREST: return GL_NEAREST_MIPMAP_NEAREST;
-    case TextureFilterMode::NEAREST_MIPMAP_LINEAR: return GL_NEAREST_MIPMAP_LINEAR;
-    case TextureFilterMode::LINEAR_MIPMAP_LINEAR: return GL_LINEAR_MIPMAP_LINEAR;
-    }
-    return 0;
-}
-
-// Utility function to convert TextureFilterMode to OpenGL format (Min and Mag Filters)
-static GLint toGLFormat_FilterMode(TextureFilterMode filterMode, bool isMinFilter = true)
-{
-    switch (filterMode)
-    {
-    case TextureFilterMode::LINEAR:
-        return isMinFilter ? GL_LINEAR : GL_LINEAR;
-    case TextureFilterMode::NEAREST:
-        return isMinFilter ? GL_NEAREST : GL_NEAREST;
-    case TextureFilterMode::NEAREST_MIPMAP_NEAREST:
-        return isMinFilter ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST;
-    case TextureFilterMode::NEAREST_MIPMAP_LINEAR:
-        return isMinFilter ? GL_NEAREST_MIPMAP_LINEAR : GL_NEAREST;
-    case TextureFilterMode::LINEAR_MIPMAP_LINEAR:
-        return isMinFilter ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
-    }
-    return 0;
-}
-
-// Helper function to set texture parameters
-void Texture2D::setTextureParams(GLuint textureID, const TextureConfig& cfg)
-{
-    glBindTexture(GL_TEXTURE_2D, textureID);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, toGLFormat_FilterMode(cfg.filterMode, true));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, toGLFormat_FilterMode(cfg.filterMode, false));
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(cfg.wrapModeX));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(cfg.wrapModeY));
-
-    if (cfg.wrapModeX == TextureWrapMode::CLAMP_TO_BORDER || cfg.wrapModeY == TextureWrapMode::CLAMP_TO_BORDER)
-    {
-        glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, &cfg.borderColor[0]);
-    }
-
-    glBindTexture(GL_TEXTURE_2D, 0);  // Unbind the texture
-}
-
-// Unified function to load texture data
-static unsigned int loadTexture(const std::string& path, int& width, int& height, int& nrChannels, const TextureConfig& cfg)
-{
-    stbi_set_flip_vertically_on_load(true); // Flip image vertically as OpenGL expects it this way
-
-    unsigned char* data = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
-    if (data) {
-        unsigned int textureID;
-        glGenTextures(1, &textureID);  // Generate a new texture ID
-        glBindTexture(GL_TEXTURE_2D, textureID);  // Bind the texture for setting parameters
-
-        // Set texture filtering and wrapping parameters
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, toGLFormat_FilterMode(cfg.filterMode, true));
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, toGLFormat_FilterMode(cfg.filterMode, false));
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(cfg.wrapModeX));
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(cfg.wrapModeY));
-
-        if (cfg.wrapModeX == TextureWrapMode::CLAMP_TO_BORDER || cfg.wrapModeY == TextureWrapMode::CLAMP_TO_BORDER)
-        {
-            glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, &cfg.borderColor[0]);
-        }
-
-        // Load the image data into OpenGL
-        GLenum format = (nrChannels == 4) ? GL_RGBA : (nrChannels == 3) ? GL_RGB : GL_RED;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-
-        if (cfg.generateMipmaps) 
-        {
-            //glGenerateMipmap(GL_TEXTURE_2D);
-        }
-
-        glBindTexture(GL_TEXTURE_2D, 0);  // Unbind the texture
-        stbi_image_free(data);  // Free the image data from memory
-        return textureID;  // Return the generated texture ID
-    }
-    else {
-        std::cerr << "Failed to load texture: " << path << std::endl;
-        return 0;  // Return 0 if loading failed
-    }
-}
-
-// Get the OpenGL texture ID
-unsigned int Texture2D::getID() const
-{
-    return id;
-}
-
-// Get the size of the texture
-glm::ivec2 Texture2D::getSize() const
-{
-    return glm::ivec2(width, height);
-}
-
-// Get the path of the texture
-const std::string& Texture2D::getPath() const
-{
-    return path;
-}
-
-// Get the configuration of the texture
-const TextureConfig& Texture2D::getConfig() const
-{
-    return cfg;
-}
-
-// Method to bind the texture
-void Texture2D::bind() const
-{
-    glBindTexture(GL_TEXTURE_2D, id);
-}
-
-void Texture2D::setWrapMode(TextureWrapMode wrapX, TextureWrapMode wrapY)
-{
-    cfg.wrapModeX = wrapX;
-    cfg.wrapModeY = wrapY;
-
-    // Bind the texture and update the wrap parameters
-    bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(wrapX));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(wrapY));
-}
-
-// Initialize the static blank texture pointer
-Texture2D* Texture2D::blankTexture()
-{
-    static Texture2D* blankTexture = nullptr;
-
-    if (!blankTexture)
-    {
-        TextureConfig blankConfig = { TextureWrapMode::CLAMP_TO_BORDER, TextureWrapMode::CLAMP_TO_BORDER, TextureFilterMode::NEAREST };
-        blankTexture = new Texture2D("Blank", blankConfig);
-    }
-
-    return blankTexture;
-}
-
-Texture2D* Texture2D::createTexture(const std::string& path, const TextureConfig& cfg)
-{
-    int width, height, nrChannels;
-    unsigned int textureID = loadTexture(path, width, height, nrChannels, cfg);  // Pass cfg to loadTexture
-
-    if (textureID == 0) return nullptr;  // If texture load failed, return nullptr
-
-    // Create the texture object and initialize with the generated texture ID and configuration
-    Texture2D* tex = new Texture2D(path, cfg);
-    tex->id = textureID;  // Set the ID generated by OpenGL
-    tex->width = width;   // Set the width from the loaded image data
-    tex->height = height; // Set the height from the loaded image data
-
-    return tex;  // Return created texture object
-}
-
-// Destructor: Clean up the texture from GPU memory
-Texture2D::~Texture2D()
-{
-    glDeleteTextures(1, &id);
-}
-
-// Constructor: Load texture data from file and upload it to the GPU
-Texture2D::Texture2D(const std::string& path, TextureConfig cfg)
-    : path(path), cfg(cfg), id(0), width(0), height(0) // Initialize member variables
-{
-    int nrChannels;
-    id = loadTexture(path, width, height, nrChannels, cfg);  // Pass cfg to loadTexture
-
-    if (id > 0) {
-        // Successfully loaded, set texture parameters
-        setTextureParams(id, cfg);
-    }
-}
+#pragma once
+#include <glad/glad.h>
+#include "Texture2D.h"
+#include "Renderer.h"
+#include "MemoryTracker.h"
+#include "Log.h"
+#include <cstring>
+#include <filesystem>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image/stb_image.h>
+
+using namespace ScrapGameEngine;
+
+// Fake texture IDs handed out when no GPU is available
+static unsigned int nextHeadlessId = 1;
+
+// Utility function to convert TextureWrapMode to OpenGL 
+static GLint toGLFormat_WrapMode(TextureWrapMode wrapMode)
+{
+    switch (wrapMode)
+    {
+    case TextureWrapMode::REPEAT: return GL_REPEAT;
+    case TextureWrapMode::CLAMP: return GL_CLAMP_TO_EDGE;
+    case TextureWrapMode::MIRRORED_REPEAT: return GL_MIRRORED_REPEAT;
+    case TextureWrapMode::CLAMP_TO_BORDER: return GL_CLAMP_TO_BORDER;
+    }
+    return GL_REPEAT; // Default to REPEAT if no match
+}
+
+// Utility function to convert TextureFilterMode to OpenGL format (Mag Filter)
+static GLint toGLFormat_MagFilter(TextureFilterMode filterMode)
+{
+    switch (filterMode)
+    {
+    case TextureFilterMode::LINEAR: return GL_LINEAR;
+    case TextureFilterMode::NEAREST: return GL_NEAREST; // Handle NEAREST filter mode
+    }
+    return 0;
+}
+
+// Utility function to convert TextureFilterMode to OpenGL format (Min Filter)
+static GLint toGLFormat_MinFilter(TextureFilterMode filterMode)
+{
+    switch (filterMode)
+    {
+    case TextureFilterMode::LINEAR: return GL_LINEAR;
+    case TextureFilterMode::NEAREST: return GL_NEAREST; // Handle NEAREST filter mode
+    case TextureFilterMode::NEAREST_MIPMAP_NEAREST: return GL_NEAREST_MIPMAP_NEAREST;
+    case TextureFilterMode::NEAREST_MIPMAP_LINEAR: return GL_NEAREST_MIPMAP_LINEAR;
+    case TextureFilterMode::LINEAR_MIPMAP_LINEAR: return GL_LINEAR_MIPMAP_LINEAR;
+    }
+    return 0;
+}
+
+// Utility function to convert TextureFilterMode to OpenGL format (Min and Mag Filters)
+static GLint toGLFormat_FilterMode(TextureFilterMode filterMode, bool isMinFilter = true)
+{
+    switch (filterMode)
+    {
+    case TextureFilterMode::LINEAR:
+        return isMinFilter ? GL_LINEAR : GL_LINEAR;
+    case TextureFilterMode::NEAREST:
+        return isMinFilter ? GL_NEAREST : GL_NEAREST;
+    case TextureFilterMode::NEAREST_MIPMAP_NEAREST:
+        return isMinFilter ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST;
+    case TextureFilterMode::NEAREST_MIPMAP_LINEAR:
+        return isMinFilter ? GL_NEAREST_MIPMAP_LINEAR : GL_NEAREST;
+    case TextureFilterMode::LINEAR_MIPMAP_LINEAR:
+        return isMinFilter ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+    }
+    return 0;
+}
+
+// Helper function to set texture parameters
+void Texture2D::setTextureParams(GLuint textureID, const TextureConfig& cfg)
+{
+    if (!Renderer::isGpuBackend()) return;
+
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, toGLFormat_FilterMode(cfg.filterMode, true));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, toGLFormat_FilterMode(cfg.filterMode, false));
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(cfg.wrapModeX));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(cfg.wrapModeY));
+
+    if (cfg.wrapModeX == TextureWrapMode::CLAMP_TO_BORDER || cfg.wrapModeY == TextureWrapMode::CLAMP_TO_BORDER)
+    {
+        glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, &cfg.borderColor[0]);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);  // Unbind the texture
+}
+
+// Formats of the S3TC extension, absent from the core headers
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+// Check whether the min filter samples mip levels
+static bool usesMipmaps(const TextureConfig& cfg)
+{
+    return cfg.generateMipmaps ||
+        cfg.filterMode == TextureFilterMode::NEAREST_MIPMAP_NEAREST ||
+        cfg.filterMode == TextureFilterMode::NEAREST_MIPMAP_LINEAR ||
+        cfg.filterMode == TextureFilterMode::LINEAR_MIPMAP_LINEAR;
+}
+
+// Upload pixels to one level of the currently bound texture
+static void uploadPixels(const unsigned char* data, int width, int height, int nrChannels, int level = 0)
+{
+    GLenum format = (nrChannels == 4) ? GL_RGBA : (nrChannels == 3) ? GL_RGB : GL_RED;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // RGB rows are not always 4-byte aligned
+    glTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+}
+
+// Upload an image to the bound texture, with a CPU-generated mip chain if the config samples mips
+static size_t uploadImage(const TextureImage& image, const TextureConfig& cfg)
+{
+    uploadPixels(image.pixels.data(), image.width, image.height, image.channels);
+    size_t bytes = image.pixels.size();
+    int levels = 1;
+
+    // The context is GL 2.1, glGenerateMipmap is not available
+    if (usesMipmaps(cfg))
+    {
+        std::vector<TextureImage> mips;
+        TextureProcessing::generateMipChain(image, cfg.mipFilter, mips);
+        for (const TextureImage& mip : mips)
+        {
+            uploadPixels(mip.pixels.data(), mip.width, mip.height, mip.channels, levels++);
+            bytes += mip.pixels.size();
+        }
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    return bytes;
+}
+
+// Upload a baked texture to the bound texture, decompressing it if the context lacks the format
+static size_t uploadBaked(const BakedTexture& baked, const TextureConfig& cfg)
+{
+    const bool compressed = baked.format != TextureFormat::RGBA8 && Texture2D::isFormatSupported(baked.format);
+    const GLenum compressedFormat = baked.format == TextureFormat::BC1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    const int levels = usesMipmaps(cfg) ? static_cast<int>(baked.levels.size()) : 1;
+
+    size_t bytes = 0;
+    std::vector<unsigned char> rgba;
+    for (int i = 0; i < levels; ++i)
+    {
+        const TextureLevel& level = baked.levels[i];
+        if (compressed)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D, i, compressedFormat, level.width, level.height, 0,
+                static_cast<GLsizei>(level.data.size()), level.data.data());
+            bytes += level.data.size();
+        }
+        else
+        {
+            TextureProcessing::decodeLevel(baked.format, level, rgba);
+            uploadPixels(rgba.data(), level.width, level.height, 4, i);
+            bytes += rgba.size();
+        }
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    return bytes;
+}
+
+// Load "<path>.sgetex" if it exists and is not older than the source image
+static bool loadBaked(const std::string& path, BakedTexture& baked)
+{
+    namespace fs = std::filesystem;
+
+    std::string bakedPath = path + TextureProcessing::BAKED_EXTENSION;
+    std::error_code error;
+    fs::file_time_type bakedTime = fs::last_write_time(bakedPath, error);
+    if (error) return false;
+
+    fs::file_time_type sourceTime = fs::last_write_time(path, error);
+    if (!error && sourceTime > bakedTime)
+    {
+        SGE_LOG_DEBUG(RENDERER, "{} is out of date, loading the source image", bakedPath);
+        return false;
+    }
+
+    return TextureProcessing::readBaked(bakedPath, baked);
+}
+
+// Create a GPU texture from decoded contents
+static unsigned int uploadTexture(const TextureData& data, int& width, int& height, int& nrChannels, size_t& bytes, const TextureConfig& cfg)
+{
+    unsigned int textureID;
+    glGenTextures(1, &textureID);  // Generate a new texture ID
+    glBindTexture(GL_TEXTURE_2D, textureID);  // Bind the texture for setting parameters
+
+    // Set texture filtering and wrapping parameters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, toGLFormat_FilterMode(cfg.filterMode, true));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, toGLFormat_FilterMode(cfg.filterMode, false));
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(cfg.wrapModeX));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(cfg.wrapModeY));
+
+    if (cfg.wrapModeX == TextureWrapMode::CLAMP_TO_BORDER || cfg.wrapModeY == TextureWrapMode::CLAMP_TO_BORDER)
+    {
+        glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, &cfg.borderColor[0]);
+    }
+
+    // Load the image data into OpenGL
+    if (data.isBaked)
+    {
+        width = data.baked.levels[0].width;
+        height = data.baked.levels[0].height;
+        nrChannels = 4;
+        bytes = uploadBaked(data.baked, cfg);
+    }
+    else
+    {
+        width = data.image.width;
+        height = data.image.height;
+        nrChannels = data.image.channels;
+        bytes = uploadImage(data.image, cfg);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);  // Unbind the texture
+    return textureID;  // Return the generated texture ID
+}
+
+// Unified function to load texture data
+static unsigned int loadTexture(const std::string& path, int& width, int& height, int& nrChannels, size_t& bytes, const TextureConfig& cfg)
+{
+    bytes = 0;
+
+    // Headless: only read the header, there is nowhere to upload the pixels to
+    if (!Renderer::isGpuBackend())
+    {
+        if (stbi_info(path.c_str(), &width, &height, &nrChannels))
+        {
+            return nextHeadlessId++;
+        }
+
+        SGE_LOG_ERROR(RENDERER, "Failed to load texture: {}", path);
+        return 0;
+    }
+
+    TextureData data;
+    if (!Texture2D::decodeFile(path, data))
+    {
+        SGE_LOG_ERROR(RENDERER, "Failed to load texture: {}", path);
+        return 0;  // Return 0 if loading failed
+    }
+
+    return uploadTexture(data, width, height, nrChannels, bytes, cfg);
+}
+
+// Get the OpenGL texture ID
+unsigned int Texture2D::getID() const
+{
+    return id;
+}
+
+// Get the size of the texture
+glm::ivec2 Texture2D::getSize() const
+{
+    return glm::ivec2(width, height);
+}
+
+// Get the path of the texture
+const std::string& Texture2D::getPath() const
+{
+    return path;
+}
+
+// Get the configuration of the texture
+const TextureConfig& Texture2D::getConfig() const
+{
+    return cfg;
+}
+
+// Get the GPU memory used by the texture
+size_t Texture2D::getMemorySize() const
+{
+    return memorySize;
+}
+
+// Method to bind the texture
+void Texture2D::bind() const
+{
+    if (!Renderer::isGpuBackend()) return;
+    glBindTexture(GL_TEXTURE_2D, id);
+}
+
+void Texture2D::setWrapMode(TextureWrapMode wrapX, TextureWrapMode wrapY)
+{
+    cfg.wrapModeX = wrapX;
+    cfg.wrapModeY = wrapY;
+
+    if (!Renderer::isGpuBackend()) return;
+
+    // Bind the texture and update the wrap parameters
+    bind();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLFormat_WrapMode(wrapX));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLFormat_WrapMode(wrapY));
+}
+
+bool Texture2D::decodeImage(const std::string& path, TextureImage& image)
+{
+    // The flip flag is per thread here, so worker threads don't race the main thread
+    stbi_set_flip_vertically_on_load_thread(true);
+
+    unsigned char* data = stbi_load(path.c_str(), &image.width, &image.height, &image.channels, 0);
+    if (!data)
+    {
+        return false;
+    }
+
+    image.pixels.assign(data, data + static_cast<size_t>(image.width) * image.height * image.channels);
+    stbi_image_free(data);
+    return true;
+}
+
+void Texture2D::reload(const TextureImage& image)
+{
+    width = image.width;
+    height = image.height;
+
+    if (!Renderer::isGpuBackend() || id == 0) return;
+
+    // Same texture object, new storage
+    glBindTexture(GL_TEXTURE_2D, id);
+    size_t uploaded = uploadImage(image, cfg);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    setTextureParams(id, cfg);
+
+    if (memorySize > 0) MemoryTracker::recordFree(MemoryTag::GPU_TEXTURE, memorySize);
+    memorySize = uploaded;
+    MemoryTracker::recordAllocation(MemoryTag::GPU_TEXTURE, memorySize);
+}
+
+void Texture2D::updateRegion(const TextureImage& image, int x, int y, int width, int height)
+{
+    if (!Renderer::isGpuBackend() || id == 0 || width <= 0 || height <= 0) return;
+
+    // Read the rectangle straight out of the full image
+    GLenum format = (image.channels == 4) ? GL_RGBA : (image.channels == 3) ? GL_RGB : GL_RED;
+    glBindTexture(GL_TEXTURE_2D, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, image.width);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, image.pixels.data());
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+bool Texture2D::decodeFile(const std::string& path, TextureData& data)
+{
+    // A baked texture already holds its mip chain, possibly compressed
+    data.isBaked = loadBaked(path, data.baked);
+    return data.isBaked || decodeImage(path, data.image);
+}
+
+bool Texture2D::isFormatSupported(TextureFormat format)
+{
+    if (format == TextureFormat::RGBA8) return true;
+    if (!Renderer::isGpuBackend()) return false;
+
+    // BC1 and BC3 both come with S3TC; the context never changes, so query it once
+    static const bool s3tc = []()
+        {
+            const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+            return extensions != nullptr && std::strstr(extensions, "GL_EXT_texture_compression_s3tc") != nullptr;
+        }();
+    return s3tc;
+}
+
+// Initialize the static blank texture pointer
+Texture2D* Texture2D::blankTexture()
+{
+    static Texture2D* blankTexture = nullptr;
+
+    if (!blankTexture)
+    {
+        TextureConfig blankConfig = { TextureWrapMode::CLAMP_TO_BORDER, TextureWrapMode::CLAMP_TO_BORDER, TextureFilterMode::NEAREST };
+        blankTexture = new Texture2D("Blank", blankConfig);
+    }
+
+    return blankTexture;
+}
+
+Texture2D* Texture2D::createTexture(const std::string& path, const TextureConfig& cfg)
+{
+    // The constructor loads the texture, loading it here as well would leak a second GPU texture
+    Texture2D* tex = new Texture2D(path, cfg);
+    if (tex->id == 0)
+    {
+        delete tex;
+        return nullptr;  // If texture load failed, return nullptr
+    }
+
+    return tex;  // Return created texture object
+}
+
+Texture2D* Texture2D::createTexture(const std::string& path, const TextureConfig& cfg, const TextureData& data)
+{
+    Texture2D* tex = new Texture2D(path, cfg, data);
+    if (tex->id == 0)
+    {
+        delete tex;
+        return nullptr;
+    }
+
+    return tex;
+}
+
+// Destructor: Clean up the texture from GPU memory
+Texture2D::~Texture2D()
+{
+    if (Renderer::isGpuBackend()) glDeleteTextures(1, &id);
+    if (memorySize > 0) MemoryTracker::recordFree(MemoryTag::GPU_TEXTURE, memorySize);
+}
+
+// Constructor: Load texture data from file and upload it to the GPU
+Texture2D::Texture2D(const std::string& path, TextureConfig cfg)
+    : path(path), cfg(cfg), id(0), width(0), height(0), memorySize(0) // Initialize member variables
+{
+    int nrChannels;
+    size_t uploaded;
+    id = loadTexture(path, width, height, nrChannels, uploaded, cfg);  // Pass cfg to loadTexture
+    finishLoad(uploaded);
+}
+
+// Constructor: Upload contents decoded elsewhere, typically on a loader thread
+Texture2D::Texture2D(const std::string& path, TextureConfig cfg, const TextureData& data)
+    : path(path), cfg(cfg), id(0), width(0), height(0), memorySize(0)
+{
+    int nrChannels = 0;
+    size_t uploaded = 0;
+    if (Renderer::isGpuBackend())
+    {
+        id = uploadTexture(data, width, height, nrChannels, uploaded, cfg);
+    }
+    else
+    {
+        id = nextHeadlessId++;
+        width = data.isBaked ? data.baked.levels[0].width : data.image.width;
+        height = data.isBaked ? data.baked.levels[0].height : data.image.height;
+    }
+    finishLoad(uploaded);
+}
+
+void Texture2D::finishLoad(size_t uploaded)
+{
+    if (id > 0) {
+        // Successfully loaded, set texture parameters
+        setTextureParams(id, cfg);
+
+        if (uploaded > 0)
+        {
+            // Every mip level, compressed size for compressed formats
+            memorySize = uploaded;
+            MemoryTracker::recordAllocation(MemoryTag::GPU_TEXTURE, memorySize);
+        }
+    }
+}
@@ -1,133 +1,217 @@
-#pragma once
-#include <string>
-#include <glm/vec2.hpp>
-#include <glm/ext/vector_float4.hpp>
-#include <memory>
-#include <glad/glad.h>
-
-namespace ScrapGameEngine
-{
-    /**
-     * @enum TextureWrapMode
-     * @brief Specifies the wrapping mode for a texture.
-     */
-    enum class TextureWrapMode
-    {
-        REPEAT,             /**< Repeats the texture. */
-        CLAMP,              /**< Clamps the texture to the edge. */
-        MIRRORED_REPEAT,    /**< Mirrors the texture when repeating. */
-        CLAMP_TO_BORDER     /**< Clamps the texture and uses a border color. */
-    };
-
-    /**
-     * @enum TextureFilterMode
-     * @brief Specifies the filtering mode for a texture.
-     */
-    enum class TextureFilterMode
-    {
-        LINEAR,                 /**< Linear filtering for smooth textures. */
-        NEAREST,                /**< Nearest-neighbor filtering for pixelated textures. */
-        NEAREST_MIPMAP_NEAREST, /**< Nearest filtering with mipmaps. */
-        LINEAR_MIPMAP_LINEAR,   /**< Linear filtering with mipmaps. */
-        NEAREST_MIPMAP_LINEAR   /**< Nearest texture filtering with linear mipmap blending. */
-    };
-
-    /**
-     * @struct TextureConfig
-     * @brief Configuration options for a texture.
-     */
-    struct TextureConfig
-    {
-        TextureWrapMode wrapModeX = TextureWrapMode::REPEAT; /**< Wrap mode for the X-axis. */
-        TextureWrapMode wrapModeY = TextureWrapMode::REPEAT; /**< Wrap mode for the Y-axis. */
-        TextureFilterMode filterMode = TextureFilterMode::LINEAR; /**< Texture filtering mode. */
-        glm::vec4 borderColor = glm::vec4(0.0f); /**< Border color used when `CLAMP_TO_BORDER` is set. */
-        bool generateMipmaps = false; /**< Indicates if mipmaps should be generated. */
-    };
-
-    /**
-     * @class Texture2D
-     * @brief Represents a 2D texture in the game engine.
-     *
-     * This class provides functionality for creating, configuring, and managing 2D textures.
-     */
-    class Texture2D
-    {
-    public:
-        /**
-         * @brief Returns a blank texture.
-         * @return Pointer to a blank `Texture2D`.
-         */
-        static Texture2D* blankTexture();
-
-        /**
-         * @brief Creates a texture from a given file path and configuration.
-         * @param path The path to the texture file.
-         * @param cfg The configuration for the texture.
-         * @return Pointer to the created `Texture2D`.
-         */
-        static Texture2D* createTexture(const std::string& path, const TextureConfig& cfg);
-
-        /**
-         * @brief Sets the parameters for a texture.
-         * @param textureID The ID of the texture.
-         * @param cfg The configuration to apply.
-         */
-        static void setTextureParams(GLuint textureID, const TextureConfig& cfg);
-
-        /**
-         * @brief Retrieves the OpenGL texture ID.
-         * @return The OpenGL texture ID.
-         */
-        unsigned int getID() const;
-
-        /**
-         * @brief Retrieves the size of the texture.
-         * @return A `glm::ivec2` representing the width and height of the texture.
-         */
-        glm::ivec2 getSize() const;
-
-        /**
-         * @brief Retrieves the path of the texture file.
-         * @return The file path as a string.
-         */
-        const std::string& getPath() const;
-
-        /**
-         * @brief Retrieves the texture configuration.
-         * @return A reference to the `TextureConfig`.
-         */
-        const TextureConfig& getConfig() const;
-
-        /**
-         * @brief Binds the texture to the current OpenGL context.
-         */
-        void bind() const;
-
-        /**
-         * @brief Sets the wrapping mode for the texture.
-         * @param wrapX The wrap mode for the X-axis.
-         * @param wrapY The wrap mode for the Y-axis.
-         */
-        void setWrapMode(TextureWrapMode wrapX, TextureWrapMode wrapY);
-
-        /**
-         * @brief Destructor for the `Texture2D` class.
-         */
-        ~Texture2D();
-
-        /**
-         * @brief Constructs a `Texture2D` with a file path and configuration.
-         * @param path The path to the texture file.
-         * @param cfg The configuration for the texture.
-         */
-        Texture2D(const std::string& path, TextureConfig cfg);
-
-    private:
-        TextureConfig cfg; /**< The configuration of the texture. */
-        std::string path; /**< The file path of the texture. */
-        unsigned int id; /**< The OpenGL texture ID. */
-        int width; /**< The width of the texture in pixels. */
-        int height; /**< The height of the texture in pixels. */
-    };
-}
+#pragma once
+#include <string>
+#include <glm/vec2.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <memory>
+#include <vector>
+#include <glad/glad.h>
+#include "TextureProcessing.h"
+
+namespace ScrapGameEngine
+{
+    /**
+     * @enum TextureWrapMode
+     * @brief Specifies the wrapping mode for a texture.
+     */
+    enum class TextureWrapMode
+    {
+        REPEAT,             /**< Repeats the texture. */
+        CLAMP,              /**< Clamps the texture to the edge. */
+        MIRRORED_REPEAT,    /**< Mirrors the texture when repeating. */
+        CLAMP_TO_BORDER     /**< Clamps the texture and uses a border color. */
+    };
+
+    /**
+     * @enum TextureFilterMode
+     * @brief Specifies the filtering mode for a texture.
+     */
+    enum class TextureFilterMode
+    {
+        LINEAR,                 /**< Linear filtering for smooth textures. */
+        NEAREST,                /**< Nearest-neighbor filtering for pixelated textures. */
+        NEAREST_MIPMAP_NEAREST, /**< Nearest filtering with mipmaps. */
+        LINEAR_MIPMAP_LINEAR,   /**< Linear filtering with mipmaps. */
+        NEAREST_MIPMAP_LINEAR   /**< Nearest texture filtering with linear mipmap blending. */
+    };
+
+    /**
+     * @struct TextureConfig
+     * @brief Configuration options for a texture.
+     */
+    struct TextureConfig
+    {
+        TextureWrapMode wrapModeX = TextureWrapMode::REPEAT; /**< Wrap mode for the X-axis. */
+        TextureWrapMode wrapModeY = TextureWrapMode::REPEAT; /**< Wrap mode for the Y-axis. */
+        TextureFilterMode filterMode = TextureFilterMode::LINEAR; /**< Texture filtering mode. */
+        glm::vec4 borderColor = glm::vec4(0.0f); /**< Border color used when `CLAMP_TO_BORDER` is set. */
+        bool generateMipmaps = false; /**< Indicates if mipmaps should be generated. Implied by the mipmap filter modes. */
+        MipFilter mipFilter = MipFilter::BOX; /**< Filter used when mipmaps are generated at load time. */
+    };
+
+    /**
+     * @class Texture2D
+     * @brief Represents a 2D texture in the game engine.
+     *
+     * This class provides functionality for creating, configuring, and managing 2D textures.
+     */
+    class Texture2D
+    {
+    public:
+        /**
+         * @brief Returns a blank texture.
+         * @return Pointer to a blank `Texture2D`.
+         */
+        static Texture2D* blankTexture();
+
+        /**
+         * @brief Creates a texture from a given file path and configuration.
+         * @param path The path to the texture file.
+         * @param cfg The configuration for the texture.
+         * @return Pointer to the created `Texture2D`.
+         */
+        static Texture2D* createTexture(const std::string& path, const TextureConfig& cfg);
+
+        /**
+         * @brief Creates a texture from contents already read with decodeFile().
+         * @param path The path the contents were read from, used as the texture's path.
+         * @param cfg The configuration for the texture.
+         * @param data The decoded contents.
+         * @return Pointer to the created `Texture2D`, or null if the upload failed.
+         */
+        static Texture2D* createTexture(const std::string& path, const TextureConfig& cfg, const TextureData& data);
+
+        /**
+         * @brief Sets the parameters for a texture.
+         * @param textureID The ID of the texture.
+         * @param cfg The configuration to apply.
+         */
+        static void setTextureParams(GLuint textureID, const TextureConfig& cfg);
+
+        /**
+         * @brief Decodes an image file into memory. Safe to call from any thread.
+         * @param path The path to the image file.
+         * @param image Receives the pixels.
+         * @return False if the file could not be decoded.
+         */
+        static bool decodeImage(const std::string& path, TextureImage& image);
+
+        /**
+         * @brief Reads a texture the way createTexture() does, without touching the GPU.
+         *
+         * An up-to-date `<path>.sgetex` is preferred over the source image. Safe to call from any thread.
+         *
+         * @param path The path to the image file.
+         * @param data Receives the contents.
+         * @return False if neither file could be read.
+         */
+        static bool decodeFile(const std::string& path, TextureData& data);
+
+        /**
+         * @brief Checks whether the graphics context can sample a texture format directly.
+         *
+         * Baked textures in unsupported formats are decompressed on the CPU when loaded.
+         *
+         * @param format The format.
+         * @return True if the format can be uploaded as is.
+         */
+        static bool isFormatSupported(TextureFormat format);
+
+        /**
+         * @brief Replaces the pixels of the texture, keeping its ID. Call on the main thread.
+         *
+         * Everything holding this texture, by pointer or handle, sees the new image.
+         *
+         * @param image The decoded image.
+         */
+        void reload(const TextureImage& image);
+
+        /**
+         * @brief Uploads one rectangle of an image the size of the texture. Call on the main thread.
+         *
+         * Only level 0 is updated, meant for textures without mipmaps that change in place.
+         *
+         * @param image The full image, the same size as the texture.
+         * @param x Left column of the rectangle.
+         * @param y First row of the rectangle.
+         * @param width Width of the rectangle.
+         * @param height Height of the rectangle.
+         */
+        void updateRegion(const TextureImage& image, int x, int y, int width, int height);
+
+        /**
+         * @brief Retrieves the OpenGL texture ID.
+         * @return The OpenGL texture ID.
+         */
+        unsigned int getID() const;
+
+        /**
+         * @brief Retrieves the size of the texture.
+         * @return A `glm::ivec2` representing the width and height of the texture.
+         */
+        glm::ivec2 getSize() const;
+
+        /**
+         * @brief Retrieves the path of the texture file.
+         * @return The file path as a string.
+         */
+        const std::string& getPath() const;
+
+        /**
+         * @brief Retrieves the texture configuration.
+         * @return A reference to the `TextureConfig`.
+         */
+        const TextureConfig& getConfig() const;
+
+        /**
+         * @brief Retrieves the size of the texture storage on the GPU.
+         * @return The size in bytes, 0 when nothing was uploaded.
+         */
+        size_t getMemorySize() const;
+
+        /**
+         * @brief Binds the texture to the current OpenGL context.
+         */
+        void bind() const;
+
+        /**
+         * @brief Sets the wrapping mode for the texture.
+         * @param wrapX The wrap mode for the X-axis.
+         * @param wrapY The wrap mode for the Y-axis.
+         */
+        void setWrapMode(TextureWrapMode wrapX, TextureWrapMode wrapY);
+
+        /**
+         * @brief Destructor for the `Texture2D` class.
+         */
+        ~Texture2D();
+
+        /**
+         * @brief Constructs a `Texture2D` with a file path and configuration.
+         * @param path The path to the texture file.
+         * @param cfg The configuration for the texture.
+         */
+        Texture2D(const std::string& path, TextureConfig cfg);
+
+        /**
+         * @brief Constructs a `Texture2D` from contents already read from disk.
+         * @param path The path the contents were read from.
+         * @param cfg The configuration for the texture.
+         * @param data The decoded contents.
+         */
+        Texture2D(const std::string& path, TextureConfig cfg, const TextureData& data);
+
+    private:
+        TextureConfig cfg; /**< The configuration of the texture. */
+        std::string path; /**< The file path of the texture. */
+        unsigned int id; /**< The OpenGL texture ID. */
+        int width; /**< The width of the texture in pixels. */
+        int height; /**< The height of the texture in pixels. */
+        size_t memorySize; /**< Bytes uploaded to the GPU, all mip levels included. */
+
+        /**
+         * @brief Applies the parameters and records the GPU memory after the upload.
+         * @param uploaded Bytes uploaded.
+         */
+        void finishLoad(size_t uploaded);
+    };
+}
@@ -0,0 +1,727 @@
+#include "TextureProcessing.h"
+#include "Texture2D.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGE_TEXTURE_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const uint32_t BAKED_MAGIC = 0x54454753; // "SGET"
+    const uint32_t BAKED_VERSION = 1;
+
+    // Box filter ------------------------------------------------------------------
+
+    void boxDownsample(const TextureImage& source, TextureImage& target)
+    {
+        const int channels = source.channels;
+        const int sourceRow = source.width * channels;
+
+        for (int y = 0; y < target.height; ++y)
+        {
+            // Odd sizes drop the last row or column, clamping keeps 1-pixel sides valid
+            const unsigned char* row0 = &source.pixels[std::min(2 * y, source.height - 1) * sourceRow];
+            const unsigned char* row1 = &source.pixels[std::min(2 * y + 1, source.height - 1) * sourceRow];
+            unsigned char* out = &target.pixels[y * target.width * channels];
+
+            int x = 0;
+#ifdef SGE_TEXTURE_SSE2
+            if (channels == 4)
+            {
+                // Two output pixels from 4x2 source pixels per iteration
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i rounding = _mm_set1_epi16(2);
+                for (; x + 2 <= target.width && 2 * x + 3 < source.width; x += 2)
+                {
+                    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 8 * x));
+                    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 8 * x));
+
+                    __m128i left = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+                    __m128i right = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+                    left = _mm_add_epi16(left, _mm_srli_si128(left, 8));
+                    right = _mm_add_epi16(right, _mm_srli_si128(right, 8));
+
+                    __m128i sum = _mm_unpacklo_epi64(left, right);
+                    sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 4 * x), _mm_packus_epi16(sum, zero));
+                }
+            }
+#endif
+            for (; x < target.width; ++x)
+            {
+                const int x0 = std::min(2 * x, source.width - 1) * channels;
+                const int x1 = std::min(2 * x + 1, source.width - 1) * channels;
+                for (int c = 0; c < channels; ++c)
+                {
+                    out[x * channels + c] = static_cast<unsigned char>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+                }
+            }
+        }
+    }
+
+    // Kaiser filter ---------------------------------------------------------------
+
+    const double KAISER_WIDTH = 3.0; // Support in output pixels
+    const double KAISER_ALPHA = 4.0;
+    const double PI = 3.14159265358979323846;
+
+    double besselI0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+            if (term < sum * 1e-12) break;
+        }
+        return sum;
+    }
+
+    double kaiserSinc(double x)
+    {
+        double t = x / KAISER_WIDTH;
+        if (t <= -1.0 || t >= 1.0) return 0.0;
+
+        double sinc = (x == 0.0) ? 1.0 : std::sin(PI * x) / (PI * x);
+        return sinc * besselI0(KAISER_ALPHA * std::sqrt(1.0 - t * t)) / besselI0(KAISER_ALPHA);
+    }
+
+    struct Tap
+    {
+        int index;
+        float weight;
+    };
+
+    // Normalized filter taps of every output pixel along one axis
+    void buildKernel(int sourceSize, int targetSize, std::vector<std::vector<Tap>>& kernel)
+    {
+        const double scale = static_cast<double>(sourceSize) / targetSize;
+        kernel.assign(targetSize, {});
+
+        for (int t = 0; t < targetSize; ++t)
+        {
+            const double center = (t + 0.5) * scale;
+            const int first = static_cast<int>(std::floor(center - KAISER_WIDTH * scale));
+            const int last = static_cast<int>(std::ceil(center + KAISER_WIDTH * scale));
+
+            double total = 0.0;
+            for (int s = first; s <= last; ++s)
+            {
+                double weight = kaiserSinc((s + 0.5 - center) / scale);
+                if (weight == 0.0) continue;
+
+                kernel[t].push_back({ std::min(std::max(s, 0), sourceSize - 1), static_cast<float>(weight) });
+                total += weight;
+            }
+            for (Tap& tap : kernel[t])
+            {
+                tap.weight = static_cast<float>(tap.weight / total);
+            }
+        }
+    }
+
+    void kaiserDownsample(const TextureImage& source, TextureImage& target)
+    {
+        const int channels = source.channels;
+        std::vector<std::vector<Tap>> horizontal, vertical;
+        buildKernel(source.width, target.width, horizontal);
+        buildKernel(source.height, target.height, vertical);
+
+        // Horizontal pass into floats, then vertical pass into bytes
+        std::vector<float> rows(static_cast<size_t>(source.height) * target.width * channels);
+        for (int y = 0; y < source.height; ++y)
+        {
+            const unsigned char* in = &source.pixels[y * source.width * channels];
+            float* out = &rows[y * target.width * channels];
+            for (int x = 0; x < target.width; ++x)
+            {
+                for (const Tap& tap : horizontal[x])
+                {
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        out[x * channels + c] += tap.weight * in[tap.index * channels + c];
+                    }
+                }
+            }
+        }
+
+        std::vector<float> sum(channels);
+        for (int y = 0; y < target.height; ++y)
+        {
+            for (int x = 0; x < target.width; ++x)
+            {
+                std::fill(sum.begin(), sum.end(), 0.0f);
+                for (const Tap& tap : vertical[y])
+                {
+                    const float* in = &rows[(tap.index * target.width + x) * channels];
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        sum[c] += tap.weight * in[c];
+                    }
+                }
+
+                // The negative lobes can overshoot
+                unsigned char* out = &target.pixels[(y * target.width + x) * channels];
+                for (int c = 0; c < channels; ++c)
+                {
+                    out[c] = static_cast<unsigned char>(std::min(std::max(sum[c] + 0.5f, 0.0f), 255.0f));
+                }
+            }
+        }
+    }
+
+    // Block compression -----------------------------------------------------------
+
+    uint16_t to565(int r, int g, int b)
+    {
+        return static_cast<uint16_t>((((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255));
+    }
+
+    void from565(uint16_t color, int rgb[3])
+    {
+        int r = (color >> 11) & 31;
+        int g = (color >> 5) & 63;
+        int b = color & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    void write16(unsigned char* out, uint16_t value)
+    {
+        out[0] = static_cast<unsigned char>(value & 0xFF);
+        out[1] = static_cast<unsigned char>(value >> 8);
+    }
+
+    uint16_t read16(const unsigned char* in)
+    {
+        return static_cast<uint16_t>(in[0] | (in[1] << 8));
+    }
+
+    // Copies a 4x4 block of RGBA pixels, repeating the edge pixels of partial blocks
+    void fetchBlock(const unsigned char* rgba, int width, int height, int blockX, int blockY, unsigned char block[64])
+    {
+        for (int py = 0; py < 4; ++py)
+        {
+            int y = std::min(blockY * 4 + py, height - 1);
+            for (int px = 0; px < 4; ++px)
+            {
+                int x = std::min(blockX * 4 + px, width - 1);
+                std::memcpy(&block[(py * 4 + px) * 4], &rgba[(y * width + x) * 4], 4);
+            }
+        }
+    }
+
+    void colorPalette(uint16_t c0, uint16_t c1, bool fourColors, int palette[4][3])
+    {
+        from565(c0, palette[0]);
+        from565(c1, palette[1]);
+        for (int c = 0; c < 3; ++c)
+        {
+            if (fourColors)
+            {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+            else
+            {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+    }
+
+    // Endpoints from the bounding box of the block, along the diagonal the colors follow
+    void encodeColorBlock(const unsigned char block[64], unsigned char out[8])
+    {
+        int lo[3] = { 255, 255, 255 };
+        int hi[3] = { 0, 0, 0 };
+        int mean[3] = { 0, 0, 0 };
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                lo[c] = std::min(lo[c], static_cast<int>(block[i * 4 + c]));
+                hi[c] = std::max(hi[c], static_cast<int>(block[i * 4 + c]));
+                mean[c] += block[i * 4 + c];
+            }
+        }
+
+        // Green and blue falling while red rises means the box's other diagonal
+        int covRG = 0, covRB = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            int r = block[i * 4] * 16 - mean[0];
+            covRG += r * (block[i * 4 + 1] * 16 - mean[1]) / 256;
+            covRB += r * (block[i * 4 + 2] * 16 - mean[2]) / 256;
+        }
+        if (covRG < 0) std::swap(lo[1], hi[1]);
+        if (covRB < 0) std::swap(lo[2], hi[2]);
+
+        // Pull the endpoints in slightly, the extremes are rarely the best fit
+        for (int c = 0; c < 3; ++c)
+        {
+            int inset = (hi[c] - lo[c]) / 16;
+            hi[c] -= inset;
+            lo[c] += inset;
+        }
+
+        uint16_t c0 = to565(hi[0], hi[1], hi[2]);
+        uint16_t c1 = to565(lo[0], lo[1], lo[2]);
+        if (c0 < c1) std::swap(c0, c1); // c0 > c1 selects the four-color mode
+
+        write16(out, c0);
+        write16(out + 2, c1);
+
+        uint32_t indices = 0;
+        if (c0 != c1)
+        {
+            int palette[4][3];
+            colorPalette(c0, c1, true, palette);
+            for (int i = 0; i < 16; ++i)
+            {
+                int best = 0;
+                int bestError = 0x7FFFFFFF;
+                for (int p = 0; p < 4; ++p)
+                {
+                    int dr = block[i * 4] - palette[p][0];
+                    int dg = block[i * 4 + 1] - palette[p][1];
+                    int db = block[i * 4 + 2] - palette[p][2];
+                    int error = dr * dr + dg * dg + db * db;
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        best = p;
+                    }
+                }
+                indices |= static_cast<uint32_t>(best) << (2 * i);
+            }
+        }
+
+        for (int b = 0; b < 4; ++b)
+        {
+            out[4 + b] = static_cast<unsigned char>(indices >> (8 * b));
+        }
+    }
+
+    void alphaPalette(int a0, int a1, int palette[8])
+    {
+        palette[0] = a0;
+        palette[1] = a1;
+        if (a0 > a1)
+        {
+            for (int i = 1; i < 7; ++i)
+            {
+                palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+            }
+        }
+        else
+        {
+            for (int i = 1; i < 5; ++i)
+            {
+                palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            }
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+    }
+
+    void encodeAlphaBlock(const unsigned char block[64], unsigned char out[8])
+    {
+        int a0 = 0, a1 = 255;
+        for (int i = 0; i < 16; ++i)
+        {
+            a0 = std::max(a0, static_cast<int>(block[i * 4 + 3]));
+            a1 = std::min(a1, static_cast<int>(block[i * 4 + 3]));
+        }
+
+        out[0] = static_cast<unsigned char>(a0);
+        out[1] = static_cast<unsigned char>(a1);
+
+        uint64_t indices = 0;
+        if (a0 != a1)
+        {
+            int palette[8];
+            alphaPalette(a0, a1, palette);
+            for (int i = 0; i < 16; ++i)
+            {
+                int best = 0;
+                int bestError = 256;
+                for (int p = 0; p < 8; ++p)
+                {
+                    int error = std::abs(block[i * 4 + 3] - palette[p]);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        best = p;
+                    }
+                }
+                indices |= static_cast<uint64_t>(best) << (3 * i);
+            }
+        }
+
+        for (int b = 0; b < 6; ++b)
+        {
+            out[2 + b] = static_cast<unsigned char>(indices >> (8 * b));
+        }
+    }
+
+    void decodeColorBlock(const unsigned char* in, bool forceFourColors, unsigned char block[64])
+    {
+        uint16_t c0 = read16(in);
+        uint16_t c1 = read16(in + 2);
+        int palette[4][3];
+        bool fourColors = forceFourColors || c0 > c1;
+        colorPalette(c0, c1, fourColors, palette);
+
+        uint32_t indices = in[4] | (in[5] << 8) | (in[6] << 16) | (static_cast<uint32_t>(in[7]) << 24);
+        for (int i = 0; i < 16; ++i)
+        {
+            int p = (indices >> (2 * i)) & 3;
+            block[i * 4] = static_cast<unsigned char>(palette[p][0]);
+            block[i * 4 + 1] = static_cast<unsigned char>(palette[p][1]);
+            block[i * 4 + 2] = static_cast<unsigned char>(palette[p][2]);
+            block[i * 4 + 3] = (!fourColors && p == 3) ? 0 : 255;
+        }
+    }
+
+    void decodeAlphaBlock(const unsigned char* in, unsigned char block[64])
+    {
+        int palette[8];
+        alphaPalette(in[0], in[1], palette);
+
+        uint64_t indices = 0;
+        for (int b = 0; b < 6; ++b)
+        {
+            indices |= static_cast<uint64_t>(in[2 + b]) << (8 * b);
+        }
+        for (int i = 0; i < 16; ++i)
+        {
+            block[i * 4 + 3] = static_cast<unsigned char>(palette[(indices >> (3 * i)) & 7]);
+        }
+    }
+
+    void storeBlock(const unsigned char block[64], int width, int height, int blockX, int blockY, unsigned char* rgba)
+    {
+        for (int py = 0; py < 4 && blockY * 4 + py < height; ++py)
+        {
+            for (int px = 0; px < 4 && blockX * 4 + px < width; ++px)
+            {
+                std::memcpy(&rgba[((blockY * 4 + py) * width + blockX * 4 + px) * 4], &block[(py * 4 + px) * 4], 4);
+            }
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ofstream& file, T value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream& file, T& value)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+}
+
+bool TextureProcessing::isImageFile(const std::string& path)
+{
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) return false;
+
+    std::string extension = path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == "png" || extension == "jpg" || extension == "jpeg" || extension == "bmp" || extension == "tga";
+}
+
+TextureImage TextureProcessing::downsample(const TextureImage& source, MipFilter filter)
+{
+    TextureImage target;
+    target.width = std::max(1, source.width / 2);
+    target.height = std::max(1, source.height / 2);
+    target.channels = source.channels;
+    target.pixels.assign(static_cast<size_t>(target.width) * target.height * target.channels, 0);
+
+    if (filter == MipFilter::KAISER)
+    {
+        kaiserDownsample(source, target);
+    }
+    else
+    {
+        boxDownsample(source, target);
+    }
+    return target;
+}
+
+void TextureProcessing::generateMipChain(const TextureImage& base, MipFilter filter, std::vector<TextureImage>& mips)
+{
+    SGE_PROFILE_SCOPE("TextureProcessing::generateMipChain");
+
+    mips.clear();
+    const TextureImage* previous = &base;
+    while (previous->width > 1 || previous->height > 1)
+    {
+        // Each level is filtered from the one above, not from the base
+        mips.push_back(downsample(*previous, filter));
+        previous = &mips.back();
+    }
+}
+
+TextureImage TextureProcessing::toRGBA(const TextureImage& source)
+{
+    if (source.channels == 4) return source;
+
+    TextureImage target;
+    target.width = source.width;
+    target.height = source.height;
+    target.channels = 4;
+    target.pixels.resize(static_cast<size_t>(source.width) * source.height * 4);
+
+    const size_t count = static_cast<size_t>(source.width) * source.height;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const unsigned char* in = &source.pixels[i * source.channels];
+        unsigned char* out = &target.pixels[i * 4];
+        switch (source.channels)
+        {
+        case 1: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+        case 2: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+        default: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 255; break;
+        }
+    }
+    return target;
+}
+
+size_t TextureProcessing::getLevelSize(TextureFormat format, int width, int height)
+{
+    const size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+    switch (format)
+    {
+    case TextureFormat::BC1: return blocks * 8;
+    case TextureFormat::BC3: return blocks * 16;
+    default: return static_cast<size_t>(width) * height * 4;
+    }
+}
+
+void TextureProcessing::encodeBC1(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& blocks)
+{
+    blocks.resize(getLevelSize(TextureFormat::BC1, width, height));
+
+    unsigned char block[64];
+    unsigned char* out = blocks.data();
+    for (int by = 0; by < (height + 3) / 4; ++by)
+    {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx, out += 8)
+        {
+            fetchBlock(rgba, width, height, bx, by, block);
+            encodeColorBlock(block, out);
+        }
+    }
+}
+
+void TextureProcessing::encodeBC3(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& blocks)
+{
+    blocks.resize(getLevelSize(TextureFormat::BC3, width, height));
+
+    unsigned char block[64];
+    unsigned char* out = blocks.data();
+    for (int by = 0; by < (height + 3) / 4; ++by)
+    {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx, out += 16)
+        {
+            fetchBlock(rgba, width, height, bx, by, block);
+            encodeAlphaBlock(block, out);
+            encodeColorBlock(block, out + 8);
+        }
+    }
+}
+
+void TextureProcessing::decodeBC1(const unsigned char* blocks, int width, int height, std::vector<unsigned char>& rgba)
+{
+    rgba.resize(static_cast<size_t>(width) * height * 4);
+
+    unsigned char block[64];
+    for (int by = 0; by < (height + 3) / 4; ++by)
+    {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx, blocks += 8)
+        {
+            decodeColorBlock(blocks, false, block);
+            storeBlock(block, width, height, bx, by, rgba.data());
+        }
+    }
+}
+
+void TextureProcessing::decodeBC3(const unsigned char* blocks, int width, int height, std::vector<unsigned char>& rgba)
+{
+    rgba.resize(static_cast<size_t>(width) * height * 4);
+
+    unsigned char block[64];
+    for (int by = 0; by < (height + 3) / 4; ++by)
+    {
+        for (int bx = 0; bx < (width + 3) / 4; ++bx, blocks += 16)
+        {
+            // BC3 color blocks are always in four-color mode
+            decodeColorBlock(blocks + 8, true, block);
+            decodeAlphaBlock(blocks, block);
+            storeBlock(block, width, height, bx, by, rgba.data());
+        }
+    }
+}
+
+void TextureProcessing::decodeLevel(TextureFormat format, const TextureLevel& level, std::vector<unsigned char>& rgba)
+{
+    switch (format)
+    {
+    case TextureFormat::BC1: decodeBC1(level.data.data(), level.width, level.height, rgba); break;
+    case TextureFormat::BC3: decodeBC3(level.data.data(), level.width, level.height, rgba); break;
+    default: rgba = level.data; break;
+    }
+}
+
+void TextureProcessing::bake(const TextureImage& image, TextureFormat format, bool mipmaps, MipFilter filter, BakedTexture& baked)
+{
+    SGE_PROFILE_SCOPE("TextureProcessing::bake");
+
+    std::vector<TextureImage> images;
+    images.push_back(toRGBA(image));
+    if (mipmaps)
+    {
+        std::vector<TextureImage> mips;
+        generateMipChain(images[0], filter, mips);
+        images.insert(images.end(), mips.begin(), mips.end());
+    }
+
+    baked.format = format;
+    baked.levels.resize(images.size());
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        TextureLevel& level = baked.levels[i];
+        level.width = images[i].width;
+        level.height = images[i].height;
+        switch (format)
+        {
+        case TextureFormat::BC1: encodeBC1(images[i].pixels.data(), level.width, level.height, level.data); break;
+        case TextureFormat::BC3: encodeBC3(images[i].pixels.data(), level.width, level.height, level.data); break;
+        default: level.data = images[i].pixels; break;
+        }
+    }
+}
+
+bool TextureProcessing::writeBaked(const std::string& path, const BakedTexture& baked)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        SGE_LOG_ERROR(RENDERER, "Cannot write baked texture {}", path);
+        return false;
+    }
+
+    writeValue(file, BAKED_MAGIC);
+    writeValue(file, BAKED_VERSION);
+    writeValue(file, static_cast<uint32_t>(baked.format));
+    writeValue(file, static_cast<uint32_t>(baked.levels.size()));
+    for (const TextureLevel& level : baked.levels)
+    {
+        writeValue(file, static_cast<int32_t>(level.width));
+        writeValue(file, static_cast<int32_t>(level.height));
+        writeValue(file, static_cast<uint32_t>(level.data.size()));
+        file.write(reinterpret_cast<const char*>(level.data.data()), level.data.size());
+    }
+    return static_cast<bool>(file);
+}
+
+bool TextureProcessing::readBaked(const std::string& path, BakedTexture& baked)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    uint32_t magic = 0, version = 0, format = 0, levelCount = 0;
+    if (!readValue(file, magic) || magic != BAKED_MAGIC || !readValue(file, version) || version != BAKED_VERSION ||
+        !readValue(file, format) || format > static_cast<uint32_t>(TextureFormat::BC3) ||
+        !readValue(file, levelCount) || levelCount == 0 || levelCount > 32)
+    {
+        SGE_LOG_ERROR(RENDERER, "Invalid baked texture {}", path);
+        return false;
+    }
+
+    baked.format = static_cast<TextureFormat>(format);
+    baked.levels.resize(levelCount);
+    for (TextureLevel& level : baked.levels)
+    {
+        int32_t width = 0, height = 0;
+        uint32_t size = 0;
+        if (!readValue(file, width) || !readValue(file, height) || !readValue(file, size) ||
+            width <= 0 || height <= 0 || size != getLevelSize(baked.format, width, height))
+        {
+            SGE_LOG_ERROR(RENDERER, "Invalid baked texture {}", path);
+            return false;
+        }
+
+        level.width = width;
+        level.height = height;
+        level.data.resize(size);
+        if (!file.read(reinterpret_cast<char*>(level.data.data()), size))
+        {
+            SGE_LOG_ERROR(RENDERER, "Truncated baked texture {}", path);
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t TextureProcessing::bakeDirectory(const std::string& directory)
+{
+    namespace fs = std::filesystem;
+
+    size_t count = 0;
+    std::error_code error;
+    fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error))
+    {
+        if (!it->is_regular_file(error)) continue;
+
+        std::string path = it->path().generic_string();
+        if (!isImageFile(path)) continue;
+
+        TextureImage image;
+        if (!Texture2D::decodeImage(path, image))
+        {
+            SGE_LOG_ERROR(RENDERER, "Cannot decode {}", path);
+            continue;
+        }
+
+        // Grey+alpha and RGBA images need the alpha block
+        TextureFormat format = (image.channels == 2 || image.channels == 4) ? TextureFormat::BC3 : TextureFormat::BC1;
+
+        BakedTexture baked;
+        bake(image, format, true, MipFilter::KAISER, baked);
+        if (writeBaked(path + BAKED_EXTENSION, baked))
+        {
+            SGE_LOG_INFO(RENDERER, "Baked {} ({}, {} levels)", path, format == TextureFormat::BC3 ? "BC3" : "BC1", baked.levels.size());
+            count++;
+        }
+    }
+    return count;
+}
+
+bool TextureProcessing::isSimdCompiledIn()
+{
+#ifdef SGE_TEXTURE_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
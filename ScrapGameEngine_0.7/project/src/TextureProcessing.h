@@ -0,0 +1,231 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @struct TextureImage
+     * @brief Decoded pixels of an image file, ready to be uploaded.
+     */
+    struct TextureImage
+    {
+        std::vector<unsigned char> pixels; /**< Rows bottom to top, one byte per channel. */
+        int width = 0; /**< The width in pixels. */
+        int height = 0; /**< The height in pixels. */
+        int channels = 0; /**< The number of channels, 1 to 4. */
+    };
+
+    /**
+     * @enum MipFilter
+     * @brief Specifies the filter used to downsample mip levels.
+     */
+    enum class MipFilter
+    {
+        BOX,    /**< Average of 2x2 pixels. Fast, slightly blurry. */
+        KAISER  /**< Windowed sinc. Sharper, used for baked textures. */
+    };
+
+    /**
+     * @enum TextureFormat
+     * @brief Storage format of a baked texture.
+     */
+    enum class TextureFormat : uint32_t
+    {
+        RGBA8 = 0,  /**< Uncompressed, 4 bytes per pixel. */
+        BC1 = 1,    /**< DXT1, opaque RGB, 8 bytes per 4x4 block. */
+        BC3 = 2     /**< DXT5, RGB with smooth alpha, 16 bytes per 4x4 block. */
+    };
+
+    /**
+     * @struct TextureLevel
+     * @brief One mip level of a baked texture.
+     */
+    struct TextureLevel
+    {
+        int width = 0; /**< The width in pixels. */
+        int height = 0; /**< The height in pixels. */
+        std::vector<unsigned char> data; /**< Pixels or compressed blocks. */
+    };
+
+    /**
+     * @struct BakedTexture
+     * @brief A texture with its mip chain in a GPU format, as stored in `.sgetex` files.
+     */
+    struct BakedTexture
+    {
+        TextureFormat format = TextureFormat::RGBA8; /**< Format of every level. */
+        std::vector<TextureLevel> levels; /**< Level 0 is the full-size image. */
+    };
+
+    /**
+     * @struct TextureData
+     * @brief Texture contents read from disk, either a decoded image or a baked texture.
+     */
+    struct TextureData
+    {
+        TextureImage image; /**< Decoded pixels, used when `isBaked` is false. */
+        BakedTexture baked; /**< Baked levels, used when `isBaked` is true. */
+        bool isBaked = false; /**< True if the texture came from a `.sgetex` file. */
+
+        /**
+         * @brief Gets the size in memory of the contents.
+         * @return The size in bytes.
+         */
+        size_t getByteSize() const
+        {
+            if (!isBaked) return image.pixels.size();
+
+            size_t bytes = 0;
+            for (const TextureLevel& level : baked.levels) bytes += level.data.size();
+            return bytes;
+        }
+    };
+
+    /**
+     * @class TextureProcessing
+     * @brief CPU side of the texture pipeline: mip generation and block compression.
+     *
+     * Everything here works on plain memory and needs no graphics context, so the
+     * pipeline can run offline (see bakeDirectory()) and be verified on the CPU; the
+     * decoders are exact inverses of what the GPU does with BC1 and BC3 blocks.
+     */
+    class TextureProcessing
+    {
+    public:
+        TextureProcessing() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Extension of baked texture files, appended to the source path.
+         */
+        static constexpr const char* BAKED_EXTENSION = ".sgetex";
+
+        /**
+         * @brief Checks whether a file is an image format the loader decodes.
+         * @param path The file path.
+         * @return True for png, jpg, jpeg, bmp and tga files.
+         */
+        static bool isImageFile(const std::string& path);
+
+        /**
+         * @brief Halves an image in both dimensions, down to 1 pixel.
+         * @param source The image to downsample.
+         * @param filter The downsampling filter.
+         * @return The next mip level, with the same channel count.
+         */
+        static TextureImage downsample(const TextureImage& source, MipFilter filter);
+
+        /**
+         * @brief Builds every mip level below an image, ending with a 1x1 level.
+         * @param base The full-size image.
+         * @param filter The downsampling filter.
+         * @param mips Receives the levels, largest first, not including the base.
+         */
+        static void generateMipChain(const TextureImage& base, MipFilter filter, std::vector<TextureImage>& mips);
+
+        /**
+         * @brief Expands an image to 4 channels. Grey images become grey, missing alpha becomes opaque.
+         * @param source The image.
+         * @return The RGBA image.
+         */
+        static TextureImage toRGBA(const TextureImage& source);
+
+        /**
+         * @brief Gets the storage size of one level.
+         * @param format The format.
+         * @param width The width in pixels.
+         * @param height The height in pixels.
+         * @return The size in bytes.
+         */
+        static size_t getLevelSize(TextureFormat format, int width, int height);
+
+        /**
+         * @brief Compresses RGBA pixels to BC1 blocks.
+         * @param rgba The pixels, 4 bytes each.
+         * @param width The width in pixels, any size.
+         * @param height The height in pixels, any size.
+         * @param blocks Receives getLevelSize(BC1, width, height) bytes.
+         */
+        static void encodeBC1(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& blocks);
+
+        /**
+         * @brief Compresses RGBA pixels to BC3 blocks.
+         * @param rgba The pixels, 4 bytes each.
+         * @param width The width in pixels, any size.
+         * @param height The height in pixels, any size.
+         * @param blocks Receives getLevelSize(BC3, width, height) bytes.
+         */
+        static void encodeBC3(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& blocks);
+
+        /**
+         * @brief Decompresses BC1 blocks to RGBA pixels.
+         * @param blocks The blocks.
+         * @param width The width in pixels.
+         * @param height The height in pixels.
+         * @param rgba Receives width * height * 4 bytes.
+         */
+        static void decodeBC1(const unsigned char* blocks, int width, int height, std::vector<unsigned char>& rgba);
+
+        /**
+         * @brief Decompresses BC3 blocks to RGBA pixels.
+         * @param blocks The blocks.
+         * @param width The width in pixels.
+         * @param height The height in pixels.
+         * @param rgba Receives width * height * 4 bytes.
+         */
+        static void decodeBC3(const unsigned char* blocks, int width, int height, std::vector<unsigned char>& rgba);
+
+        /**
+         * @brief Decompresses a baked level to RGBA pixels, for contexts without the format.
+         * @param format The format of the level.
+         * @param level The level.
+         * @param rgba Receives the pixels.
+         */
+        static void decodeLevel(TextureFormat format, const TextureLevel& level, std::vector<unsigned char>& rgba);
+
+        /**
+         * @brief Converts an image to a baked texture.
+         * @param image The full-size image.
+         * @param format The target format.
+         * @param mipmaps True to include the full mip chain.
+         * @param filter The mip filter.
+         * @param baked Receives the texture.
+         */
+        static void bake(const TextureImage& image, TextureFormat format, bool mipmaps, MipFilter filter, BakedTexture& baked);
+
+        /**
+         * @brief Writes a baked texture to a `.sgetex` file.
+         * @param path The file path.
+         * @param baked The texture.
+         * @return False if the file could not be written.
+         */
+        static bool writeBaked(const std::string& path, const BakedTexture& baked);
+
+        /**
+         * @brief Reads a `.sgetex` file.
+         * @param path The file path.
+         * @param baked Receives the texture.
+         * @return False if the file is missing or malformed.
+         */
+        static bool readBaked(const std::string& path, BakedTexture& baked);
+
+        /**
+         * @brief Bakes every image under a directory next to its source, as `<source>.sgetex`.
+         *
+         * Images with an alpha channel become BC3, others BC1, both with Kaiser-filtered mips.
+         * Texture2D loads the baked file instead of the source while it is up to date.
+         *
+         * @param directory The asset directory.
+         * @return The number of textures baked.
+         */
+        static size_t bakeDirectory(const std::string& directory);
+
+        /**
+         * @brief Checks whether the box filter uses SSE2.
+         * @return True if the SIMD path was compiled in.
+         */
+        static bool isSimdCompiledIn();
+    };
+}
@@ -1,31 +1,96 @@
-#include "Time.h"
-#include <glfw/glfw3.h>
-
-static float currentTime = 0.0f;
-static float prevTime = 0.0f;
-static float deltaTime = 0.0f;
-
-float ScrapGameEngine::Time::getTime()
-{
-	return currentTime;
-}
-
-float ScrapGameEngine::Time::getDeltaTime()
-{
-	return deltaTime;
-}
-
-void ScrapGameEngine::Time::processTime(float frameTime)
-{
-	currentTime = (float)glfwGetTime();
-	deltaTime = currentTime - prevTime;
-
-	do
-	{
-		currentTime = (float)glfwGetTime();
-		deltaTime = currentTime - prevTime;
-	} while (deltaTime < frameTime);
-
-    prevTime = currentTime;
-}
-
+#include "Time.h"
+#include "Clock.h"
+#include "FrameLimiter.h"
+#include "Profiler.h"
+#include <algorithm>
+
+static float currentTime = 0.0f;
+static double prevTime = -1.0;
+static float deltaTime = 0.0f;
+static float fixedDeltaTime = 0.0f;
+static float maxDeltaTime = 0.25f;
+static float interpolationAlpha = 1.0f;
+
+static ScrapGameEngine::HighResolutionClock defaultClock;
+static ScrapGameEngine::IClock* activeClock = &defaultClock;
+static ScrapGameEngine::FrameLimiter limiter;
+
+float ScrapGameEngine::Time::getTime()
+{
+	return currentTime;
+}
+
+float ScrapGameEngine::Time::getDeltaTime()
+{
+	return deltaTime;
+}
+
+void ScrapGameEngine::Time::processTime(float frameTime)
+{
+	SGE_PROFILE_SCOPE("Time::processTime");
+
+	limiter.setTargetFrameTime(frameTime);
+	double now = limiter.waitForNextFrame(*activeClock);
+
+	// Measure against the previous frame, the first frame has no delta
+	double delta = prevTime < 0.0 ? 0.0 : now - prevTime;
+	deltaTime = std::min((float)delta, maxDeltaTime);
+	currentTime = (float)now;
+
+	prevTime = now;
+}
+
+void ScrapGameEngine::Time::advanceTime(float delta)
+{
+	deltaTime = delta;
+	currentTime += delta;
+}
+
+void ScrapGameEngine::Time::setClock(IClock* clock)
+{
+	activeClock = clock ? clock : &defaultClock;
+
+	// The new clock has its own epoch
+	prevTime = -1.0;
+	limiter.reset();
+}
+
+ScrapGameEngine::IClock& ScrapGameEngine::Time::getClock()
+{
+	return *activeClock;
+}
+
+ScrapGameEngine::FrameLimiter& ScrapGameEngine::Time::getFrameLimiter()
+{
+	return limiter;
+}
+
+float ScrapGameEngine::Time::getFixedDeltaTime()
+{
+	return fixedDeltaTime;
+}
+
+void ScrapGameEngine::Time::setFixedDeltaTime(float fixedDelta)
+{
+	fixedDeltaTime = std::max(fixedDelta, 0.0f);
+}
+
+float ScrapGameEngine::Time::getMaxDeltaTime()
+{
+	return maxDeltaTime;
+}
+
+void ScrapGameEngine::Time::setMaxDeltaTime(float maxDelta)
+{
+	maxDeltaTime = std::max(maxDelta, 0.0f);
+}
+
+float ScrapGameEngine::Time::getInterpolationAlpha()
+{
+	return interpolationAlpha;
+}
+
+void ScrapGameEngine::Time::setInterpolationAlpha(float alpha)
+{
+	interpolationAlpha = std::clamp(alpha, 0.0f, 1.0f);
+}
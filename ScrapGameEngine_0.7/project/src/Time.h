@@ -1,33 +1,111 @@
-#pragma once
-namespace ScrapGameEngine
-{
-    namespace Time
-    {
-        /**
-         * @brief Get the current time in seconds.
-         *
-         * This function retrieves the current time in seconds since the application started.
-         *
-         * @return The current time as a float.
-         */
-        float getTime();
-
-        /**
-         * @brief Get the time difference between frames.
-         *
-         * This function calculates the time difference between the current frame and the previous frame, commonly known as the delta time.
-         *
-         * @return The delta time in seconds as a float.
-         */
-        float getDeltaTime();
-
-        /**
-         * @brief Process the time for the current frame.
-         *
-         * This function updates the time state with the given frame time. It should be called each frame during the application loop to manage time-based behaviors.
-         *
-         * @param frameTime The time taken to process the current frame in seconds.
-         */
-        void processTime(float frameTime);
-    };
-}
+#pragma once
+namespace ScrapGameEngine
+{
+    class IClock;
+    class FrameLimiter;
+
+    namespace Time
+    {
+        /**
+         * @brief Get the current time in seconds.
+         *
+         * This function retrieves the current time in seconds since the application started.
+         *
+         * @return The current time as a float.
+         */
+        float getTime();
+
+        /**
+         * @brief Get the time difference between frames.
+         *
+         * This function calculates the time difference between the current frame and the previous frame, commonly known as the delta time.
+         *
+         * @return The delta time in seconds as a float.
+         */
+        float getDeltaTime();
+
+        /**
+         * @brief Process the time for the current frame.
+         *
+         * This function updates the time state with the given frame time. It should be called each frame during the application loop to manage time-based behaviors.
+         * When a frame time is given, it waits with a sleep-then-spin limiter until the frame is due.
+         * The resulting delta time is clamped to `getMaxDeltaTime()` so a stall does not explode the simulation.
+         *
+         * @param frameTime The target duration of a frame in seconds, or 0 for no limit.
+         */
+        void processTime(float frameTime);
+
+        /**
+         * @brief Advance the time by an exact delta instead of measuring the clock.
+         *
+         * Used by frame replays so that every frame sees the recorded delta time bit for bit.
+         *
+         * @param deltaTime The delta time of the frame in seconds.
+         */
+        void advanceTime(float deltaTime);
+
+        /**
+         * @brief Set the clock used for timing.
+         *
+         * Passing nullptr restores the default high resolution clock. The clock must outlive its use.
+         *
+         * @param clock The clock to use.
+         */
+        void setClock(IClock* clock);
+
+        /**
+         * @brief Get the clock used for timing.
+         * @return Reference to the active clock.
+         */
+        IClock& getClock();
+
+        /**
+         * @brief Get the frame limiter, e.g. to inspect frame pacing statistics.
+         * @return Reference to the frame limiter.
+         */
+        FrameLimiter& getFrameLimiter();
+
+        /**
+         * @brief Get the fixed simulation time step.
+         * @return The fixed time step in seconds, or 0 if the simulation uses variable steps.
+         */
+        float getFixedDeltaTime();
+
+        /**
+         * @brief Set the fixed simulation time step.
+         * @param fixedDeltaTime The fixed time step in seconds, or 0 to use variable steps.
+         */
+        void setFixedDeltaTime(float fixedDeltaTime);
+
+        /**
+         * @brief Get the largest delta time a single frame may report.
+         * @return The maximum delta time in seconds.
+         */
+        float getMaxDeltaTime();
+
+        /**
+         * @brief Set the largest delta time a single frame may report.
+         * @param maxDeltaTime The maximum delta time in seconds.
+         */
+        void setMaxDeltaTime(float maxDeltaTime);
+
+        /**
+         * @brief Get how far the render frame lies between the last two simulation steps.
+         *
+         * 0 means the state of the previous step, 1 the state of the latest step. Always 1 when
+         * the simulation uses variable steps.
+         *
+         * @return The interpolation factor in the range [0, 1].
+         */
+        float getInterpolationAlpha();
+
+        /**
+         * @brief Set the interpolation factor for the current render frame.
+         *
+         * Called by the application loop after running the simulation steps of a frame.
+         *
+         * @param alpha The interpolation factor in the range [0, 1].
+         */
+        void setInterpolationAlpha(float alpha);
+    };
+}
@@ -0,0 +1,154 @@
+#include "Timeline.h"
+#include "Log.h"
+#include <algorithm>
+#include <limits>
+
+using namespace ScrapGameEngine;
+
+Timeline::Timeline()
+{
+    Node root{};
+    root.type = NodeType::SEQUENCE;
+    nodes.push_back(std::move(root));
+    openGroups.push_back(0);
+}
+
+Timeline& Timeline::tween(GameObject* object, TweenType type, const glm::vec4& target, float duration, EasingType easingType)
+{
+    Node node{};
+    node.type = NodeType::TWEEN;
+    node.object = object;
+    node.tweenType = type;
+    node.easingType = easingType;
+    node.target = target;
+    node.duration = std::max(duration, 0.0f);
+    append(std::move(node));
+    return *this;
+}
+
+Timeline& Timeline::delay(float seconds)
+{
+    Node node{};
+    node.type = NodeType::DELAY;
+    node.duration = std::max(seconds, 0.0f);
+    append(std::move(node));
+    return *this;
+}
+
+Timeline& Timeline::call(std::function<void()> callback)
+{
+    Node node{};
+    node.type = NodeType::CALL;
+    node.callback = std::move(callback);
+    append(std::move(node));
+    return *this;
+}
+
+Timeline& Timeline::beginSequence()
+{
+    Node node{};
+    node.type = NodeType::SEQUENCE;
+    openGroups.push_back(append(std::move(node)));
+    return *this;
+}
+
+Timeline& Timeline::beginParallel()
+{
+    Node node{};
+    node.type = NodeType::PARALLEL;
+    openGroups.push_back(append(std::move(node)));
+    return *this;
+}
+
+Timeline& Timeline::end()
+{
+    // The root sequence stays open
+    if (openGroups.size() > 1)
+    {
+        openGroups.pop_back();
+    }
+    else
+    {
+        SGE_LOG_WARN(GAMEOBJECT, "Timeline::end called without an open group");
+    }
+    return *this;
+}
+
+Timeline& Timeline::repeat(int count, bool yoyo)
+{
+    std::vector<uint32_t>& siblings = nodes[openGroups.back()].children;
+    if (siblings.empty() || count == 0)
+    {
+        SGE_LOG_WARN(GAMEOBJECT, "Timeline::repeat has nothing to repeat");
+        return *this;
+    }
+
+    // The repeat takes the place of the entry it wraps
+    Node node{};
+    node.type = NodeType::REPEAT;
+    node.count = count < 0 ? -1 : count;
+    node.yoyo = yoyo;
+    node.children.push_back(siblings.back());
+    nodes.push_back(std::move(node));
+    nodes[openGroups.back()].children.back() = static_cast<uint32_t>(nodes.size() - 1);
+    return *this;
+}
+
+Timeline& Timeline::onComplete(std::function<void()> callback)
+{
+    completion = std::move(callback);
+    return *this;
+}
+
+uint32_t Timeline::append(Node node)
+{
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(std::move(node));
+    nodes[openGroups.back()].children.push_back(index);
+    return index;
+}
+
+float Timeline::getDuration(uint32_t index) const
+{
+    const Node& node = nodes[index];
+    float duration = 0.0f;
+
+    switch (node.type)
+    {
+    case NodeType::TWEEN:
+    case NodeType::DELAY:
+        duration = node.duration;
+        break;
+
+    case NodeType::CALL:
+        break;
+
+    case NodeType::SEQUENCE:
+        for (uint32_t child : node.children)
+        {
+            duration += getDuration(child);
+        }
+        break;
+
+    case NodeType::PARALLEL:
+        for (uint32_t child : node.children)
+        {
+            duration = std::max(duration, getDuration(child));
+        }
+        break;
+
+    case NodeType::REPEAT:
+        duration = getDuration(node.children[0]);
+        if (node.count < 0 && duration > 0.0f)
+        {
+            duration = std::numeric_limits<float>::infinity();
+        }
+        else
+        {
+            duration *= static_cast<float>(std::max(node.count, 1));
+        }
+        break;
+    }
+
+    return duration;
+}
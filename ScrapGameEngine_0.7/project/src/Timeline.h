@@ -0,0 +1,154 @@
+#pragma once
+#include "TweenComponent.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <glm/vec4.hpp>
+
+namespace ScrapGameEngine
+{
+    class GameObject;
+
+    /**
+     * @class Timeline
+     * @brief Describes an animation made of tweens, delays and events arranged in sequences and parallel groups.
+     *
+     * A timeline is built once and played with `TweenSystem::play`, which returns a handle to pause,
+     * seek or cancel it. Playback is a function of time, so seeking lands on the same values as
+     * playing up to that point. The timeline itself is a sequence; `beginSequence` and
+     * `beginParallel` open nested groups closed by `end`. Tweens start from the value the previous
+     * tween of the same property in the timeline ends on, or from the property's value when played.
+     *
+     * @code
+     * Timeline pulse;
+     * pulse.beginSequence()
+     *          .tween(button, TweenType::SCALE, { 1.2f, 1.2f, 0.0f, 0.0f }, 0.2f, EasingType::EASE_OUT)
+     *          .tween(button, TweenType::SCALE, { 1.0f, 1.0f, 0.0f, 0.0f }, 0.2f, EasingType::EASE_IN)
+     *      .end().repeat(3)
+     *      .call([] { SGE_LOG_INFO(GAME, "Pulsed"); });
+     * uint64_t handle = TweenSystem::play(pulse);
+     * @endcode
+     */
+    class Timeline
+    {
+    public:
+        /**
+         * @brief Creates an empty timeline.
+         */
+        Timeline();
+
+        /**
+         * @brief Appends a tween to the open group.
+         * @param object The animated object, which must outlive the timeline or cancel it when destroyed.
+         * @param type The property, as for `TweenSystem::start`.
+         * @param target The end value: xy for POSITION and SCALE, x for ROTATION in degrees and FADE, rgb for COLOR.
+         * @param duration The duration in seconds, 0 to set the value at once.
+         * @param easingType The easing curve.
+         * @return This timeline.
+         */
+        Timeline& tween(GameObject* object, TweenType type, const glm::vec4& target, float duration, EasingType easingType = EasingType::LINEAR);
+
+        /**
+         * @brief Appends a pause to the open group.
+         * @param seconds The delay in seconds.
+         * @return This timeline.
+         */
+        Timeline& delay(float seconds);
+
+        /**
+         * @brief Appends an event, invoked each time playback passes it. Seeking does not invoke it.
+         * @param callback The callback.
+         * @return This timeline.
+         */
+        Timeline& call(std::function<void()> callback);
+
+        /**
+         * @brief Opens a group whose children play one after another.
+         * @return This timeline.
+         */
+        Timeline& beginSequence();
+
+        /**
+         * @brief Opens a group whose children play together, lasting as long as the longest.
+         * @return This timeline.
+         */
+        Timeline& beginParallel();
+
+        /**
+         * @brief Closes the innermost open group.
+         * @return This timeline.
+         */
+        Timeline& end();
+
+        /**
+         * @brief Repeats the entry appended last, a whole group once it was closed.
+         * @param count The number of plays, -1 to repeat forever.
+         * @param yoyo True to play every other repetition backwards.
+         * @return This timeline.
+         */
+        Timeline& repeat(int count, bool yoyo = false);
+
+        /**
+         * @brief Sets the callback invoked when playback reaches the end. Cancelling does not invoke it.
+         * @param callback The callback.
+         * @return This timeline.
+         */
+        Timeline& onComplete(std::function<void()> callback);
+
+        /**
+         * @brief Gets the length of one play.
+         * @return The duration in seconds, infinite if something repeats forever.
+         */
+        float getDuration() const { return getDuration(0); }
+
+    private:
+        friend class TweenSystem; ///< Plays the nodes.
+
+        /** @brief What a node does. */
+        enum class NodeType : uint8_t
+        {
+            TWEEN,      ///< Animates one property.
+            DELAY,      ///< Waits.
+            CALL,       ///< Invokes a callback.
+            SEQUENCE,   ///< Plays its children one after another.
+            PARALLEL,   ///< Plays its children together.
+            REPEAT      ///< Plays its single child several times.
+        };
+
+        /**
+         * @struct Node
+         * @brief One entry of the timeline.
+         */
+        struct Node
+        {
+            NodeType type;                      ///< What the node does.
+            GameObject* object = nullptr;       ///< TWEEN: animated object.
+            TweenType tweenType = TweenType::POSITION; ///< TWEEN: animated property.
+            EasingType easingType = EasingType::LINEAR; ///< TWEEN: easing curve.
+            glm::vec4 target{ 0.0f };           ///< TWEEN: end value.
+            float duration = 0.0f;              ///< TWEEN and DELAY: length in seconds.
+            int count = 1;                      ///< REPEAT: plays, -1 forever.
+            bool yoyo = false;                  ///< REPEAT: play odd repetitions backwards.
+            std::function<void()> callback;     ///< CALL: event.
+            std::vector<uint32_t> children;     ///< Groups: child nodes in order.
+        };
+
+        /**
+         * @brief Appends a node to the open group.
+         * @param node The node.
+         * @return The node index.
+         */
+        uint32_t append(Node node);
+
+        /**
+         * @brief Computes the length of one play of a node.
+         * @param node The node index.
+         * @return The duration in seconds.
+         */
+        float getDuration(uint32_t node) const;
+
+        std::vector<Node> nodes;            ///< All nodes, the root sequence first.
+        std::vector<uint32_t> openGroups;   ///< Groups receiving new nodes, innermost last.
+        std::function<void()> completion;   ///< Invoked when playback reaches the end.
+    };
+}
@@ -0,0 +1,852 @@
+#include "TweenSystem.h"
+#include "GameObject.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace ScrapGameEngine;
+
+std::array<TweenSystem::Batch, TweenSystem::TRACK_COUNT * TweenSystem::EASING_COUNT> TweenSystem::batches;
+std::unordered_map<uint64_t, TweenSystem::Location> TweenSystem::locations;
+std::unordered_map<uintptr_t, uint64_t> TweenSystem::trackTweens;
+std::unordered_map<uint64_t, TweenSystem::TimelineInstance> TweenSystem::timelines;
+std::unordered_multimap<GameObject*, uint64_t> TweenSystem::objectTimelines;
+uint64_t TweenSystem::nextId = 1;
+
+namespace
+{
+    constexpr float TWO_PI = 6.28318530717958647692f;
+    constexpr float ELASTIC_PERIOD = 0.3f;
+    constexpr float ELASTIC_SHIFT = ELASTIC_PERIOD / 4.0f;
+    constexpr float MIN_DURATION = 1e-6f;
+    constexpr float BEFORE_START = -1.0f;
+}
+
+bool TweenSystem::resolve(GameObject* object, TweenType type, const glm::vec4& target, Track& track, void*& component, glm::vec4& from, glm::vec4& to)
+{
+    component = object->transform;
+    from = glm::vec4(0.0f);
+    to = glm::vec4(0.0f);
+
+    switch (type)
+    {
+    case TweenType::POSITION:
+        track = Track::POSITION;
+        from = glm::vec4(object->transform->localPosition, 0.0f, 0.0f);
+        to = glm::vec4(target.x, target.y, 0.0f, 0.0f);
+        return true;
+
+    case TweenType::SCALE:
+        track = Track::SCALE;
+        from = glm::vec4(object->transform->localScale, 0.0f, 0.0f);
+        to = glm::vec4(target.x, target.y, 0.0f, 0.0f);
+        return true;
+
+    case TweenType::ROTATION:
+        track = Track::ROTATION;
+        from.x = object->transform->localRotation;
+        to.x = target.x;
+        return true;
+
+    case TweenType::FADE:
+        if (auto* sprite = object->getComponent<SpriteRenderer>())
+        {
+            track = Track::SPRITE_OPACITY;
+            component = sprite;
+            from.x = sprite->_opacity;
+            to.x = glm::clamp(target.x, 0.0f, 1.0f);
+            return true;
+        }
+        SGE_LOG_WARN(GAMEOBJECT, "Cannot fade {}, it has no SpriteRenderer", object->getName());
+        return false;
+
+    case TweenType::COLOR:
+        to = glm::vec4(target.x, target.y, target.z, 0.0f);
+        if (auto* sprite = object->getComponent<SpriteRenderer>())
+        {
+            track = Track::SPRITE_COLOR;
+            component = sprite;
+            from = glm::vec4(sprite->_color, 0.0f);
+            return true;
+        }
+        if (auto* button = object->getComponent<Button>())
+        {
+            track = Track::BUTTON_COLOR;
+            component = button;
+            from = button->_color;
+            return true;
+        }
+        SGE_LOG_WARN(GAMEOBJECT, "Cannot tween the color of {}, it has no SpriteRenderer or Button", object->getName());
+        return false;
+    }
+
+    return false;
+}
+
+uint64_t TweenSystem::start(GameObject* object, TweenType type, const glm::vec4& target, float duration,
+    EasingType easingType, std::function<void()> onComplete)
+{
+    Track track;
+    void* component;
+    glm::vec4 from;
+    glm::vec4 to;
+    if (!object || !resolve(object, type, target, track, component, from, to))
+    {
+        return 0;
+    }
+
+    // One tween per property, the new one continues from where the old one stopped
+    auto previous = trackTweens.find(trackKey(object, track));
+    if (previous != trackTweens.end())
+    {
+        cancel(previous->second);
+    }
+
+    size_t easing = static_cast<size_t>(easingType);
+    if (easing >= EASING_COUNT)
+    {
+        easing = static_cast<size_t>(EasingType::LINEAR);
+    }
+
+    uint32_t batchIndex = static_cast<uint32_t>(static_cast<size_t>(track) * EASING_COUNT + easing);
+    Batch& batch = batches[batchIndex];
+    uint64_t id = nextId++;
+
+    batch.ids.push_back(id);
+    batch.objects.push_back(object);
+    batch.targets.push_back(component);
+    batch.from.push_back(from);
+    batch.to.push_back(to);
+    batch.elapsed.push_back(0.0f);
+    batch.inverseDuration.push_back(1.0f / std::max(duration, MIN_DURATION));
+    batch.rate.push_back(1.0f);
+    batch.progress.push_back(0.0f);
+    batch.callbacks.push_back(std::move(onComplete));
+
+    locations[id] = { batchIndex, static_cast<uint32_t>(batch.ids.size() - 1) };
+    trackTweens[trackKey(object, track)] = id;
+    return id;
+}
+
+uint64_t TweenSystem::play(const Timeline& timeline)
+{
+    uint64_t id = nextId++;
+    TimelineInstance& instance = timelines[id];
+    instance.timeline = timeline;
+    instance.states.resize(timeline.nodes.size());
+
+    std::unordered_map<uintptr_t, glm::vec4> ends;
+    prepare(instance, 0, 0.0f, ends);
+    instance.duration = instance.states[0].duration;
+
+    // The timeline owns the properties it animates while it plays
+    for (const auto& end : ends)
+    {
+        auto tween = trackTweens.find(end.first);
+        if (tween != trackTweens.end())
+        {
+            cancel(tween->second);
+        }
+    }
+
+    for (GameObject* object : instance.objects)
+    {
+        objectTimelines.emplace(object, id);
+    }
+    return id;
+}
+
+bool TweenSystem::cancel(uint64_t id)
+{
+    auto it = locations.find(id);
+    if (it != locations.end())
+    {
+        remove(it->second.batch, it->second.index);
+        return true;
+    }
+
+    auto timeline = timelines.find(id);
+    if (timeline != timelines.end())
+    {
+        removeTimeline(timeline);
+        return true;
+    }
+    return false;
+}
+
+bool TweenSystem::pause(uint64_t id)
+{
+    auto it = locations.find(id);
+    if (it != locations.end())
+    {
+        batches[it->second.batch].rate[it->second.index] = 0.0f;
+        return true;
+    }
+
+    auto timeline = timelines.find(id);
+    if (timeline != timelines.end())
+    {
+        timeline->second.paused = true;
+        return true;
+    }
+    return false;
+}
+
+bool TweenSystem::resume(uint64_t id)
+{
+    auto it = locations.find(id);
+    if (it != locations.end())
+    {
+        batches[it->second.batch].rate[it->second.index] = 1.0f;
+        return true;
+    }
+
+    auto timeline = timelines.find(id);
+    if (timeline != timelines.end())
+    {
+        timeline->second.paused = false;
+        return true;
+    }
+    return false;
+}
+
+bool TweenSystem::seek(uint64_t id, float time)
+{
+    auto it = locations.find(id);
+    if (it != locations.end())
+    {
+        Batch& batch = batches[it->second.batch];
+        uint32_t index = it->second.index;
+        float duration = 1.0f / batch.inverseDuration[index];
+        batch.elapsed[index] = std::min(std::max(time, 0.0f), duration);
+
+        float progress = batch.elapsed[index] * batch.inverseDuration[index];
+        ease(static_cast<EasingType>(it->second.batch % EASING_COUNT), &progress, 1);
+        write(static_cast<Track>(it->second.batch / EASING_COUNT), batch.targets[index], batch.from[index], batch.to[index], progress);
+        return true;
+    }
+
+    auto timeline = timelines.find(id);
+    if (timeline != timelines.end())
+    {
+        TimelineInstance& instance = timeline->second;
+        instance.time = std::min(std::max(time, 0.0f), instance.duration);
+        evaluate(instance, 0, instance.time, nullptr);
+        return true;
+    }
+    return false;
+}
+
+float TweenSystem::getTime(uint64_t id)
+{
+    auto it = locations.find(id);
+    if (it != locations.end())
+    {
+        return batches[it->second.batch].elapsed[it->second.index];
+    }
+
+    auto timeline = timelines.find(id);
+    return timeline != timelines.end() ? timeline->second.time : 0.0f;
+}
+
+void TweenSystem::cancelAll(GameObject* object)
+{
+    for (size_t track = 0; track < TRACK_COUNT; ++track)
+    {
+        auto it = trackTweens.find(trackKey(object, static_cast<Track>(track)));
+        if (it != trackTweens.end())
+        {
+            cancel(it->second);
+        }
+    }
+
+    // Removing a timeline edits the multimap, take the IDs first
+    auto range = objectTimelines.equal_range(object);
+    if (range.first != range.second)
+    {
+        std::vector<uint64_t> ids;
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            ids.push_back(it->second);
+        }
+        for (uint64_t id : ids)
+        {
+            cancel(id);
+        }
+    }
+}
+
+void TweenSystem::setPaused(GameObject* object, bool paused)
+{
+    for (size_t track = 0; track < TRACK_COUNT; ++track)
+    {
+        auto it = trackTweens.find(trackKey(object, static_cast<Track>(track)));
+        if (it != trackTweens.end())
+        {
+            const Location& location = locations[it->second];
+            batches[location.batch].rate[location.index] = paused ? 0.0f : 1.0f;
+        }
+    }
+
+    auto range = objectTimelines.equal_range(object);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        timelines[it->second].paused = paused;
+    }
+}
+
+bool TweenSystem::isAnimating(GameObject* object)
+{
+    for (size_t track = 0; track < TRACK_COUNT; ++track)
+    {
+        if (trackTweens.count(trackKey(object, static_cast<Track>(track))))
+        {
+            return true;
+        }
+    }
+    return objectTimelines.count(object) != 0;
+}
+
+void TweenSystem::update(float deltaTime)
+{
+    if (locations.empty() && timelines.empty())
+    {
+        return;
+    }
+
+    SGE_PROFILE_SCOPE("TweenSystem::update");
+
+    // Callbacks run once every batch is consistent, they may start or cancel tweens
+    std::vector<std::function<void()>> completed;
+    std::vector<uint32_t> finished;
+
+    for (uint32_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex)
+    {
+        Batch& batch = batches[batchIndex];
+        const size_t count = batch.ids.size();
+        if (count == 0)
+        {
+            continue;
+        }
+
+        float* elapsed = batch.elapsed.data();
+        const float* inverseDuration = batch.inverseDuration.data();
+        const float* rate = batch.rate.data();
+        float* progress = batch.progress.data();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            elapsed[i] += deltaTime * rate[i];
+            progress[i] = std::min(elapsed[i] * inverseDuration[i], 1.0f);
+        }
+
+        ease(static_cast<EasingType>(batchIndex % EASING_COUNT), progress, count);
+
+        // Finished tweens land exactly on their target whatever the curve
+        finished.clear();
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (elapsed[i] * inverseDuration[i] >= 1.0f)
+            {
+                progress[i] = 1.0f;
+                finished.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        apply(static_cast<Track>(batchIndex / EASING_COUNT), batch);
+
+        // Descending, so the swapped in tween was already checked
+        for (auto it = finished.rbegin(); it != finished.rend(); ++it)
+        {
+            if (batch.callbacks[*it])
+            {
+                completed.push_back(std::move(batch.callbacks[*it]));
+            }
+            remove(batchIndex, *it);
+        }
+    }
+
+    for (auto it = timelines.begin(); it != timelines.end();)
+    {
+        TimelineInstance& instance = it->second;
+        if (instance.paused)
+        {
+            ++it;
+            continue;
+        }
+
+        instance.time = std::min(instance.time + deltaTime, instance.duration);
+        evaluate(instance, 0, instance.time, &completed);
+
+        if (instance.time >= instance.duration)
+        {
+            if (instance.timeline.completion)
+            {
+                completed.push_back(std::move(instance.timeline.completion));
+            }
+            it = removeTimeline(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto& callback : completed)
+    {
+        callback();
+    }
+}
+
+void TweenSystem::ease(EasingType easingType, float* values, size_t count)
+{
+    // One loop per curve so the branch is taken once per batch, not once per tween
+    switch (easingType)
+    {
+    case EasingType::EASE_IN:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            values[i] = t * t;
+        }
+        break;
+
+    case EasingType::EASE_OUT:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            values[i] = t * (2.0f - t);
+        }
+        break;
+
+    case EasingType::EASE_IN_OUT:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            values[i] = t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+        }
+        break;
+
+    case EasingType::EASE_IN_BACK:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            values[i] = t * t * (3.0f - 2.0f * t);
+        }
+        break;
+
+    case EasingType::EASE_OUT_BACK:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i] - 1.0f;
+            values[i] = t * t * (3.0f + 2.0f * t) + 1.0f;
+        }
+        break;
+
+    case EasingType::EASE_IN_ELASTIC:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i] - 1.0f;
+            values[i] = -std::exp2(10.0f * t) * std::sin((t - ELASTIC_SHIFT) * TWO_PI / ELASTIC_PERIOD);
+        }
+        break;
+
+    case EasingType::EASE_OUT_ELASTIC:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            values[i] = std::exp2(-10.0f * t) * std::sin((t - ELASTIC_SHIFT) * TWO_PI / ELASTIC_PERIOD) + 1.0f;
+        }
+        break;
+
+    case EasingType::EASE_IN_OUT_BOUNCE:
+        for (size_t i = 0; i < count; ++i)
+        {
+            float t = values[i];
+            float u = 1.0f - 2.0f * t;
+            float v = 2.0f * t - 1.0f;
+            values[i] = t < 0.5f ? (1.0f - u * u) * 0.5f : v * v * 0.5f + 0.5f;
+        }
+        break;
+
+    default: // NONE and LINEAR leave the progress as it is
+        break;
+    }
+}
+
+void TweenSystem::apply(Track track, Batch& batch)
+{
+    const size_t count = batch.ids.size();
+    void* const* targets = batch.targets.data();
+    const glm::vec4* from = batch.from.data();
+    const glm::vec4* to = batch.to.data();
+    const float* progress = batch.progress.data();
+
+    switch (track)
+    {
+    case Track::POSITION:
+        for (size_t i = 0; i < count; ++i)
+        {
+            static_cast<Transform*>(targets[i])->localPosition = glm::vec2(from[i] + (to[i] - from[i]) * progress[i]);
+        }
+        break;
+
+    case Track::SCALE:
+        for (size_t i = 0; i < count; ++i)
+        {
+            static_cast<Transform*>(targets[i])->localScale = glm::vec2(from[i] + (to[i] - from[i]) * progress[i]);
+        }
+        break;
+
+    case Track::ROTATION:
+        for (size_t i = 0; i < count; ++i)
+        {
+            static_cast<Transform*>(targets[i])->localRotation = from[i].x + (to[i].x - from[i].x) * progress[i];
+        }
+        break;
+
+    case Track::SPRITE_COLOR:
+        for (size_t i = 0; i < count; ++i)
+        {
+            static_cast<SpriteRenderer*>(targets[i])->_color = glm::vec3(from[i] + (to[i] - from[i]) * progress[i]);
+        }
+        break;
+
+    case Track::SPRITE_OPACITY:
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Overshooting curves must not leave the valid range
+            float opacity = from[i].x + (to[i].x - from[i].x) * progress[i];
+            static_cast<SpriteRenderer*>(targets[i])->_opacity = std::min(std::max(opacity, 0.0f), 1.0f);
+        }
+        break;
+
+    case Track::BUTTON_COLOR:
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec4& color = static_cast<Button*>(targets[i])->_color;
+            color = glm::vec4(glm::vec3(from[i] + (to[i] - from[i]) * progress[i]), color.a);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void TweenSystem::write(Track track, void* component, const glm::vec4& from, const glm::vec4& to, float progress)
+{
+    glm::vec4 value = from + (to - from) * progress;
+
+    switch (track)
+    {
+    case Track::POSITION:
+        static_cast<Transform*>(component)->localPosition = glm::vec2(value);
+        break;
+
+    case Track::SCALE:
+        static_cast<Transform*>(component)->localScale = glm::vec2(value);
+        break;
+
+    case Track::ROTATION:
+        static_cast<Transform*>(component)->localRotation = value.x;
+        break;
+
+    case Track::SPRITE_COLOR:
+        static_cast<SpriteRenderer*>(component)->_color = glm::vec3(value);
+        break;
+
+    case Track::SPRITE_OPACITY:
+        static_cast<SpriteRenderer*>(component)->_opacity = std::min(std::max(value.x, 0.0f), 1.0f);
+        break;
+
+    case Track::BUTTON_COLOR:
+    {
+        glm::vec4& color = static_cast<Button*>(component)->_color;
+        color = glm::vec4(glm::vec3(value), color.a);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void TweenSystem::prepare(TimelineInstance& instance, uint32_t index, float start, std::unordered_map<uintptr_t, glm::vec4>& ends)
+{
+    const Timeline::Node& node = instance.timeline.nodes[index];
+    NodeState& state = instance.states[index];
+    state.start = start;
+
+    switch (node.type)
+    {
+    case Timeline::NodeType::TWEEN:
+        state.duration = node.duration;
+        if (node.object && resolve(node.object, node.tweenType, node.target, state.track, state.component, state.from, state.to))
+        {
+            // Visited in playback order, so each tween continues from the one before it
+            uintptr_t key = trackKey(node.object, state.track);
+            auto previous = ends.find(key);
+            if (previous != ends.end())
+            {
+                state.from = previous->second;
+            }
+            ends[key] = state.to;
+
+            if (std::find(instance.objects.begin(), instance.objects.end(), node.object) == instance.objects.end())
+            {
+                instance.objects.push_back(node.object);
+            }
+        }
+        break;
+
+    case Timeline::NodeType::DELAY:
+        state.duration = node.duration;
+        break;
+
+    case Timeline::NodeType::CALL:
+        state.duration = 0.0f;
+        break;
+
+    case Timeline::NodeType::SEQUENCE:
+    {
+        float offset = 0.0f;
+        for (uint32_t child : node.children)
+        {
+            prepare(instance, child, offset, ends);
+            offset += instance.states[child].duration;
+        }
+        state.duration = offset;
+        break;
+    }
+
+    case Timeline::NodeType::PARALLEL:
+        state.duration = 0.0f;
+        for (uint32_t child : node.children)
+        {
+            prepare(instance, child, 0.0f, ends);
+            state.duration = std::max(state.duration, instance.states[child].duration);
+        }
+        break;
+
+    case Timeline::NodeType::REPEAT:
+    {
+        prepare(instance, node.children[0], 0.0f, ends);
+        float length = instance.states[node.children[0]].duration;
+        if (node.count < 0)
+        {
+            state.duration = length > 0.0f ? std::numeric_limits<float>::infinity() : 0.0f;
+        }
+        else
+        {
+            state.duration = length * static_cast<float>(node.count);
+        }
+        break;
+    }
+    }
+}
+
+void TweenSystem::evaluate(TimelineInstance& instance, uint32_t index, float time, std::vector<std::function<void()>>* events)
+{
+    NodeState& state = instance.states[index];
+    if (state.lastTime == time)
+    {
+        // Nothing below changed, finished and pending nodes cost nothing
+        return;
+    }
+
+    const Timeline::Node& node = instance.timeline.nodes[index];
+    const std::vector<NodeState>& states = instance.states;
+
+    switch (node.type)
+    {
+    case Timeline::NodeType::TWEEN:
+        if (state.component)
+        {
+            float progress = 0.0f;
+            if (time >= state.duration)
+            {
+                progress = 1.0f;
+            }
+            else if (time > 0.0f)
+            {
+                progress = time / state.duration;
+                ease(node.easingType, &progress, 1);
+            }
+            write(state.track, state.component, state.from, state.to, progress);
+        }
+        break;
+
+    case Timeline::NodeType::DELAY:
+        break;
+
+    case Timeline::NodeType::CALL:
+        if (events && time >= 0.0f && state.lastTime < 0.0f)
+        {
+            events->push_back(node.callback);
+        }
+        break;
+
+    case Timeline::NodeType::SEQUENCE:
+        // Rewind the children not reached yet last to first, then play the others first to last,
+        // so the latest tween of a property has the final say
+        for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+        {
+            if ((time < 0.0f || time < states[*it].start) && states[*it].lastTime != BEFORE_START)
+            {
+                evaluate(instance, *it, BEFORE_START, events);
+            }
+        }
+        if (time >= 0.0f)
+        {
+            for (uint32_t child : node.children)
+            {
+                if (time >= states[child].start)
+                {
+                    evaluate(instance, child, std::min(time - states[child].start, states[child].duration), events);
+                }
+            }
+        }
+        break;
+
+    case Timeline::NodeType::PARALLEL:
+        if (time < 0.0f)
+        {
+            for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+            {
+                evaluate(instance, *it, BEFORE_START, events);
+            }
+        }
+        else
+        {
+            for (uint32_t child : node.children)
+            {
+                evaluate(instance, child, std::min(time, states[child].duration), events);
+            }
+        }
+        break;
+
+    case Timeline::NodeType::REPEAT:
+    {
+        uint32_t child = node.children[0];
+        float length = states[child].duration;
+
+        if (time < 0.0f)
+        {
+            evaluate(instance, child, BEFORE_START, events);
+            state.cycle = -1;
+            break;
+        }
+        if (length <= 0.0f)
+        {
+            evaluate(instance, child, 0.0f, events);
+            break;
+        }
+
+        int cycle = static_cast<int>(time / length);
+        if (node.count > 0)
+        {
+            cycle = std::min(cycle, node.count - 1);
+        }
+        float local = std::min(time - static_cast<float>(cycle) * length, length);
+        if (node.yoyo && (cycle & 1))
+        {
+            local = length - local;
+        }
+
+        if (state.cycle >= 0 && cycle != state.cycle)
+        {
+            if (node.yoyo)
+            {
+                // Finish the previous pass, the next one continues from where it ended
+                if (cycle > state.cycle)
+                {
+                    evaluate(instance, child, (state.cycle & 1) ? 0.0f : length, events);
+                }
+            }
+            else
+            {
+                if (cycle > state.cycle)
+                {
+                    evaluate(instance, child, length, events);
+                }
+                evaluate(instance, child, BEFORE_START, events);
+            }
+        }
+        state.cycle = cycle;
+        evaluate(instance, child, local, events);
+        break;
+    }
+    }
+
+    state.lastTime = time;
+}
+
+std::unordered_map<uint64_t, TweenSystem::TimelineInstance>::iterator TweenSystem::removeTimeline(std::unordered_map<uint64_t, TimelineInstance>::iterator it)
+{
+    for (GameObject* object : it->second.objects)
+    {
+        auto range = objectTimelines.equal_range(object);
+        for (auto entry = range.first; entry != range.second; ++entry)
+        {
+            if (entry->second == it->first)
+            {
+                objectTimelines.erase(entry);
+                break;
+            }
+        }
+    }
+    return timelines.erase(it);
+}
+
+void TweenSystem::remove(uint32_t batchIndex, uint32_t index)
+{
+    Batch& batch = batches[batchIndex];
+    Track track = static_cast<Track>(batchIndex / EASING_COUNT);
+
+    locations.erase(batch.ids[index]);
+    trackTweens.erase(trackKey(batch.objects[index], track));
+
+    size_t last = batch.ids.size() - 1;
+    if (index != last)
+    {
+        batch.ids[index] = batch.ids[last];
+        batch.objects[index] = batch.objects[last];
+        batch.targets[index] = batch.targets[last];
+        batch.from[index] = batch.from[last];
+        batch.to[index] = batch.to[last];
+        batch.elapsed[index] = batch.elapsed[last];
+        batch.inverseDuration[index] = batch.inverseDuration[last];
+        batch.rate[index] = batch.rate[last];
+        batch.progress[index] = batch.progress[last];
+        batch.callbacks[index] = std::move(batch.callbacks[last]);
+        locations[batch.ids[index]].index = index;
+    }
+
+    batch.ids.pop_back();
+    batch.objects.pop_back();
+    batch.targets.pop_back();
+    batch.from.pop_back();
+    batch.to.pop_back();
+    batch.elapsed.pop_back();
+    batch.inverseDuration.pop_back();
+    batch.rate.pop_back();
+    batch.progress.pop_back();
+    batch.callbacks.pop_back();
+}
+
+void TweenSystem::clear()
+{
+    for (Batch& batch : batches)
+    {
+        batch = Batch();
+    }
+    locations.clear();
+    trackTweens.clear();
+    timelines.clear();
+    objectTimelines.clear();
+}
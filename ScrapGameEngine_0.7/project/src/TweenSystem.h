@@ -0,0 +1,301 @@
+#pragma once
+#include "TweenComponent.h"
+#include "Timeline.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec4.hpp>
+
+namespace ScrapGameEngine
+{
+    class GameObject;
+
+    /**
+     * @class TweenSystem
+     * @brief Advances every active tween in one pass per frame.
+     *
+     * Tweens are stored as structures of arrays, one batch per animated property and easing
+     * curve, so a frame runs the same curve over a whole batch and then writes the results
+     * straight into the Transform, SpriteRenderer or Button fields without a branch per tween.
+     * An object can run one tween per property at a time; starting another replaces it.
+     * Timelines are played here too and share the tween handles: both can be paused, seeked and
+     * cancelled by ID. Destroying a GameObject cancels its tweens and the timelines animating it.
+     * Main thread only.
+     */
+    class TweenSystem
+    {
+    public:
+        TweenSystem() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Starts a tween from the property's current value, replacing the object's tween of that property.
+         * @param object The animated object.
+         * @param type The property. FADE animates the SpriteRenderer opacity, COLOR its tint or else the Button color.
+         * @param target The end value: xy for POSITION and SCALE, x for ROTATION in degrees and FADE, rgb for COLOR.
+         * @param duration The duration in seconds.
+         * @param easingType The easing curve.
+         * @param onComplete Optional callback invoked after the tween reaches its target.
+         * @return The tween ID, or 0 if the object lacks the animated component.
+         */
+        static uint64_t start(GameObject* object, TweenType type, const glm::vec4& target, float duration,
+            EasingType easingType = EasingType::LINEAR, std::function<void()> onComplete = nullptr);
+
+        /**
+         * @brief Plays a timeline from its start, replacing the tweens of the properties it animates.
+         * @param timeline The timeline, copied so it can be played again or discarded.
+         * @return The timeline ID.
+         */
+        static uint64_t play(const Timeline& timeline);
+
+        /**
+         * @brief Stops a tween or timeline where it is, without invoking its callback.
+         * @param id The tween or timeline ID.
+         * @return False if it already finished.
+         */
+        static bool cancel(uint64_t id);
+
+        /**
+         * @brief Pauses a tween or timeline, it keeps its values until resumed or seeked.
+         * @param id The tween or timeline ID.
+         * @return False if it already finished.
+         */
+        static bool pause(uint64_t id);
+
+        /**
+         * @brief Resumes a paused tween or timeline.
+         * @param id The tween or timeline ID.
+         * @return False if it already finished.
+         */
+        static bool resume(uint64_t id);
+
+        /**
+         * @brief Moves a tween or timeline to a point in time and applies the values there, without invoking callbacks.
+         * @param id The tween or timeline ID.
+         * @param time The time from the start in seconds, clamped to the duration.
+         * @return False if it already finished.
+         */
+        static bool seek(uint64_t id, float time);
+
+        /**
+         * @brief Gets how far a tween or timeline has played.
+         * @param id The tween or timeline ID.
+         * @return The time from the start in seconds, 0 if it finished.
+         */
+        static float getTime(uint64_t id);
+
+        /**
+         * @brief Stops every tween of an object and the timelines animating it, without invoking their callbacks.
+         * @param object The object.
+         */
+        static void cancelAll(GameObject* object);
+
+        /**
+         * @brief Pauses or resumes every tween of an object and the timelines animating it.
+         * @param object The object.
+         * @param paused True to pause, false to resume.
+         */
+        static void setPaused(GameObject* object, bool paused);
+
+        /**
+         * @brief Checks whether an object has a tween in progress.
+         * @param object The object.
+         * @return True if one of its properties is being tweened or a timeline animates it, paused or not.
+         */
+        static bool isAnimating(GameObject* object);
+
+        /**
+         * @brief Checks whether a tween or timeline is still in progress.
+         * @param id The tween or timeline ID.
+         * @return False once it finished or was cancelled.
+         */
+        static bool isActive(uint64_t id) { return locations.count(id) != 0 || timelines.count(id) != 0; }
+
+        /**
+         * @brief Advances all tweens and timelines and invokes their events and completion callbacks.
+         * @param deltaTime The time elapsed since the last update.
+         */
+        static void update(float deltaTime);
+
+        /**
+         * @brief Applies an easing curve to a batch of progress values in place.
+         * @param easingType The easing curve.
+         * @param values Progress values between 0 and 1.
+         * @param count The number of values.
+         */
+        static void ease(EasingType easingType, float* values, size_t count);
+
+        /**
+         * @brief Cancels every tween and timeline.
+         */
+        static void clear();
+
+        /**
+         * @brief Gets the number of tweens in progress.
+         * @return The active tweens, not counting those of timelines.
+         */
+        static size_t getActiveCount() { return locations.size(); }
+
+        /**
+         * @brief Gets the number of timelines in progress.
+         * @return The active timelines.
+         */
+        static size_t getTimelineCount() { return timelines.size(); }
+
+    private:
+        static constexpr size_t EASING_COUNT = static_cast<size_t>(EasingType::EASE_IN_OUT_BOUNCE) + 1; ///< Easing curves.
+
+        /** @brief The field a tween writes, one per target component and value. */
+        enum class Track : uint8_t
+        {
+            POSITION,       ///< Transform local position.
+            SCALE,          ///< Transform local scale.
+            ROTATION,       ///< Transform local rotation.
+            SPRITE_COLOR,   ///< SpriteRenderer tint.
+            SPRITE_OPACITY, ///< SpriteRenderer opacity.
+            BUTTON_COLOR,   ///< Button color, alpha kept.
+            COUNT
+        };
+
+        static constexpr size_t TRACK_COUNT = static_cast<size_t>(Track::COUNT); ///< Animated fields.
+
+        /**
+         * @struct Batch
+         * @brief The tweens of one track and easing curve, one array per field.
+         */
+        struct Batch
+        {
+            std::vector<uint64_t> ids;                          ///< Tween IDs.
+            std::vector<GameObject*> objects;                   ///< Animated objects.
+            std::vector<void*> targets;                         ///< Component written, its type given by the track.
+            std::vector<glm::vec4> from;                        ///< Start values.
+            std::vector<glm::vec4> to;                          ///< End values.
+            std::vector<float> elapsed;                         ///< Time advanced so far.
+            std::vector<float> inverseDuration;                 ///< 1 / duration.
+            std::vector<float> rate;                            ///< 1 while playing, 0 while paused.
+            std::vector<float> progress;                        ///< Eased progress of the current update.
+            std::vector<std::function<void()>> callbacks;       ///< Completion callbacks, mostly empty.
+        };
+
+        /**
+         * @struct Location
+         * @brief Where a tween is stored.
+         */
+        struct Location
+        {
+            uint32_t batch; ///< Index into `batches`.
+            uint32_t index; ///< Index inside the batch.
+        };
+
+        /**
+         * @struct NodeState
+         * @brief Playback state of one timeline node.
+         */
+        struct NodeState
+        {
+            float start = 0.0f;                 ///< Offset inside the parent group.
+            float duration = 0.0f;              ///< Length of one play.
+            float lastTime = -1.0f;             ///< Local time last applied, -1 before the start.
+            int cycle = -1;                     ///< REPEAT: repetition last applied.
+            Track track = Track::POSITION;      ///< TWEEN: animated field.
+            void* component = nullptr;          ///< TWEEN: component written, null if the object lacks it.
+            glm::vec4 from{ 0.0f };             ///< TWEEN: start value.
+            glm::vec4 to{ 0.0f };               ///< TWEEN: end value.
+        };
+
+        /**
+         * @struct TimelineInstance
+         * @brief A timeline being played.
+         */
+        struct TimelineInstance
+        {
+            Timeline timeline;                  ///< The played copy.
+            std::vector<NodeState> states;      ///< State of each node, by node index.
+            std::vector<GameObject*> objects;   ///< Objects animated, each once.
+            float time = 0.0f;                  ///< Time from the start.
+            float duration = 0.0f;              ///< Length of the timeline.
+            bool paused = false;                ///< Whether updates leave it alone.
+        };
+
+        /**
+         * @brief Finds the field a tween writes and its start and end values.
+         * @param object The animated object.
+         * @param type The property.
+         * @param target The end value as passed to `start`.
+         * @param track Receives the field.
+         * @param component Receives the component written.
+         * @param from Receives the current value.
+         * @param to Receives the end value.
+         * @return False if the object lacks the animated component.
+         */
+        static bool resolve(GameObject* object, TweenType type, const glm::vec4& target, Track& track, void*& component, glm::vec4& from, glm::vec4& to);
+
+        /**
+         * @brief Writes one interpolated value into its component.
+         * @param track The field.
+         * @param component The component.
+         * @param from The start value.
+         * @param to The end value.
+         * @param progress The eased progress.
+         */
+        static void write(Track track, void* component, const glm::vec4& from, const glm::vec4& to, float progress);
+
+        /**
+         * @brief Resolves the tweens of a timeline node and computes its timing.
+         * @param instance The timeline being started.
+         * @param node The node index.
+         * @param start The node's offset inside its parent group.
+         * @param ends Value each object and track reaches so far in the timeline.
+         */
+        static void prepare(TimelineInstance& instance, uint32_t node, float start, std::unordered_map<uintptr_t, glm::vec4>& ends);
+
+        /**
+         * @brief Applies a timeline node at a local time, skipping nodes whose time did not change.
+         * @param instance The timeline.
+         * @param node The node index.
+         * @param time The local time, -1 to return to the state before the node started.
+         * @param events Receives the events passed, null when seeking.
+         */
+        static void evaluate(TimelineInstance& instance, uint32_t node, float time, std::vector<std::function<void()>>* events);
+
+        /**
+         * @brief Forgets a timeline.
+         * @param it The timeline.
+         * @return The next timeline.
+         */
+        static std::unordered_map<uint64_t, TimelineInstance>::iterator removeTimeline(std::unordered_map<uint64_t, TimelineInstance>::iterator it);
+
+        /**
+         * @brief Makes the key of an object's tween of one track.
+         * @param object The object.
+         * @param track The track.
+         * @return The key into `trackTweens`.
+         */
+        static uintptr_t trackKey(GameObject* object, Track track)
+        {
+            return reinterpret_cast<uintptr_t>(object) * TRACK_COUNT + static_cast<uintptr_t>(track);
+        }
+
+        /**
+         * @brief Removes a tween by moving the last one of its batch into its slot.
+         * @param batchIndex The batch.
+         * @param index The tween inside the batch.
+         */
+        static void remove(uint32_t batchIndex, uint32_t index);
+
+        /**
+         * @brief Writes the eased values of a batch into its components.
+         * @param track The track of the batch.
+         * @param batch The batch, its `progress` computed.
+         */
+        static void apply(Track track, Batch& batch);
+
+        static std::array<Batch, TRACK_COUNT * EASING_COUNT> batches;   ///< Batches by track, then easing.
+        static std::unordered_map<uint64_t, Location> locations;        ///< Active tweens by ID.
+        static std::unordered_map<uintptr_t, uint64_t> trackTweens;     ///< Active tween of each object and track.
+        static std::unordered_map<uint64_t, TimelineInstance> timelines; ///< Playing timelines by ID.
+        static std::unordered_multimap<GameObject*, uint64_t> objectTimelines; ///< Timelines animating each object.
+        static uint64_t nextId;                                         ///< Next tween or timeline ID, 0 is never used.
+    };
+}
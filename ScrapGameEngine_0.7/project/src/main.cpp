@@ -1,26 +1,82 @@
-#include "Application.h"
-#include "SceneStateMachine.h"
-#include "SplashScreenScene.h"
-#include "MainMenuScene.h"
-#include "GameScene.h"
-#include "LoadScene.h"
-
-int main() 
-{
-    Application app(600, 600, "Scrap Engine");
-    int result = app.init(); // Initialize the application
-
-    if (result == 1) 
-    {
-        ScrapGameEngine::SceneStateMachine::addScene<SplashScreenScene>();
-        ScrapGameEngine::SceneStateMachine::addScene<MainMenuScene>();
-        ScrapGameEngine::SceneStateMachine::addScene<GameScene>();
-        ScrapGameEngine::SceneStateMachine::addScene<LoadScene>();
-
-        ScrapGameEngine::SceneStateMachine::loadScene("SplashScreenScene");
-        app.run(); // Run the application
-    }
-
-
-    return 0; 
-}
+#include "Application.h"
+#include "SceneStateMachine.h"
+#include "SplashScreenScene.h"
+#include "MainMenuScene.h"
+#include "GameScene.h"
+#include "LoadScene.h"
+#include "Log.h"
+#include "TextureProcessing.h"
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv) 
+{
+    Application app(600, 600, "Scrap Engine");
+
+    // Command line: --headless, --frames <count>, --record <file>, --replay <file>, --timings <file.csv>, --profile <trace.json>, --memreport <file.txt>, --hotreload <assetdir>, --scene-budget <megabytes>, --bake-textures <assetdir>
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            app.setHeadless(true);
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            app.setFrameLimit(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            app.setRecordPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            app.setReplayPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--timings") == 0 && i + 1 < argc)
+        {
+            app.setTimingsPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+            app.setProfilePath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--memreport") == 0 && i + 1 < argc)
+        {
+            app.setMemoryReportPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--hotreload") == 0 && i + 1 < argc)
+        {
+            app.setHotReloadPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--scene-budget") == 0 && i + 1 < argc)
+        {
+            // Scenes that are left stay resident up to this much memory
+            ScrapGameEngine::SceneStateMachine::setResidentBudget(std::strtoull(argv[++i], nullptr, 10) * 1024 * 1024);
+        }
+        else if (std::strcmp(argv[i], "--bake-textures") == 0 && i + 1 < argc)
+        {
+            // Offline step, runs without a window and exits
+            size_t baked = ScrapGameEngine::TextureProcessing::bakeDirectory(argv[++i]);
+            SGE_LOG_INFO(FRAMEWORK, "Baked {} textures", baked);
+            ScrapGameEngine::Log::shutdown();
+            return 0;
+        }
+    }
+
+    int result = app.init(); // Initialize the application
+
+    if (result == 1) 
+    {
+        ScrapGameEngine::SceneStateMachine::addScene<SplashScreenScene>();
+        ScrapGameEngine::SceneStateMachine::addScene<MainMenuScene>();
+        ScrapGameEngine::SceneStateMachine::addScene<GameScene>();
+        ScrapGameEngine::SceneStateMachine::addScene<LoadScene>();
+
+        ScrapGameEngine::SceneStateMachine::loadScene("SplashScreenScene");
+        app.run(); // Run the application
+    }
+
+    ScrapGameEngine::Log::shutdown(); // Write out any queued log messages
+
+    return 0; 
+}
@@ -0,0 +1,69 @@
+#include "Test.h"
+#include "AssetHotReload.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace ScrapGameEngine;
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @brief Calls update() until a condition holds or a timeout expires.
+     * @param done The condition.
+     * @param timeoutMs The timeout in milliseconds.
+     * @return True if the condition held in time.
+     */
+    template <typename Condition>
+    bool updateUntil(Condition done, int timeoutMs)
+    {
+        for (int waited = 0; waited < timeoutMs; waited += 20)
+        {
+            AssetHotReload::update();
+            if (done()) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        return false;
+    }
+
+    /**
+     * @brief Replaces the content of a file.
+     * @param path The file.
+     * @param content The new content.
+     */
+    void writeFile(const fs::path& path, const char* content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+}
+
+SGE_TEST(AssetHotReloadMatchesDifferentSpellingsOfAPath)
+{
+    fs::path root = fs::temp_directory_path() / "sge_hot_reload_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "fonts");
+    writeFile(root / "fonts" / "title.txt", "first");
+
+    // The watcher reports absolute paths, the game loaded the file through a relative, redundant path
+    int relativeCalls = 0;
+    int redundantCalls = 0;
+    std::string relative = fs::relative(root / "fonts" / "title.txt").generic_string();
+    std::string redundant = (root / "fonts" / ".." / "fonts" / "." / "title.txt").generic_string();
+    AssetHotReload::addListener(relative, [&relativeCalls](const std::string&) { relativeCalls++; });
+    AssetHotReload::addListener(redundant, [&redundantCalls](const std::string&) { redundantCalls++; });
+
+    SGE_CHECK(AssetHotReload::init(root.generic_string()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    writeFile(root / "fonts" / "title.txt", "second");
+
+    SGE_CHECK(updateUntil([&] { return relativeCalls > 0 && redundantCalls > 0; }, 3000));
+    SGE_CHECK(relativeCalls == 1);
+    SGE_CHECK(redundantCalls == 1);
+
+    AssetHotReload::shutdown();
+    fs::remove_all(root);
+}
@@ -0,0 +1,95 @@
+#include "Test.h"
+#include "EventBus.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    /**
+     * @struct Ping
+     * @brief A test event.
+     */
+    struct Ping
+    {
+        int value; ///< Payload.
+    };
+}
+
+SGE_TEST(EventBusDeliversToConsumersSubscribedDuringDispatchFromTheNextOne)
+{
+    int firstCalls = 0;
+    int addedCalls = 0;
+    std::vector<uint64_t> added;
+
+    // Each call subscribes more consumers than the list could hold without growing
+    EventBus::subscribe<Ping>([&](const Ping&)
+        {
+            firstCalls++;
+            for (int i = 0; i < 16; ++i)
+            {
+                added.push_back(EventBus::subscribe<Ping>([&addedCalls](const Ping&) { addedCalls++; }));
+            }
+        });
+
+    EventBus::publish(Ping{ 1 });
+    EventBus::publish(Ping{ 2 });
+    EventBus::dispatch();
+    SGE_CHECK(firstCalls == 2);
+    SGE_CHECK(addedCalls == 0);
+
+    // Removed before it ever ran
+    SGE_CHECK(EventBus::unsubscribe(added.back()));
+
+    EventBus::publish(Ping{ 3 });
+    EventBus::dispatch();
+    SGE_CHECK(firstCalls == 3);
+    SGE_CHECK(addedCalls == 31);
+
+    EventBus::clear();
+}
+
+SGE_TEST(EventBusReusesParallelWorkersAcrossDispatches)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int> sum(0);
+    for (int i = 0; i < 8; ++i)
+    {
+        EventBus::subscribeBatch<Ping>([&](const Ping* events, size_t count)
+            {
+                for (size_t j = 0; j < count; ++j)
+                {
+                    sum += events[j].value;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }, true);
+    }
+
+    const int dispatches = 200;
+    for (int i = 0; i < dispatches; ++i)
+    {
+        EventBus::publish(Ping{ 1 });
+        EventBus::publish(Ping{ 2 });
+        EventBus::dispatch();
+    }
+    SGE_CHECK(sum == 8 * 3 * dispatches);
+
+    // The main thread helps with the jobs, the rest go to at most MAX_WORKERS threads for the whole run
+    SGE_CHECK(threads.size() <= EventBus::MAX_WORKERS + 1);
+
+    EventBus::clear();
+
+    // Workers start again after clear()
+    std::atomic<int> calls(0);
+    EventBus::subscribeBatch<Ping>([&calls](const Ping*, size_t count) { calls += static_cast<int>(count); }, true);
+    EventBus::publish(Ping{ 1 });
+    EventBus::dispatch();
+    SGE_CHECK(calls == 1);
+
+    EventBus::clear();
+}
@@ -0,0 +1,97 @@
+#include "Test.h"
+#include "Clock.h"
+#include "FrameLimiter.h"
+#include <cstdio>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const double TARGET_60HZ = 1.0 / 60.0;
+    const double SPIN_QUANTUM = 0.00001; // FakeClock::spinPause step
+
+    /**
+     * @brief Runs frames against a fake clock and reports the limiter's pacing.
+     * @param clock The fake clock, set up with the oversleep to emulate.
+     * @param targetFrameTime The limiter's target in seconds.
+     * @param frames The number of frames.
+     * @param work The simulated work of each frame in seconds, given the frame index.
+     * @param label The name printed with the results.
+     * @return The pacing statistics.
+     */
+    template<typename Work>
+    FramePacingStats measurePacing(FakeClock& clock, double targetFrameTime, int frames, Work work, const char* label)
+    {
+        FrameLimiter limiter;
+        limiter.setTargetFrameTime(targetFrameTime);
+        for (int i = 0; i < frames; ++i)
+        {
+            limiter.waitForNextFrame(clock);
+            clock.advance(work(i));
+        }
+
+        const FramePacingStats& stats = limiter.getStats();
+        std::printf("    %s: %u frames, mean %.4f ms, jitter mean %.4f ms max %.4f ms, %u missed\n", label,
+            stats.frameCount, stats.meanInterval * 1000.0, stats.meanAbsJitter * 1000.0, stats.maxAbsJitter * 1000.0, stats.missedFrames);
+        return stats;
+    }
+}
+
+SGE_TEST(FramePacingHoldsTheTargetWithAPreciseTimer)
+{
+    FakeClock clock;
+    FramePacingStats stats = measurePacing(clock, TARGET_60HZ, 600,
+        [](int i) { return 0.004 + (i % 7) * 0.001; }, "precise timer");
+
+    SGE_CHECK(stats.frameCount == 599);
+    SGE_CHECK(stats.missedFrames == 0);
+    SGE_CHECK(stats.maxAbsJitter <= SPIN_QUANTUM);
+}
+
+SGE_TEST(FramePacingAdaptsToACoarseTimer)
+{
+    // Every sleep overshoots by 1.3 ms, the spin margin has to grow to absorb it
+    FakeClock clock;
+    clock.setOversleep(0.0013);
+    FramePacingStats stats = measurePacing(clock, TARGET_60HZ, 600,
+        [](int i) { return 0.004 + (i % 7) * 0.001; }, "1.3 ms oversleep");
+
+    SGE_CHECK(stats.missedFrames == 0);
+    SGE_CHECK(stats.meanAbsJitter <= 2.0 * SPIN_QUANTUM);
+    SGE_CHECK(stats.meanInterval > TARGET_60HZ - SPIN_QUANTUM && stats.meanInterval < TARGET_60HZ + 2.0 * SPIN_QUANTUM);
+}
+
+SGE_TEST(FramePacingReportsOversleepBeyondTheSpinMargin)
+{
+    // A 6 ms oversleep is more than the 4 ms margin cap, frames run late and the jitter shows it
+    FakeClock clock;
+    clock.setOversleep(0.006);
+    FramePacingStats stats = measurePacing(clock, TARGET_60HZ, 300,
+        [](int) { return 0.002; }, "6 ms oversleep");
+
+    SGE_CHECK(stats.maxAbsJitter > 0.001);
+    SGE_CHECK(stats.meanInterval > TARGET_60HZ);
+}
+
+SGE_TEST(FramePacingCountsFramesOverBudget)
+{
+    FakeClock clock;
+    FramePacingStats stats = measurePacing(clock, TARGET_60HZ, 100,
+        [](int i) { return i % 10 == 0 ? 0.025 : 0.005; }, "overruns");
+
+    // Frames 0, 10, ..., 90 overran, each is caught by the next frame's wait
+    SGE_CHECK(stats.missedFrames == 10);
+    SGE_CHECK(stats.maxInterval >= 0.025);
+    SGE_CHECK(stats.minInterval >= TARGET_60HZ - SPIN_QUANTUM);
+}
+
+SGE_TEST(FramePacingDoesNotWaitWhenDisabled)
+{
+    FakeClock clock;
+    FramePacingStats stats = measurePacing(clock, 0.0, 100,
+        [](int) { return 0.003; }, "unlimited");
+
+    SGE_CHECK(stats.missedFrames == 0);
+    SGE_CHECK(stats.maxInterval < 0.003 + 1e-9);
+    SGE_CHECK(stats.meanAbsJitter == 0.0);
+}
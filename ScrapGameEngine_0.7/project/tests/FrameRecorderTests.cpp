@@ -0,0 +1,123 @@
+#include "Test.h"
+#include "FrameRecorder.h"
+#include "SceneLoader.h"
+#include "SceneManifest.h"
+#include "SceneStateMachine.h"
+#include "Renderer.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+using namespace ScrapGameEngine;
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @class PreloadedScene
+     * @brief A scene declaring textures, initialized by nothing but the test.
+     */
+    class PreloadedScene : public BaseScene
+    {
+    public:
+        std::string getName() const override { return "FrameRecorderTestsPreloaded"; }
+
+        void declareAssets(SceneManifest& manifest) const override
+        {
+            TextureConfig cfg{};
+            manifest.addTexture("../assets/Assets/LoadBG.png", cfg);
+            manifest.addTexture("../assets/Assets/LoadBar.png", cfg);
+            manifest.addTexture("../assets/icons/ScrapLogo.png", cfg);
+        }
+
+    protected:
+        void onInitialize() override {}
+    };
+}
+
+SGE_TEST(FrameRecorderRoundTripsPreparedSteps)
+{
+    fs::path directory = fs::temp_directory_path() / "sge_frame_recorder_test";
+    fs::create_directories(directory);
+    std::string path = (directory / "steps.sger").generic_string();
+
+    InputFrame input;
+    input.keys.push_back(KeyCode::TAB);
+    input.mousePosition = { 12.0f, 34.0f };
+    {
+        FrameRecorder recorder;
+        SGE_CHECK(recorder.open(path));
+        recorder.writeFrame(0.016f, input, 0);
+        recorder.writeFrame(0.017f, InputFrame(), 3);
+        recorder.writeFrame(0.018f, input, 0);
+        recorder.close();
+    }
+
+    FramePlayer player;
+    SGE_CHECK(player.open(path));
+    SGE_CHECK(player.hasPreparedSteps());
+    SGE_CHECK(player.getFrameCount() == 3);
+
+    float deltaTime = 0.0f;
+    InputFrame frame;
+    uint8_t preparedStep = 255;
+    SGE_CHECK(player.readFrame(deltaTime, frame, preparedStep));
+    SGE_CHECK(deltaTime == 0.016f && preparedStep == 0);
+    SGE_CHECK(frame.keys.size() == 1 && frame.keys[0] == KeyCode::TAB);
+    SGE_CHECK(player.readFrame(deltaTime, frame, preparedStep));
+    SGE_CHECK(deltaTime == 0.017f && preparedStep == 3 && frame.keys.empty());
+    SGE_CHECK(player.readFrame(deltaTime, frame, preparedStep));
+    SGE_CHECK(preparedStep == 0 && frame.mousePosition.y == 34.0f);
+    SGE_CHECK(!player.readFrame(deltaTime, frame, preparedStep));
+
+    fs::remove_all(directory);
+}
+
+SGE_TEST(FrameRecorderReadsVersionOneFiles)
+{
+    fs::path directory = fs::temp_directory_path() / "sge_frame_recorder_test";
+    fs::create_directories(directory);
+    std::string path = (directory / "version1.sger").generic_string();
+
+    // One frame as the first format wrote it: no keys, no buttons, no prepared step
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        const uint32_t version = 1;
+        const uint32_t count = 1;
+        const float deltaTime = 0.02f;
+        const uint8_t none = 0;
+        const float mouse[2] = { 5.0f, 6.0f };
+        out.write("SGER", 4);
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        out.write(reinterpret_cast<const char*>(&deltaTime), sizeof(deltaTime));
+        out.write(reinterpret_cast<const char*>(&none), sizeof(none));
+        out.write(reinterpret_cast<const char*>(&none), sizeof(none));
+        out.write(reinterpret_cast<const char*>(mouse), sizeof(mouse));
+    }
+
+    FramePlayer player;
+    SGE_CHECK(player.open(path));
+    SGE_CHECK(!player.hasPreparedSteps());
+
+    float deltaTime = 0.0f;
+    InputFrame frame;
+    uint8_t preparedStep = 255;
+    SGE_CHECK(player.readFrame(deltaTime, frame, preparedStep));
+    SGE_CHECK(deltaTime == 0.02f && preparedStep == 0 && frame.mousePosition.x == 5.0f);
+
+    fs::remove_all(directory);
+}
+
+SGE_TEST(SceneLoaderWaitsUntilEveryAssetIsResident)
+{
+    // What a replay does on the update that finished the preparation in the recording
+    Renderer::setBackend(RendererBackend::RECORDING);
+    SceneStateMachine::addScene<PreloadedScene>();
+    SGE_CHECK(SceneLoader::begin("FrameRecorderTestsPreloaded"));
+    SceneLoader::waitUntilComplete();
+    SGE_CHECK(SceneLoader::isComplete());
+    SGE_CHECK(SceneLoader::getLoadedAssetCount() == 3);
+    SceneLoader::finish();
+    SGE_CHECK(!SceneLoader::isLoading());
+}
@@ -0,0 +1,101 @@
+#include "Test.h"
+#include "Log.h"
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    const int PRODUCER_COUNT = 4;
+    const int MESSAGES_PER_PRODUCER = 5000;
+
+    /**
+     * @class LineCounter
+     * @brief Stream buffer counting the lines written to it and discarding them.
+     */
+    class LineCounter : public std::streambuf
+    {
+    public:
+        std::atomic<uint64_t> lines{ 0 }; ///< Newlines seen.
+
+    protected:
+        int overflow(int c) override
+        {
+            if (c == '\n') lines++;
+            return c;
+        }
+
+        std::streamsize xsputn(const char* text, std::streamsize count) override
+        {
+            for (std::streamsize i = 0; i < count; ++i)
+            {
+                if (text[i] == '\n') lines++;
+            }
+            return count;
+        }
+    };
+}
+
+SGE_TEST(LogDoesNotThrottleErrors)
+{
+    Log::flush();
+    LineCounter counter;
+    std::streambuf* previous = std::cerr.rdbuf(&counter);
+
+    // Two sites over their limit in the same second
+    LogRateLimiter warnings;
+    LogRateLimiter errors;
+    for (int i = 0; i < SGE_LOG_RATE_LIMIT * 3; ++i)
+    {
+        Log::write(warnings, LogLevel::WARN, LogCategory::GAME, "Warning {}", i);
+        Log::write(errors, LogLevel::ERR, LogCategory::GAME, "Error {}", i);
+    }
+    Log::flush();
+    std::cerr.rdbuf(previous);
+
+    SGE_CHECK(counter.lines == SGE_LOG_RATE_LIMIT + SGE_LOG_RATE_LIMIT * 3);
+}
+
+SGE_TEST(LogShutdownWritesEveryQueuedMessage)
+{
+    Log::flush();
+    LineCounter counter;
+    std::streambuf* previous = std::cout.rdbuf(&counter);
+    uint64_t droppedBefore = Log::getDroppedCount();
+
+    // Shut down while producers are still queuing, a message that saw the writer running must not be lost
+    std::atomic<int> started(0);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCER_COUNT; ++p)
+    {
+        producers.emplace_back([p, &started]()
+            {
+                started++;
+                for (int i = 0; i < MESSAGES_PER_PRODUCER; ++i)
+                {
+                    // A limiter per message, so only the queue decides what gets through
+                    LogRateLimiter limiter;
+                    Log::write(limiter, LogLevel::INFO, LogCategory::GAME, "Producer {} message {}", p, i);
+                }
+            });
+    }
+    while (started < PRODUCER_COUNT)
+    {
+        std::this_thread::yield();
+    }
+    Log::shutdown();
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    std::cout.rdbuf(previous);
+
+    // Written by the writer, by shutdown() or synchronously after it, unless the full queue dropped them
+    uint64_t dropped = Log::getDroppedCount() - droppedBefore;
+    SGE_CHECK(counter.lines + dropped == static_cast<uint64_t>(PRODUCER_COUNT) * MESSAGES_PER_PRODUCER);
+}
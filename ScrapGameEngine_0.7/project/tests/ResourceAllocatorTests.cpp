@@ -0,0 +1,134 @@
+#include "Test.h"
+#include "ResourceAllocator.h"
+#include <memory>
+#include <string>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    /**
+     * @struct NamedResource
+     * @brief Resource identified by its name, so tests can make different resources share a key.
+     */
+    struct NamedResource
+    {
+        std::string name; ///< The name the resource was loaded with.
+    };
+
+    int loadCount = 0; // Loads since the last reset, to catch duplicate loads
+}
+
+namespace ScrapGameEngine
+{
+    template <>
+    struct ResourceLoader<NamedResource>
+    {
+        static std::unique_ptr<NamedResource> load(AssetId /*key*/, const std::string& name)
+        {
+            loadCount++;
+            return std::unique_ptr<NamedResource>(new NamedResource{ name });
+        }
+
+        static bool matches(const NamedResource& resource, const std::string& name)
+        {
+            return resource.name == name;
+        }
+    };
+}
+
+SGE_TEST(ResourceAllocatorReusesSlotsWithANewGeneration)
+{
+    ResourceAllocator<NamedResource> allocator;
+    allocator.setRetainFrames(0);
+
+    ResourceHandle<NamedResource> first = allocator.acquire(1, std::string("first"));
+    SGE_CHECK(allocator.release(first));
+    SGE_CHECK(allocator.collect() == 1);
+
+    ResourceHandle<NamedResource> second = allocator.acquire(2, std::string("second"));
+    SGE_CHECK(second.index == first.index);
+    SGE_CHECK(second.generation != first.generation);
+    SGE_CHECK(allocator.get(second)->name == "second");
+    SGE_CHECK(allocator.get(first) == nullptr);
+}
+
+SGE_TEST(ResourceAllocatorRejectsStaleHandles)
+{
+    ResourceAllocator<NamedResource> allocator;
+    allocator.setRetainFrames(0);
+
+    ResourceHandle<NamedResource> handle = allocator.acquire(1, std::string("texture"));
+    SGE_CHECK(allocator.release(handle));
+    SGE_CHECK(!allocator.release(handle)); // No references left
+    allocator.collect();
+
+    ResourceHandle<NamedResource> reused = allocator.acquire(2, std::string("mesh"));
+    SGE_CHECK(reused.index == handle.index);
+
+    // The stale handle must not reach the resource now in its slot
+    SGE_CHECK(allocator.get(handle) == nullptr);
+    SGE_CHECK(!allocator.retain(handle).isValid());
+    SGE_CHECK(!allocator.release(handle));
+    SGE_CHECK(allocator.getRefCount(handle) == 0);
+    SGE_CHECK(allocator.getRefCount(reused) == 1);
+    SGE_CHECK(!ResourceHandle<NamedResource>().isValid());
+}
+
+SGE_TEST(ResourceAllocatorKeepsUnusedResourcesForRetainFrames)
+{
+    ResourceAllocator<NamedResource> allocator;
+    loadCount = 0;
+
+    ResourceHandle<NamedResource> handle = allocator.acquire(1, std::string("texture"));
+    allocator.release(handle);
+    SGE_CHECK(allocator.collect() == 0);
+
+    // Re-acquired before it expired, so it is not reloaded
+    SGE_CHECK(allocator.acquire(1, std::string("texture")) == handle);
+    SGE_CHECK(loadCount == 1);
+    allocator.release(handle);
+
+    SGE_CHECK(allocator.collect() == 0);
+    SGE_CHECK(allocator.collect() == 1);
+    SGE_CHECK(allocator.get(handle) == nullptr);
+}
+
+SGE_TEST(ResourceAllocatorFindsCollidingEntriesAfterTheFirstIsCollected)
+{
+    ResourceAllocator<NamedResource> allocator;
+    allocator.setRetainFrames(0);
+    loadCount = 0;
+
+    // Both resources hash to key 7, the second one is moved along the collision chain
+    ResourceHandle<NamedResource> first = allocator.acquire(7, std::string("first"));
+    ResourceHandle<NamedResource> second = allocator.acquire(7, std::string("second"));
+    SGE_CHECK(loadCount == 2);
+    SGE_CHECK(allocator.getStats().collisions == 1);
+
+    allocator.release(first);
+    SGE_CHECK(allocator.collect() == 1);
+    SGE_CHECK(allocator.getResourceCount() == 1);
+    SGE_CHECK(!allocator.findHandle(7).isValid());
+
+    // The second resource must still be found through the freed key instead of being loaded again
+    ResourceHandle<NamedResource> again = allocator.acquire(7, std::string("second"));
+    SGE_CHECK(again == second);
+    SGE_CHECK(loadCount == 2);
+    SGE_CHECK(allocator.getRefCount(second) == 2);
+
+    // A new resource on the chain takes the freed key
+    ResourceHandle<NamedResource> third = allocator.acquire(7, std::string("third"));
+    SGE_CHECK(loadCount == 3);
+    SGE_CHECK(allocator.findHandle(7) == third);
+    SGE_CHECK(allocator.getResourceCount() == 2);
+
+    // Every entry is still found exactly once
+    SGE_CHECK(allocator.acquire(7, std::string("second")) == second);
+    SGE_CHECK(allocator.acquire(7, std::string("third")) == third);
+    SGE_CHECK(loadCount == 3);
+
+    SGE_CHECK(allocator.clear() == 2);
+    SGE_CHECK(allocator.getResourceCount() == 0);
+    SGE_CHECK(!allocator.findHandle(7).isValid());
+}
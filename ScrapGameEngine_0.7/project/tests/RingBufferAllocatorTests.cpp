@@ -0,0 +1,161 @@
+#include "Test.h"
+#include "RingBufferAllocator.h"
+#include <cstdint>
+#include <set>
+
+using namespace ScrapGameEngine;
+
+namespace
+{
+    /**
+     * @struct FakeFences
+     * @brief Fences signaled by hand, standing in for the GPU.
+     */
+    struct FakeFences
+    {
+        std::set<uintptr_t> signaled;   ///< Fences the "GPU" is done with.
+        int blockingWaits = 0;          ///< Waits that had to block.
+        int released = 0;               ///< Fences handed back.
+
+        FenceHandle make(uintptr_t id) const { return reinterpret_cast<FenceHandle>(id); }
+        void signal(uintptr_t id) { signaled.insert(id); }
+
+        RingBufferAllocator makeRing(size_t capacity, unsigned int maxFramesInFlight)
+        {
+            return RingBufferAllocator(capacity, maxFramesInFlight,
+                [this](FenceHandle fence, bool block)
+                {
+                    uintptr_t id = reinterpret_cast<uintptr_t>(fence);
+                    if (block && !signaled.count(id))
+                    {
+                        // Blocking stands for the GPU catching up
+                        blockingWaits++;
+                        signaled.insert(id);
+                    }
+                    return signaled.count(id) > 0;
+                },
+                [this](FenceHandle) { released++; });
+        }
+    };
+}
+
+SGE_TEST(RingBufferAllocatesAlignedBlocksInOrder)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(256, 2);
+
+    size_t offset = 0;
+    SGE_CHECK(ring.allocate(10, 1, offset) && offset == 0);
+    SGE_CHECK(ring.allocate(16, 16, offset) && offset == 16);
+    SGE_CHECK(ring.getUsedBytes() == 32); // The alignment padding counts as used
+    SGE_CHECK(ring.getFrameBytes() == 32);
+    SGE_CHECK(!ring.frameWrapped());
+}
+
+SGE_TEST(RingBufferWrapsAroundOnceTheOldestFrameRetires)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(100, 2);
+
+    size_t offset = 0;
+    SGE_CHECK(ring.allocate(40, 1, offset) && offset == 0);
+    ring.endFrame(fences.make(1));
+    SGE_CHECK(ring.allocate(40, 1, offset) && offset == 40);
+    ring.endFrame(fences.make(2));
+    fences.signal(1);
+
+    // The second block does not fit before the end, the first frame's space is free again
+    SGE_CHECK(ring.allocate(15, 1, offset) && offset == 80);
+    SGE_CHECK(ring.allocate(15, 1, offset) && offset == 0);
+    SGE_CHECK(ring.frameWrapped());
+    SGE_CHECK(ring.getWrapCount() == 1);
+    SGE_CHECK(ring.getStallCount() == 0);
+    SGE_CHECK(ring.getUsedBytes() == 75); // The 5 bytes skipped at the end count until the frame retires
+    SGE_CHECK(fences.released == 1);
+
+    ring.endFrame(fences.make(3));
+    fences.signal(2);
+    fences.signal(3);
+    SGE_CHECK(ring.allocate(20, 1, offset) && offset == 0); // Everything retired, restarts at the beginning
+    SGE_CHECK(ring.getUsedBytes() == 20);
+    SGE_CHECK(fences.released == 3);
+}
+
+SGE_TEST(RingBufferStallsOnAFenceStillInFlight)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(100, 3);
+
+    size_t offset = 0;
+    SGE_CHECK(ring.allocate(80, 1, offset));
+    ring.endFrame(fences.make(1));
+
+    // No room before the end nor before the unsignaled frame, so the allocator has to wait
+    SGE_CHECK(ring.allocate(50, 1, offset) && offset == 0);
+    SGE_CHECK(ring.getStallCount() == 1);
+    SGE_CHECK(fences.blockingWaits == 1);
+    SGE_CHECK(fences.released == 1);
+    SGE_CHECK(ring.getFramesInFlight() == 0);
+}
+
+SGE_TEST(RingBufferStallsWhenTooManyFramesAreInFlight)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(1024, 2);
+
+    size_t offset = 0;
+    for (uintptr_t frame = 1; frame <= 3; ++frame)
+    {
+        SGE_CHECK(ring.allocate(16, 1, offset));
+        ring.endFrame(fences.make(frame));
+    }
+
+    // The third frame waited for the first
+    SGE_CHECK(ring.getStallCount() == 1);
+    SGE_CHECK(ring.getFramesInFlight() == 2);
+    SGE_CHECK(ring.getUsedBytes() == 32);
+}
+
+SGE_TEST(RingBufferRejectsBlocksThatCanNeverFit)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(100, 2);
+
+    size_t offset = 0;
+    SGE_CHECK(!ring.allocate(0, 1, offset));
+    SGE_CHECK(!ring.allocate(101, 1, offset));
+
+    // Only the current frame is live, waiting would never free anything
+    SGE_CHECK(ring.allocate(60, 1, offset));
+    SGE_CHECK(!ring.allocate(50, 1, offset));
+    SGE_CHECK(ring.getStallCount() == 0);
+}
+
+SGE_TEST(RingBufferReleasesTheFenceOfAnEmptyFrame)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(100, 2);
+
+    ring.endFrame(fences.make(1));
+    SGE_CHECK(fences.released == 1);
+    SGE_CHECK(ring.getFramesInFlight() == 0);
+}
+
+SGE_TEST(RingBufferResetWaitsForEveryFrame)
+{
+    FakeFences fences;
+    RingBufferAllocator ring = fences.makeRing(100, 4);
+
+    size_t offset = 0;
+    SGE_CHECK(ring.allocate(30, 1, offset));
+    ring.endFrame(fences.make(1));
+    SGE_CHECK(ring.allocate(30, 1, offset));
+    ring.endFrame(fences.make(2));
+
+    ring.reset();
+    SGE_CHECK(ring.getStallCount() == 2);
+    SGE_CHECK(fences.released == 2);
+    SGE_CHECK(ring.getUsedBytes() == 0);
+    SGE_CHECK(ring.getFramesInFlight() == 0);
+    SGE_CHECK(ring.allocate(100, 1, offset) && offset == 0);
+}
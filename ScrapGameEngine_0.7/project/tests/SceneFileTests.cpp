@@ -0,0 +1,254 @@
+#include "Test.h"
+#include "SceneFile.h"
+#include "SceneWriter.h"
+#include "SpriteRenderer.h"
+#include "Button.h"
+#include "TweenComponent.h"
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace ScrapGameEngine;
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @brief Gets a path in the test's temporary directory, creating the directory.
+     * @param name The file name.
+     * @return The path.
+     */
+    std::string tempPath(const std::string& name)
+    {
+        fs::path directory = fs::temp_directory_path() / "sge_scene_file_test";
+        fs::create_directories(directory);
+        return (directory / name).generic_string();
+    }
+
+    /**
+     * @brief Reads a whole file.
+     * @param path The file path.
+     * @return The bytes, empty if the file cannot be read.
+     */
+    std::string readBytes(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    /**
+     * @brief Replaces a file with the given bytes.
+     * @param path The file path.
+     * @param bytes The new content.
+     */
+    void writeBytes(const std::string& path, const std::string& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /**
+     * @brief Writes a two object scene: a root and a child parented to it.
+     * @param path The file path.
+     * @return True if the file was written.
+     */
+    bool writeHierarchy(const std::string& path)
+    {
+        SceneWriter writer;
+        uint32_t root = writer.addObject("Root", { 1.0f, 2.0f }, 90.0f, { 2.0f, 3.0f });
+        writer.addObject("Child", { 0.5f, 0.0f }, 0.0f, { 1.0f, 1.0f }, static_cast<int32_t>(root));
+        return writer.write(path);
+    }
+
+    /**
+     * @brief Compares floats with a tolerance for the transform math.
+     * @param a The first value.
+     * @param b The second value.
+     * @return True if they are within 1e-4.
+     */
+    bool nearlyEqual(float a, float b)
+    {
+        return std::fabs(a - b) < 1e-4f;
+    }
+}
+
+SGE_TEST(SceneFileRoundTripsObjectsAndComponents)
+{
+    std::string path = tempPath("round_trip.sgescene");
+    {
+        SceneWriter writer;
+        uint32_t root = writer.addObject("Root", { 1.0f, 2.0f }, 90.0f, { 2.0f, 3.0f });
+        uint32_t child = writer.addObject("Child", { 0.5f, 0.0f }, 0.0f, { 1.0f, 1.0f }, static_cast<int32_t>(root));
+        writer.addSprite(child, "", TextureConfig()).opacity = 0.25f;
+        writer.addButton(root).transparency = 0.0f;
+        SceneTweenRecord& tween = writer.addTween(child);
+        tween.type = static_cast<uint32_t>(TweenType::POSITION);
+        tween.target[0] = 2.0f;
+        tween.duration = 1.0f;
+        tween.autoStart = 1;
+        SGE_CHECK(writer.write(path));
+    }
+
+    SceneFile file;
+    SGE_CHECK(file.open(path));
+    if (!file.isOpen()) return;
+
+    const SceneFileHeader& header = file.getHeader();
+    SGE_CHECK(header.objectCount == 2);
+    SGE_CHECK(header.spriteCount == 1);
+    SGE_CHECK(header.buttonCount == 1);
+    SGE_CHECK(header.tweenCount == 1);
+    SGE_CHECK(header.assetCount == 0);
+
+    SceneInstance instance;
+    SGE_CHECK(file.instantiate(instance, false));
+    SGE_CHECK(instance.objects.size() == 2);
+
+    GameObject* root = instance.find("Root");
+    GameObject* child = instance.find("Child");
+    SGE_CHECK(root && child);
+    if (root && child)
+    {
+        SGE_CHECK(child->transform->getParent() == root->transform);
+        SGE_CHECK(nearlyEqual(root->transform->getPosition().x, 1.0f) && nearlyEqual(root->transform->getPosition().y, 2.0f));
+        SGE_CHECK(nearlyEqual(root->transform->getLocalRotation(), 90.0f));
+        SGE_CHECK(nearlyEqual(root->transform->getLocalScale().x, 2.0f) && nearlyEqual(root->transform->getLocalScale().y, 3.0f));
+
+        // The child's local offset is rotated by the root, parent scale does not move children
+        glm::vec2 world = child->transform->getWorldPosition();
+        SGE_CHECK(nearlyEqual(world.x, 1.0f) && nearlyEqual(world.y, 2.5f));
+
+        SGE_CHECK(child->getComponent<SpriteRenderer>() != nullptr);
+        SGE_CHECK(root->getComponent<Button>() != nullptr);
+        TweenComponent* tweenComponent = child->getComponent<TweenComponent>();
+        SGE_CHECK(tweenComponent && tweenComponent->isPlaying());
+    }
+
+    for (GameObject* object : instance.objects)
+    {
+        delete object;
+    }
+    SceneFile::release(instance);
+}
+
+SGE_TEST(SceneFileDeclaresEachAssetOnce)
+{
+    std::string path = tempPath("assets.sgescene");
+    TextureConfig cfg;
+    cfg.filterMode = TextureFilterMode::NEAREST;
+    cfg.borderColor = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+    {
+        SceneWriter writer;
+        uint32_t first = writer.addObject("First");
+        uint32_t second = writer.addObject("Second");
+        writer.addSprite(first, "textures/shared.png", cfg);
+        writer.addSprite(second, "textures/shared.png", TextureConfig()); // The first configuration is kept
+        writer.addAudio(first, "audio/click.mp3");
+        SGE_CHECK(writer.write(path));
+    }
+
+    SceneFile file;
+    SGE_CHECK(file.open(path));
+    if (!file.isOpen()) return;
+    SGE_CHECK(file.getHeader().assetCount == 2);
+
+    SceneManifest manifest;
+    file.declareAssets(manifest);
+    const std::vector<AssetRequest>& assets = manifest.getAssets();
+    SGE_CHECK(assets.size() == 2);
+    if (assets.size() != 2) return;
+
+    SGE_CHECK(assets[0].type == AssetType::TEXTURE && assets[0].path == "textures/shared.png");
+    SGE_CHECK(assets[0].textureConfig.filterMode == TextureFilterMode::NEAREST);
+    SGE_CHECK(assets[0].textureConfig.borderColor == cfg.borderColor);
+    SGE_CHECK(assets[1].type == AssetType::AUDIO && assets[1].path == "audio/click.mp3");
+}
+
+SGE_TEST(SceneFileRejectsTruncatedFiles)
+{
+    std::string path = tempPath("complete.sgescene");
+    SGE_CHECK(writeHierarchy(path));
+    std::string bytes = readBytes(path);
+
+    SceneFile file;
+    SGE_CHECK(file.open(path));
+
+    // Missing the end of the string table
+    std::string truncated = tempPath("truncated.sgescene");
+    writeBytes(truncated, bytes.substr(0, bytes.size() - 3));
+    SGE_CHECK(!file.open(truncated));
+    SGE_CHECK(!file.isOpen());
+
+    // Not even a whole header
+    writeBytes(truncated, bytes.substr(0, sizeof(SceneFileHeader) - 1));
+    SGE_CHECK(!file.open(truncated));
+
+    writeBytes(truncated, std::string());
+    SGE_CHECK(!file.open(truncated));
+
+    SGE_CHECK(!file.open(tempPath("missing.sgescene")));
+}
+
+SGE_TEST(SceneFileRejectsForwardAndSelfParents)
+{
+    std::string path = tempPath("parents.sgescene");
+    SGE_CHECK(writeHierarchy(path));
+    std::string bytes = readBytes(path);
+
+    // Objects may only be parented to an earlier object, so instantiate() never reads one not yet created
+    const size_t firstParent = sizeof(SceneFileHeader) + offsetof(SceneObjectRecord, parent);
+    const size_t secondParent = firstParent + sizeof(SceneObjectRecord);
+    std::string corrupt = tempPath("corrupt.sgescene");
+    SceneFile file;
+
+    std::string forward = bytes;
+    int32_t parent = 1;
+    std::memcpy(&forward[firstParent], &parent, sizeof(parent));
+    writeBytes(corrupt, forward);
+    SGE_CHECK(!file.open(corrupt));
+
+    std::string self = bytes;
+    std::memcpy(&self[secondParent], &parent, sizeof(parent));
+    writeBytes(corrupt, self);
+    SGE_CHECK(!file.open(corrupt));
+
+    std::string outOfRange = bytes;
+    parent = -2;
+    std::memcpy(&outOfRange[secondParent], &parent, sizeof(parent));
+    writeBytes(corrupt, outOfRange);
+    SGE_CHECK(!file.open(corrupt));
+
+    // The untouched file still loads
+    SGE_CHECK(file.open(path));
+}
+
+SGE_TEST(SceneFileRejectsOtherFormats)
+{
+    std::string path = tempPath("format.sgescene");
+    SGE_CHECK(writeHierarchy(path));
+    std::string bytes = readBytes(path);
+    std::string corrupt = tempPath("format_corrupt.sgescene");
+    SceneFile file;
+
+    std::string magic = bytes;
+    magic[0] = 'X';
+    writeBytes(corrupt, magic);
+    SGE_CHECK(!file.open(corrupt));
+
+    std::string version = bytes;
+    uint32_t newer = SCENE_FORMAT_VERSION + 1;
+    std::memcpy(&version[offsetof(SceneFileHeader, version)], &newer, sizeof(newer));
+    writeBytes(corrupt, version);
+    SGE_CHECK(!file.open(corrupt));
+
+    // A name offset past the string table
+    std::string name = bytes;
+    uint32_t offset = 0xFFFFu;
+    std::memcpy(&name[sizeof(SceneFileHeader) + offsetof(SceneObjectRecord, name)], &offset, sizeof(offset));
+    writeBytes(corrupt, name);
+    SGE_CHECK(!file.open(corrupt));
+}
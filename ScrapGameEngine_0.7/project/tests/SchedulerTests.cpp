@@ -0,0 +1,64 @@
+#include "Test.h"
+#include "Scheduler.h"
+#include <cstdint>
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+SGE_TEST(SchedulerSkipsCancelledTasks)
+{
+    int delayedCalls = 0;
+    int repeatingCalls = 0;
+    uint64_t delayed = Scheduler::addDelayedTask([&delayedCalls]() { delayedCalls++; }, 0.5f);
+    uint64_t repeating = Scheduler::addRepeatingTask([&repeatingCalls]() { repeatingCalls++; return false; });
+    SGE_CHECK(delayed != 0 && repeating != 0 && delayed != repeating);
+
+    Scheduler::update(0.1f);
+    SGE_CHECK(repeatingCalls == 1);
+
+    // As a scene does when it is left with a task still waiting
+    SGE_CHECK(Scheduler::cancel(delayed));
+    SGE_CHECK(Scheduler::cancel(repeating));
+    SGE_CHECK(!Scheduler::cancel(repeating));
+
+    Scheduler::update(1.0f);
+    SGE_CHECK(delayedCalls == 0);
+    SGE_CHECK(repeatingCalls == 1);
+    Scheduler::dispose();
+}
+
+SGE_TEST(SchedulerLetsTasksAddAndCancelTasksWhileRunning)
+{
+    std::vector<int> calls;
+    uint64_t victim = 0;
+
+    // The first task cancels the one after it and adds more than the list could hold without growing
+    Scheduler::addRepeatingTask([&]()
+        {
+            calls.push_back(0);
+            Scheduler::cancel(victim);
+            for (int i = 0; i < 16; ++i)
+            {
+                Scheduler::addDelayedTask([&calls]() { calls.push_back(2); }, 0.0f);
+            }
+            return true;
+        });
+    victim = Scheduler::addRepeatingTask([&calls]() { calls.push_back(1); return true; });
+
+    // Tasks added during an update run from the next one
+    Scheduler::update(0.1f);
+    SGE_CHECK(calls.size() == 1 && calls[0] == 0);
+
+    Scheduler::update(0.1f);
+    SGE_CHECK(calls.size() == 17);
+    for (size_t i = 1; i < calls.size(); ++i)
+    {
+        SGE_CHECK(calls[i] == 2);
+    }
+    SGE_CHECK(!Scheduler::cancel(victim));
+
+    // Nothing is left to run
+    Scheduler::update(0.1f);
+    SGE_CHECK(calls.size() == 17);
+    Scheduler::dispose();
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace ScrapGameEngine
+{
+    /**
+     * @typedef TestFunction
+     * @brief A test body, registered with SGE_TEST.
+     */
+    using TestFunction = void(*)();
+
+    /**
+     * @class TestRegistry
+     * @brief Collects the tests of every file and runs them.
+     *
+     * Tests register themselves during static initialization through SGE_TEST. A failed check
+     * is reported with its file and line, and the test carries on so one run shows every failure.
+     */
+    class TestRegistry
+    {
+    public:
+        TestRegistry() = delete; ///< Prevent instantiation of this class.
+
+        /**
+         * @brief Registers a test.
+         * @param name The test name.
+         * @param function The test body.
+         * @return Always true, so it can initialize a static.
+         */
+        static bool add(const char* name, TestFunction function);
+
+        /**
+         * @brief Records the outcome of a check in the running test.
+         * @param passed The outcome.
+         * @param expression The checked expression.
+         * @param file The source file of the check.
+         * @param line The source line of the check.
+         * @return The outcome.
+         */
+        static bool check(bool passed, const char* expression, const char* file, int line);
+
+        /**
+         * @brief Runs the tests whose name contains a filter.
+         * @param filter The filter, empty to run every test.
+         * @return The number of failed tests.
+         */
+        static int run(const std::string& filter);
+
+    private:
+        /**
+         * @struct Entry
+         * @brief A registered test.
+         */
+        struct Entry
+        {
+            const char* name;       ///< Test name.
+            TestFunction function;  ///< Test body.
+        };
+
+        /**
+         * @brief Gets the registered tests, built on first use so registration order does not matter.
+         * @return The tests.
+         */
+        static std::vector<Entry>& getEntries();
+
+        static int failedChecks; ///< Failed checks of the running test.
+    };
+}
+
+/** @brief Defines and registers a test. */
+#define SGE_TEST(name) \
+    static void name(); \
+    static const bool name##Registered = ::ScrapGameEngine::TestRegistry::add(#name, &name); \
+    static void name()
+
+/** @brief Checks a condition, reporting it and carrying on when it does not hold. */
+#define SGE_CHECK(condition) ::ScrapGameEngine::TestRegistry::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
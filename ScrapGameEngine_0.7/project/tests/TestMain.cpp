@@ -0,0 +1,60 @@
+#include "Test.h"
+#include <cstdio>
+
+using namespace ScrapGameEngine;
+
+int TestRegistry::failedChecks = 0;
+
+bool TestRegistry::add(const char* name, TestFunction function)
+{
+    getEntries().push_back({ name, function });
+    return true;
+}
+
+bool TestRegistry::check(bool passed, const char* expression, const char* file, int line)
+{
+    if (!passed)
+    {
+        failedChecks++;
+        std::printf("    %s(%d): check failed: %s\n", file, line, expression);
+    }
+    return passed;
+}
+
+int TestRegistry::run(const std::string& filter)
+{
+    int failedTests = 0;
+    int ranTests = 0;
+    for (const Entry& entry : getEntries())
+    {
+        if (!filter.empty() && std::string(entry.name).find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        failedChecks = 0;
+        entry.function();
+        ranTests++;
+
+        if (failedChecks > 0)
+        {
+            failedTests++;
+        }
+        std::printf("[%s] %s\n", failedChecks > 0 ? "FAIL" : " OK ", entry.name);
+    }
+
+    std::printf("%d of %d tests passed\n", ranTests - failedTests, ranTests);
+    return failedTests;
+}
+
+std::vector<TestRegistry::Entry>& TestRegistry::getEntries()
+{
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+// Runs every test, or those whose name contains the first argument
+int main(int argc, char** argv)
+{
+    return TestRegistry::run(argc > 1 ? argv[1] : "") > 0 ? 1 : 0;
+}
@@ -0,0 +1,283 @@
+#include "Test.h"
+#include "TextureProcessing.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ScrapGameEngine;
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @brief Creates an image of one color.
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     * @param channels The channel count.
+     * @param value The value of every channel.
+     * @return The image.
+     */
+    TextureImage solidImage(int width, int height, int channels, unsigned char value)
+    {
+        TextureImage image;
+        image.width = width;
+        image.height = height;
+        image.channels = channels;
+        image.pixels.assign(static_cast<size_t>(width) * height * channels, value);
+        return image;
+    }
+
+    /**
+     * @brief Creates an RGBA image with smooth color ramps and an alpha ramp.
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     * @return The image.
+     */
+    TextureImage gradientImage(int width, int height)
+    {
+        TextureImage image = solidImage(width, height, 4, 0);
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                unsigned char* pixel = &image.pixels[(static_cast<size_t>(y) * width + x) * 4];
+                pixel[0] = static_cast<unsigned char>(x * 255 / (width - 1));
+                pixel[1] = static_cast<unsigned char>(y * 255 / (height - 1));
+                pixel[2] = static_cast<unsigned char>((x + y) * 255 / (width + height - 2));
+                pixel[3] = static_cast<unsigned char>(255 - x * 255 / (width - 1));
+            }
+        }
+        return image;
+    }
+
+    /**
+     * @brief Measures the peak signal to noise ratio of the first channels of two RGBA buffers.
+     * @param a The first pixels.
+     * @param b The second pixels, the same size.
+     * @param channels The channels compared in each pixel, from the first.
+     * @return The PSNR in dB, 100 for identical buffers.
+     */
+    double psnr(const std::vector<unsigned char>& a, const std::vector<unsigned char>& b, int channels)
+    {
+        double squared = 0.0;
+        size_t samples = 0;
+        for (size_t i = 0; i < a.size(); i += 4)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                double difference = static_cast<double>(a[i + c]) - b[i + c];
+                squared += difference * difference;
+                samples++;
+            }
+        }
+        if (squared == 0.0) return 100.0;
+        return 10.0 * std::log10(255.0 * 255.0 / (squared / samples));
+    }
+
+    /**
+     * @brief Halves an image with the scalar box filter the SSE2 path must match.
+     * @param source The image.
+     * @return The next mip level.
+     */
+    TextureImage referenceBox(const TextureImage& source)
+    {
+        TextureImage target = solidImage(std::max(1, source.width / 2), std::max(1, source.height / 2), source.channels, 0);
+        const int channels = source.channels;
+        for (int y = 0; y < target.height; ++y)
+        {
+            int y0 = std::min(2 * y, source.height - 1);
+            int y1 = std::min(2 * y + 1, source.height - 1);
+            for (int x = 0; x < target.width; ++x)
+            {
+                int x0 = std::min(2 * x, source.width - 1);
+                int x1 = std::min(2 * x + 1, source.width - 1);
+                for (int c = 0; c < channels; ++c)
+                {
+                    auto at = [&](int sx, int sy) { return source.pixels[(static_cast<size_t>(sy) * source.width + sx) * channels + c]; };
+                    target.pixels[(static_cast<size_t>(y) * target.width + x) * channels + c] =
+                        static_cast<unsigned char>((at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1) + 2) >> 2);
+                }
+            }
+        }
+        return target;
+    }
+}
+
+SGE_TEST(TextureProcessingRoundTripsSolidBlocksExactly)
+{
+    // A color whose 5:6:5 form expands back to itself: 165 = 20 << 3 | 20 >> 2, 162 = 40 << 2 | 40 >> 4, 82 = 10 << 3 | 10 >> 2
+    TextureImage image = solidImage(8, 8, 4, 0);
+    for (size_t i = 0; i < image.pixels.size(); i += 4)
+    {
+        image.pixels[i] = 165;
+        image.pixels[i + 1] = 162;
+        image.pixels[i + 2] = 82;
+        image.pixels[i + 3] = 200;
+    }
+
+    std::vector<unsigned char> blocks;
+    std::vector<unsigned char> decoded;
+    TextureProcessing::encodeBC3(image.pixels.data(), image.width, image.height, blocks);
+    SGE_CHECK(blocks.size() == TextureProcessing::getLevelSize(TextureFormat::BC3, 8, 8));
+    TextureProcessing::decodeBC3(blocks.data(), image.width, image.height, decoded);
+    SGE_CHECK(decoded == image.pixels);
+
+    // BC1 stores no alpha, so compare against the opaque image
+    for (size_t i = 3; i < image.pixels.size(); i += 4) image.pixels[i] = 255;
+    TextureProcessing::encodeBC1(image.pixels.data(), image.width, image.height, blocks);
+    SGE_CHECK(blocks.size() == TextureProcessing::getLevelSize(TextureFormat::BC1, 8, 8));
+    TextureProcessing::decodeBC1(blocks.data(), image.width, image.height, decoded);
+    SGE_CHECK(decoded == image.pixels);
+}
+
+SGE_TEST(TextureProcessingKeepsGradientsAboveAPsnrFloor)
+{
+    TextureImage image = gradientImage(64, 64);
+    std::vector<unsigned char> blocks;
+    std::vector<unsigned char> decoded;
+
+    TextureProcessing::encodeBC1(image.pixels.data(), image.width, image.height, blocks);
+    TextureProcessing::decodeBC1(blocks.data(), image.width, image.height, decoded);
+    double bc1 = psnr(image.pixels, decoded, 3);
+    SGE_CHECK(bc1 >= 35.0);
+    std::printf("    BC1 gradient PSNR %.1f dB\n", bc1);
+
+    TextureProcessing::encodeBC3(image.pixels.data(), image.width, image.height, blocks);
+    TextureProcessing::decodeBC3(blocks.data(), image.width, image.height, decoded);
+    SGE_CHECK(psnr(image.pixels, decoded, 3) >= 35.0);
+}
+
+SGE_TEST(TextureProcessingEncodesBC3Alpha)
+{
+    TextureImage image = gradientImage(61, 37); // Partial blocks on both edges
+    std::vector<unsigned char> blocks;
+    std::vector<unsigned char> decoded;
+    TextureProcessing::encodeBC3(image.pixels.data(), image.width, image.height, blocks);
+    TextureProcessing::decodeBC3(blocks.data(), image.width, image.height, decoded);
+    SGE_CHECK(decoded.size() == image.pixels.size());
+
+    // Eight interpolated levels between the block's extremes keep a ramp within a few steps
+    int maxError = 0;
+    for (size_t i = 3; i < image.pixels.size(); i += 4)
+    {
+        maxError = std::max(maxError, std::abs(static_cast<int>(image.pixels[i]) - decoded[i]));
+    }
+    SGE_CHECK(maxError <= 4);
+
+    // Fully opaque and fully transparent pixels stay exact
+    TextureImage cutout = solidImage(4, 4, 4, 255);
+    for (size_t i = 3; i < cutout.pixels.size(); i += 8) cutout.pixels[i] = 0;
+    TextureProcessing::encodeBC3(cutout.pixels.data(), cutout.width, cutout.height, blocks);
+    TextureProcessing::decodeBC3(blocks.data(), cutout.width, cutout.height, decoded);
+    for (size_t i = 3; i < cutout.pixels.size(); i += 4)
+    {
+        SGE_CHECK(decoded[i] == cutout.pixels[i]);
+    }
+}
+
+SGE_TEST(TextureProcessingBuildsOddSizedChainsDownToOnePixel)
+{
+    for (MipFilter filter : { MipFilter::BOX, MipFilter::KAISER })
+    {
+        TextureImage base = gradientImage(257, 131);
+        std::vector<TextureImage> mips;
+        TextureProcessing::generateMipChain(base, filter, mips);
+
+        // 128x65, 64x32, 32x16, 16x8, 8x4, 4x2, 2x1, 1x1
+        SGE_CHECK(mips.size() == 8);
+        int width = base.width;
+        int height = base.height;
+        for (const TextureImage& mip : mips)
+        {
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+            SGE_CHECK(mip.width == width && mip.height == height);
+            SGE_CHECK(mip.channels == 4);
+            SGE_CHECK(mip.pixels.size() == static_cast<size_t>(width) * height * 4);
+        }
+        SGE_CHECK(!mips.empty() && mips.back().width == 1 && mips.back().height == 1);
+    }
+}
+
+SGE_TEST(TextureProcessingBoxFilterMatchesTheScalarPath)
+{
+    // Noise, so any lane or rounding mistake shows; odd sizes exercise the scalar tail after the SSE2 loop
+    TextureImage image = solidImage(203, 77, 4, 0);
+    uint32_t state = 0x2545F491u;
+    for (unsigned char& value : image.pixels)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = static_cast<unsigned char>(state >> 24);
+    }
+
+    TextureImage current = image;
+    while (current.width > 1 || current.height > 1)
+    {
+        TextureImage fast = TextureProcessing::downsample(current, MipFilter::BOX);
+        TextureImage reference = referenceBox(current);
+        SGE_CHECK(fast.width == reference.width && fast.height == reference.height);
+        SGE_CHECK(fast.pixels == reference.pixels);
+        current = fast;
+    }
+    std::printf("    SSE2 box filter compiled in: %s\n", TextureProcessing::isSimdCompiledIn() ? "yes" : "no");
+}
+
+SGE_TEST(TextureProcessingKaiserKeepsFlatImagesFlat)
+{
+    // The normalized kernel overshoots only at edges, which a flat image has none of
+    for (int channels : { 1, 3, 4 })
+    {
+        TextureImage flat = solidImage(67, 45, channels, 137);
+        std::vector<TextureImage> mips;
+        TextureProcessing::generateMipChain(flat, MipFilter::KAISER, mips);
+        for (const TextureImage& mip : mips)
+        {
+            SGE_CHECK(std::all_of(mip.pixels.begin(), mip.pixels.end(), [](unsigned char value) { return value == 137; }));
+        }
+    }
+}
+
+SGE_TEST(TextureProcessingRoundTripsBakedFiles)
+{
+    fs::path directory = fs::temp_directory_path() / "sge_texture_processing_test";
+    fs::create_directories(directory);
+    std::string path = (directory / "gradient.png.sgetex").generic_string();
+
+    BakedTexture baked;
+    TextureProcessing::bake(gradientImage(37, 20), TextureFormat::BC3, true, MipFilter::KAISER, baked);
+    SGE_CHECK(baked.levels.size() == 6); // 37x20 down to 1x1
+    SGE_CHECK(TextureProcessing::writeBaked(path, baked));
+
+    BakedTexture loaded;
+    SGE_CHECK(TextureProcessing::readBaked(path, loaded));
+    SGE_CHECK(loaded.format == TextureFormat::BC3);
+    SGE_CHECK(loaded.levels.size() == baked.levels.size());
+    for (size_t i = 0; i < loaded.levels.size() && i < baked.levels.size(); ++i)
+    {
+        SGE_CHECK(loaded.levels[i].width == baked.levels[i].width);
+        SGE_CHECK(loaded.levels[i].height == baked.levels[i].height);
+        SGE_CHECK(loaded.levels[i].data == baked.levels[i].data);
+    }
+
+    // A file cut short is rejected rather than read past its end
+    std::string truncated = (directory / "truncated.sgetex").generic_string();
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(truncated, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 5));
+    }
+    BakedTexture rejected;
+    SGE_CHECK(!TextureProcessing::readBaked(truncated, rejected));
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,40 @@
+#include "Test.h"
+#include "GameObject.h"
+#include <vector>
+
+using namespace ScrapGameEngine;
+
+SGE_TEST(TransformRegistryKeepsSurvivorsAfterDestruction)
+{
+    std::vector<GameObject*> objects;
+    for (int i = 0; i < 100; ++i)
+    {
+        objects.push_back(GameObject::Create());
+        objects.back()->transform->setPosition({ static_cast<float>(i), 0.0f });
+    }
+
+    // Destroy out of order, so removals move transforms from the end into the holes
+    for (int i = 0; i < 100; i += 3)
+    {
+        delete objects[i];
+        objects[i] = nullptr;
+    }
+    delete objects[99];
+    objects[99] = nullptr;
+
+    Transform::storePreviousStates();
+
+    // Every survivor must still be registered, or its previous state would be stale
+    for (int i = 0; i < 100; ++i)
+    {
+        if (!objects[i]) continue;
+        objects[i]->transform->setPosition({ i + 10.0f, 0.0f });
+        SGE_CHECK(objects[i]->transform->getInterpolatedPosition(0.0f).x == static_cast<float>(i));
+        SGE_CHECK(objects[i]->transform->getInterpolatedPosition(1.0f).x == i + 10.0f);
+    }
+
+    for (GameObject* object : objects)
+    {
+        delete object;
+    }
+}